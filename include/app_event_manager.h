@@ -55,6 +55,16 @@ enum app_event_type_flags {
 	 */
 	APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE =
 		APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START,
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+	/** processes the event type in the high priority lane.
+	 *  Flag set by user. Available only if CONFIG_APP_EVENT_MANAGER_LANES is enabled.
+	 */
+	APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY,
+	/** processes the event type in the low priority lane.
+	 *  Flag set by user. Available only if CONFIG_APP_EVENT_MANAGER_LANES is enabled.
+	 */
+	APP_EVENT_TYPE_FLAGS_LOW_PRIORITY,
+#endif
 	/** shows number of predefined flags.*/
 	APP_EVENT_TYPE_FLAGS_COUNT,
 	/** marks beginning of user-specific flags.*/
@@ -73,6 +83,40 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	return (et->flags & BIT(flag)) != 0;
 }
 
+/**
+ * @brief Event processing lanes.
+ */
+enum app_event_lane {
+	/** lane of event types with the APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY flag.*/
+	APP_EVENT_LANE_HIGH,
+	/** lane of event types without priority flags.*/
+	APP_EVENT_LANE_NORMAL,
+	/** lane of event types with the APP_EVENT_TYPE_FLAGS_LOW_PRIORITY flag.*/
+	APP_EVENT_LANE_LOW,
+	/** shows number of lanes.*/
+	APP_EVENT_LANE_COUNT,
+};
+
+/** @brief Get the processing lane of an event type.
+ *
+ * @param et Pointer to the event type.
+ * @retval Lane in which events of the given type are processed.
+ */
+static inline enum app_event_lane app_event_get_type_lane(const struct event_type *et)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+	if (app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY)) {
+		return APP_EVENT_LANE_HIGH;
+	} else if (app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_LOW_PRIORITY)) {
+		return APP_EVENT_LANE_LOW;
+	}
+#else
+	ARG_UNUSED(et);
+#endif
+
+	return APP_EVENT_LANE_NORMAL;
+}
+
 /**
  * @brief Get the event ID
  *
@@ -133,6 +177,53 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	const struct {} _CONCAT(_CONCAT(__event_subscriber_, ename), final_sub_redefined) = {}
 
 
+/** @brief Subscribe a listener to the early notification list for an
+ *  event type, only for events with selected values of an event field.
+ *
+ * The Application Event Manager checks the field before notifying the listener
+ * and skips the listener if the field value is not accepted.
+ *
+ * @param lname   Name of the listener.
+ * @param ename   Name of the event.
+ * @param field   Name of the event structure field with integer or enum type
+ *                of 1, 2, or 4 bytes.
+ * @param values  Bitmask of the accepted field values.
+ *                You should use APP_EVENT_FILTER_VALUES to define it.
+ */
+#define APP_EVENT_SUBSCRIBE_EARLY_FILTERED(lname, ename, field, values)			\
+	_APP_EVENT_SUBSCRIBE_FILTERED(lname, ename,						\
+				      _APP_EM_SUBS_PRIO_ID(_APP_EM_SUBS_PRIO_EARLY),		\
+				      field, values)
+
+
+/** @brief Subscribe a listener to the normal notification list for an event
+ *  type, only for events with selected values of an event field.
+ *
+ * The Application Event Manager checks the field before notifying the listener
+ * and skips the listener if the field value is not accepted.
+ *
+ * @param lname   Name of the listener.
+ * @param ename   Name of the event.
+ * @param field   Name of the event structure field with integer or enum type
+ *                of 1, 2, or 4 bytes.
+ * @param values  Bitmask of the accepted field values.
+ *                You should use APP_EVENT_FILTER_VALUES to define it.
+ */
+#define APP_EVENT_SUBSCRIBE_FILTERED(lname, ename, field, values)				\
+	_APP_EVENT_SUBSCRIBE_FILTERED(lname, ename,						\
+				      _APP_EM_SUBS_PRIO_ID(_APP_EM_SUBS_PRIO_NORMAL),		\
+				      field, values)
+
+
+/** @brief Define field values accepted by a filtered subscriber.
+ *
+ * @param ... Comma-separated list of accepted values.
+ *            Only values from 0 to 31 can be accepted.
+ */
+#define APP_EVENT_FILTER_VALUES(...) \
+	(FOR_EACH(_APP_EVENT_FILTER_VALUE, (|), __VA_ARGS__))
+
+
 /** @brief Declare an event type.
  *
  * This macro provides declarations required for an event to be used
@@ -403,6 +494,39 @@ void *app_event_manager_alloc(size_t size);
 void app_event_manager_free(void *addr);
 
 
+/** @brief Listener statistics of an event type. */
+struct app_event_manager_listener_stats {
+	/** Number of processed events. */
+	uint32_t event_cnt;
+
+	/** Number of listener notifications. */
+	uint32_t notified_cnt;
+
+	/** Number of notifications that did not consume the event. */
+	uint32_t not_consumed_cnt;
+
+	/** Number of listeners skipped by subscriber filters. */
+	uint32_t filtered_cnt;
+};
+
+
+/** @brief Get listener statistics of an event type.
+ *
+ * Listeners that often return false without handling the event waste
+ * processing time. Such listeners can use a filtered subscription instead
+ * (see @ref APP_EVENT_SUBSCRIBE_FILTERED).
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_LISTENER_STATS} option needs to be enabled.
+ *
+ * @param et     Pointer to the event type.
+ * @param stats  Pointer to the structure to be filled with the statistics.
+ */
+void app_event_manager_listener_stats_get(const struct event_type *et,
+					  struct app_event_manager_listener_stats *stats);
+
+
 /** @brief Log event.
  *
  * This helper macro simplifies event logging.
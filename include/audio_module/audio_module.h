@@ -314,8 +314,10 @@ struct audio_module_handle {
 	/* Number of destination modules. */
 	uint8_t dest_count;
 
-	/* Semaphore to count messages between modules and on a module's TX FIFO. */
-	struct k_sem sem;
+	/* Reference counts of the audio data items from the module's data slab, indexed by the
+	 * slab block. An item is freed when the last connected module releases it.
+	 */
+	atomic_t data_ref_cnt[CONFIG_AUDIO_MODULE_DATA_BLOCKS_MAX];
 
 	/* Mutex to make the above destinations list thread safe. */
 	struct k_mutex dest_mutex;
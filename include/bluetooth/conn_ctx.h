@@ -51,7 +51,9 @@ struct bt_conn_ctx {
 
 /** @brief Bluetooth connection context library structure. */
 struct bt_conn_ctx_lib {
-	/** Connection contexts. */
+	/** Connection contexts, indexed by the connection index
+	 *  (see @em bt_conn_index).
+	 */
 	struct bt_conn_ctx ctx[CONFIG_BT_MAX_CONN];
 
 	/** Context data mutex that ensures that only one connection context is
@@ -125,6 +127,8 @@ void bt_conn_ctx_free_all(struct bt_conn_ctx_lib *ctx_lib);
  *
  * This function finds a connection's context data in the memory pool.
  * The link to find is identified by the connection object.
+ * The mutex of the instance is only locked if the context data is found,
+ * and is held until the context data is released.
  *
  * This function should be used in conjunction with
  * @ref bt_conn_ctx_release to ensure proper operation.
@@ -142,7 +146,8 @@ void *bt_conn_ctx_get(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn);
  *
  * This function finds the connection context and the associated connection
  * object in the memory pool. The link to find is identified
- * by its index in the connection context array.
+ * by its index in the connection context array, which is the same as
+ * the connection index.
  *
  * This function should be used in conjunction with
  * @ref bt_conn_ctx_release to ensure proper operation.
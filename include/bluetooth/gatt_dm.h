@@ -283,6 +283,11 @@ const struct bt_gatt_dm_attr *bt_gatt_dm_desc_next(
  * service instances may be discovered.
  * Call @ref bt_gatt_dm_continue to discover the next service instance.
  *
+ * @note
+ * If CONFIG_BT_GATT_DM_CACHE is enabled and @p svc_uuid is set, the service
+ * attributes of a bonded peer are restored from the settings if the peer's
+ * Database Hash did not change since they were stored.
+ *
  * @retval 0 If the operation was successful.
  *           Otherwise, a (negative) error code is returned.
  */
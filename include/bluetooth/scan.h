@@ -280,6 +280,32 @@ struct bt_scan_filter_match {
 	struct bt_scan_manufacturer_data_filter_status manufacturer_data;
 };
 
+/**@brief Filter statistics structure.
+ */
+struct bt_scan_stats {
+	/** Number of advertising reports processed. */
+	uint32_t reports;
+
+	/** Number of advertising reports whose advertising data was not
+	 *  parsed, because it holds no data type checked by the enabled
+	 *  filters.
+	 */
+	uint32_t prescreened;
+
+	/** Number of advertising reports that matched the filters. */
+	uint32_t matched;
+
+	/** Advertising reports processed per second, measured over
+	 *  the last window of at least one second.
+	 */
+	uint32_t reports_per_sec;
+
+	/** Advertising reports matched per second, measured over
+	 *  the last window of at least one second.
+	 */
+	uint32_t matched_per_sec;
+};
+
 /**@brief Structure containing device data needed to establish
  *        connection and advertising information.
  */
@@ -548,6 +574,10 @@ void bt_scan_conn_attempts_filter_clear(void);
  *          blocklist device or does not try to connect such
  *          devices.
  *
+ * @note If @kconfig{CONFIG_BT_SCAN_DEVICE_HASH} is enabled and the blocklist
+ *       is full, the device replaces a device that has not been seen
+ *       recently.
+ *
  * @param[in] addr Device address.
  *
  * @retval 0 If the operation was successful. Otherwise, a (negative) error
@@ -562,6 +592,24 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr);
  */
 void bt_scan_blocklist_clear(void);
 
+/**@brief Get the filter statistics.
+ *
+ * @details The statistics are available if
+ *          @kconfig{CONFIG_BT_SCAN_STATS} is enabled.
+ *          They cover the advertising reports processed since
+ *          the last call to @ref bt_scan_stats_reset.
+ *
+ * @param[out] stats Pointer to the statistics structure.
+ *
+ * @return 0 If the operation was successful. Otherwise, a (negative) error
+ *	     code is returned.
+ */
+int bt_scan_stats_get(struct bt_scan_stats *stats);
+
+/**@brief Reset the filter statistics.
+ */
+void bt_scan_stats_reset(void);
+
 /**@brief Function to update the autoconnect flag after a filter match.
  *
  * @note The function should not be used when scanning is active.
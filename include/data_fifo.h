@@ -39,6 +39,21 @@ struct data_fifo {
 	uint32_t elements_max;
 	size_t block_size_max;
 	bool initialized;
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	/* Lock-free ring state, only used by FIFOs defined with DATA_FIFO_SPSC_DEFINE.
+	 * The indices run freely and are taken modulo elements_max to get the block.
+	 */
+	bool spsc;
+	size_t *block_sizes;
+	atomic_t alloc_idx;
+	atomic_t lock_idx;
+	atomic_t read_idx;
+	atomic_t free_idx;
+	atomic_t producer_waiting;
+	atomic_t consumer_waiting;
+	struct k_sem producer_wake;
+	struct k_sem consumer_wake;
+#endif /* CONFIG_DATA_FIFO_SPSC */
 };
 
 #define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
@@ -52,6 +67,33 @@ struct data_fifo {
 				 .elements_max = elements_max_in,                                  \
 				 .initialized = false}
 
+/**
+ * @brief Define a single-producer single-consumer data FIFO.
+ *
+ * The FIFO has the same API as one defined with DATA_FIFO_DEFINE, but passes the blocks
+ * through a lock-free ring instead of a memory slab and a message queue. Kernel objects are
+ * only used to wake up a producer or consumer that waits with a timeout.
+ *
+ * The following restrictions apply:
+ * - Only one thread may call data_fifo_pointer_first_vacant_get and data_fifo_block_lock,
+ *   and only one thread may call data_fifo_pointer_last_filled_get and data_fifo_block_free.
+ * - Blocks must be locked in the order they were given out, and freed in the order they
+ *   were read.
+ * - data_fifo_empty and data_fifo_uninit must not be called while the FIFO is in use.
+ *
+ * Requires CONFIG_DATA_FIFO_SPSC.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	size_t _block_sizes_##name[(elements_max_in)] = {0};                                      \
+	char __aligned(WB_UP(1)) _slab_buffer_##name[(elements_max_in) * (block_size_max_in)] = {  \
+		0};                                                                                \
+	struct data_fifo name = {.slab_buffer = _slab_buffer_##name,                               \
+				 .block_sizes = _block_sizes_##name,                               \
+				 .block_size_max = block_size_max_in,                              \
+				 .elements_max = elements_max_in,                                  \
+				 .spsc = true,                                                     \
+				 .initialized = false}
+
 /**
  * @brief Get pointer to the first vacant block in slab.
  *
@@ -68,7 +110,8 @@ struct data_fifo {
  *	or K_FOREVER to wait as long as necessary.
  *
  * @retval 0		Memory allocated.
- * @retval value	Return values from k_mem_slab_alloc.
+ * @retval value	Return values from k_mem_slab_alloc. A FIFO defined with
+ *			DATA_FIFO_SPSC_DEFINE returns the same values.
  */
 int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 				       k_timeout_t timeout);
@@ -92,6 +135,8 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
  * @retval -ESPIPE	A generic return value if an error occurs in k_msg_put.
  *			Since data has already been added to the slab, there
  *			must be space in the message queue.
+ *			A FIFO defined with DATA_FIFO_SPSC_DEFINE also returns
+ *			this value if the block is not locked in allocation order.
  */
 int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size);
 
@@ -111,7 +156,8 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size);
  *	or K_FOREVER to wait as long as necessary.
  *
  * @retval 0		Memory pointer retrieved.
- * @retval value	Return values from k_msgq_get.
+ * @retval value	Return values from k_msgq_get. A FIFO defined with
+ *			DATA_FIFO_SPSC_DEFINE returns the same values.
  */
 int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
 				      k_timeout_t timeout);
@@ -123,8 +169,12 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
  *
  * @param data_fifo Pointer to the data_fifo structure.
  * @param data Pointer to the memory area which is to be freed.
+ *
+ * @retval 0		Success.
+ * @retval -EINVAL	FIFO defined with DATA_FIFO_SPSC_DEFINE, and the block was
+ *			not freed in the order it was read.
  */
-void data_fifo_block_free(struct data_fifo *data_fifo, void *data);
+int data_fifo_block_free(struct data_fifo *data_fifo, void *data);
 
 /**
  * @brief See how many alloced and locked blocks are in the system.
@@ -7,6 +7,7 @@
 #ifndef __CPU_LOAD_H
 #define __CPU_LOAD_H
 
+#include <stddef.h>
 #include <zephyr/types.h>
 #include <zephyr/toolchain.h>
 
@@ -50,6 +51,73 @@ void cpu_load_reset(void);
  */
 int cpu_load_get(void);
 
+/** @brief CPU load of a thread. */
+struct cpu_load_thread_stat {
+	/** Thread. It may have exited since it was last running. */
+	const struct k_thread *thread;
+
+	/** System clock cycles spent in the thread. */
+	uint64_t cycles;
+
+	/** Share of the measured time spent in the thread, in 0,001% units. */
+	uint32_t load;
+};
+
+/** @brief CPU load of an interrupt. */
+struct cpu_load_irq_stat {
+	/** Interrupt number. */
+	uint32_t irq;
+
+	/** System clock cycles spent in the interrupt handler. */
+	uint64_t cycles;
+
+	/** Share of the measured time spent in the interrupt handler, in 0,001% units. */
+	uint32_t load;
+};
+
+/** @brief Get the CPU load of the threads.
+ *
+ * Available if @kconfig{CONFIG_NRF_CPU_LOAD_THREADS} is enabled. The time spent in the
+ * threads is measured since the last call to @ref cpu_load_stats_reset. Time spent in
+ * interrupt handlers is not accounted to the interrupted thread. The idle thread is reported
+ * like any other thread.
+ *
+ * @param stats Array to fill.
+ * @param count Number of elements in @p stats.
+ *
+ * @return Number of threads written to @p stats.
+ */
+int cpu_load_thread_stats_get(struct cpu_load_thread_stat *stats, size_t count);
+
+/** @brief Get the CPU load of the interrupts.
+ *
+ * Available if @kconfig{CONFIG_NRF_CPU_LOAD_THREADS} is enabled. Only interrupts which were
+ * handled since the last call to @ref cpu_load_stats_reset are reported.
+ *
+ * @param stats Array to fill.
+ * @param count Number of elements in @p stats.
+ *
+ * @return Number of interrupts written to @p stats.
+ */
+int cpu_load_irq_stats_get(struct cpu_load_irq_stat *stats, size_t count);
+
+/** @brief Get the total number of system clock cycles covered by the thread and interrupt
+ *	   statistics.
+ *
+ * Available if @kconfig{CONFIG_NRF_CPU_LOAD_THREADS} is enabled.
+ *
+ * @return Cycles since the last call to @ref cpu_load_stats_reset.
+ */
+uint64_t cpu_load_stats_cycles_get(void);
+
+/** @brief Reset the thread and interrupt statistics.
+ *
+ * Available if @kconfig{CONFIG_NRF_CPU_LOAD_THREADS} is enabled. The statistics are not
+ * reset by @ref cpu_load_reset, so that they can be sampled at a different interval than
+ * the CPU load.
+ */
+void cpu_load_stats_reset(void);
+
 /** @} */
 
 #ifdef __cplusplus
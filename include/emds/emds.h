@@ -23,6 +23,29 @@
 extern "C" {
 #endif
 
+/**
+ * @struct emds_dirty_region
+ *
+ * Part of the entry data changed since the last snapshot. Used when
+ * @kconfig{CONFIG_EMDS_INCREMENTAL} is enabled.
+ */
+struct emds_dirty_region {
+	/** Offset of the first changed byte. */
+	uint16_t start;
+	/** Offset after the last changed byte, or 0 if the data is unchanged. */
+	uint16_t end;
+#if defined(CONFIG_EMDS_CRC_CACHE) || defined(__DOXYGEN__)
+	/** Number of reported changes. Internal, used by EMDS. */
+	uint32_t crc_seq;
+	/** Number of reported changes the cached CRC covers. Internal, used by EMDS. */
+	uint32_t crc_valid_seq;
+	/** Cached CRC of the entry data. Internal, used by EMDS. */
+	uint32_t crc;
+	/** Operator moving a CRC over the entry data. Internal, used by EMDS. */
+	uint32_t crc_shift[32];
+#endif
+};
+
 /**
  * @struct emds_entry
  *
@@ -35,6 +58,13 @@ struct emds_entry {
 	uint8_t *data;
 	/** Length of data that will be stored. */
 	size_t len;
+#if defined(CONFIG_EMDS_INCREMENTAL) || defined(__DOXYGEN__)
+	/** Changed part of the data, or NULL if changes of the entry are not
+	 *  tracked. Entries without tracking are stored in full in every
+	 *  snapshot.
+	 */
+	struct emds_dirty_region *dirty;
+#endif
 };
 
 /**
@@ -66,6 +96,33 @@ struct emds_dynamic_entry {
 		.len = _len,                                                   \
 	}
 
+/**
+ * @brief Define a static entry with tracking of changed data.
+ *
+ * Same as @ref EMDS_STATIC_ENTRY_DEFINE, but only the parts of the data
+ * reported through @ref emds_entry_dirty_mark are stored in delta snapshots.
+ * Without @kconfig{CONFIG_EMDS_INCREMENTAL} this is equal to
+ * @ref EMDS_STATIC_ENTRY_DEFINE.
+ *
+ * @param _name The entry name.
+ * @param _id Unique ID for the entry.
+ * @param _data Data pointer to be stored at emergency data store.
+ * @param _len Length of data to be stored at emergency data store.
+ */
+#if defined(CONFIG_EMDS_INCREMENTAL) || defined(__DOXYGEN__)
+#define EMDS_STATIC_ENTRY_TRACKED_DEFINE(_name, _id, _data, _len)              \
+	static struct emds_dirty_region emds_dirty_##_name;                    \
+	static const STRUCT_SECTION_ITERABLE(emds_entry, emds_##_name) = {     \
+		.id = _id,                                                     \
+		.data = (uint8_t *)_data,                                      \
+		.len = _len,                                                   \
+		.dirty = &emds_dirty_##_name,                                  \
+	}
+#else
+#define EMDS_STATIC_ENTRY_TRACKED_DEFINE(_name, _id, _data, _len)              \
+	EMDS_STATIC_ENTRY_DEFINE(_name, _id, _data, _len)
+#endif
+
 /**
  * @typedef emds_store_cb_t
  * @brief Callback for application commands when storing has been executed.
@@ -110,6 +167,40 @@ int emds_init(emds_store_cb_t cb);
  */
 int emds_entry_add(struct emds_dynamic_entry *entry);
 
+/**
+ * @brief Report a change of the entry data.
+ *
+ * Marks part of the entry data as changed since the last snapshot, so that
+ * it is stored in the next delta snapshot. Changes to the same entry are
+ * merged into one region covering all of them. Has no effect on entries
+ * without tracking, as these are always stored in full.
+ *
+ * Requires @kconfig{CONFIG_EMDS_INCREMENTAL}, otherwise this function does
+ * nothing. It can be called from any context.
+ *
+ * With @kconfig{CONFIG_EMDS_CRC_CACHE}, the cached CRC of the entry is
+ * recalculated in the system workqueue, once for all the changes reported
+ * within @kconfig{CONFIG_EMDS_CRC_CACHE_DELAY_MS}. The function must then be
+ * called after every change of the data, and @ref emds_store must not run
+ * between a change and its report, for example by making both with interrupts
+ * locked.
+ *
+ * @param entry Entry the changed data belongs to.
+ * @param offset Offset of the changed data within the entry.
+ * @param len Length of the changed data.
+ */
+#if defined(CONFIG_EMDS_INCREMENTAL) || defined(__DOXYGEN__)
+void emds_entry_dirty_mark(const struct emds_entry *entry, size_t offset, size_t len);
+#else
+static inline void emds_entry_dirty_mark(const struct emds_entry *entry, size_t offset,
+					 size_t len)
+{
+	ARG_UNUSED(entry);
+	ARG_UNUSED(offset);
+	ARG_UNUSED(len);
+}
+#endif
+
 /**
  * @brief Start the emergency data storage process.
  *
@@ -122,6 +213,10 @@ int emds_entry_add(struct emds_dynamic_entry *entry);
  * trigger data load from the EMDS storage and clear the storage area. The reboot
  * should only be allowed when the main power supply is available.
  *
+ * With @kconfig{CONFIG_EMDS_INCREMENTAL}, the snapshot prepared by
+ * @ref emds_prepare may be a delta snapshot. A delta snapshot only holds the
+ * changed parts of tracked entries and the full data of untracked entries.
+ *
  * This is a time-critical operation and will be processed as fast as possible.
  * To achieve better time predictability, this function must be called from an
  * interrupt context with the highest priority.
@@ -186,6 +281,10 @@ int emds_prepare(void);
  * registered in the entries. This value is dependent on the chip used, and
  * should be checked against the chip datasheet.
  *
+ * If a delta snapshot has been prepared, the estimate only covers the data
+ * changed so far, and grows as more changes are reported through
+ * @ref emds_entry_dirty_mark.
+ *
  * @param store_time_us Pointer to a variable where the estimated time (in microseconds)
  *                      will be stored.
  *
@@ -36,6 +36,21 @@ enum at_parser_cmd_type {
 	AT_PARSER_CMD_TYPE_TEST
 };
 
+/**
+ * @brief AT parser token
+ *
+ * Holds the location and type of one value of an AT command line. Used as storage by an AT parser
+ * initialized with @ref at_parser_init_indexed. The members are internal to the AT parser.
+ */
+struct at_parser_token {
+	/* Pointer to the start of the value in the AT command string. */
+	const char *start;
+	/* Length of the value. */
+	size_t len;
+	/* Type of the value. */
+	uint8_t type;
+};
+
 /**
  * @brief AT parser
  *
@@ -51,6 +66,16 @@ struct at_parser {
 	size_t count;
 	/* Indicates that the next subparameter is empty. */
 	bool is_next_empty;
+	/* Token table of the current AT command line, NULL if the parser is not indexed. */
+	struct at_parser_token *tokens;
+	/* Capacity of the token table. */
+	size_t tokens_size;
+	/* Number of values of the current AT command line stored in the token table. */
+	size_t tokens_count;
+	/* Error that terminated the tokenization of the current AT command line, or zero if the
+	 * token table was filled before the end of the line was reached.
+	 */
+	int tokens_err;
 	/* Sentinel value for determining initialization state. */
 	uint32_t init_sentinel;
 };
@@ -99,6 +124,31 @@ struct at_parser {
  */
 int at_parser_init(struct at_parser *parser, const char *at);
 
+/**
+ * @brief Initialize an indexed AT parser for a given AT command string.
+ *
+ * The current AT command line is tokenized once into @p tokens, and the values are then retrieved
+ * by index in constant time, regardless of the order in which they are accessed. The token table
+ * is rebuilt for the new line when calling @ref at_parser_cmd_next.
+ *
+ * If the AT command line has more values than @p tokens can hold, the values that do not fit are
+ * retrieved by tokenizing the remainder of the line, as with a parser initialized with
+ * @ref at_parser_init.
+ *
+ * @p tokens must remain valid for as long as @p parser is in use.
+ *
+ * @param[in] parser      A pointer to the AT parser.
+ * @param[in] at          A pointer to the AT command string to parse.
+ * @param[in] tokens      A pointer to the token table.
+ * @param[in] tokens_size Number of entries in @p tokens.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL One or more of the supplied parameters are invalid.
+ */
+int at_parser_init_indexed(struct at_parser *parser, const char *at,
+			   struct at_parser_token *tokens, size_t tokens_size);
+
 /**
  * @brief Move the cursor of an AT parser to the next command line of its configured AT command
  *        string.
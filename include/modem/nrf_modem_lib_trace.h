@@ -13,6 +13,8 @@
 extern "C" {
 #endif
 
+struct flash_area;
+
 /**
  * @file nrf_modem_lib_trace.h
  *
@@ -37,6 +39,16 @@ enum nrf_modem_lib_trace_event {
 	NRF_MODEM_LIB_TRACE_EVT_FULL = -ENOSPC,        /**< Trace storage is full. */
 };
 
+/** @brief Contiguous region of trace data in the flash of the trace backend. */
+struct nrf_modem_lib_trace_region {
+	/** Flash area holding the trace data. */
+	const struct flash_area *fa;
+	/** Offset of the trace data in the flash area. */
+	size_t off;
+	/** Length of the trace data. */
+	size_t len;
+};
+
 /** @brief Trace callback that is called by the trace library when an event occour.
  *
  * @note This callback must be defined by the application with some trace backends.
@@ -122,6 +134,31 @@ int nrf_modem_lib_trace_clear(void);
  */
 int nrf_modem_lib_trace_peek_at(size_t offset, uint8_t *buf, size_t len);
 
+/**
+ * @brief Get the flash regions holding trace data from an offset, without consuming it
+ *
+ * Fill @p regions with up to @p count consecutive regions of trace data, starting at @p offset
+ * from the oldest available data, for the caller to read or upload directly from flash. The first
+ * region starts at @p offset. Trace data that has not been written to flash yet is not part of
+ * any region; use @ref nrf_modem_lib_trace_peek_at to get it.
+ *
+ * @note The regions are only valid until the data is erased by reading or clearing the trace
+ *       data, or by the trace backend when the flash is full.
+ *
+ * @param offset Byte offset relative to the oldest available byte
+ * @param regions Output array of regions
+ * @param count Size of the output array
+ *
+ * @return number of regions, negative errno on failure.
+ * @retval -ENOTSUP if the operation is not supported by the trace backend.
+ * @retval -EPERM if the trace backend is not initialized.
+ * @retval -EINVAL if the array is NULL or empty.
+ * @retval -EFAULT if the offset is beyond the available trace data.
+ * @retval -ENODATA if the data at the offset is not in flash yet.
+ */
+int nrf_modem_lib_trace_peek_regions(size_t offset, struct nrf_modem_lib_trace_region *regions,
+				     size_t count);
+
 #if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE) || defined(__DOXYGEN__)
 /** @brief Get the last measured rolling average bitrate of the trace backend.
  *
@@ -8,6 +8,7 @@
 #define TRACE_BACKEND_H__
 
 #include <zephyr/kernel.h>
+#include <modem/nrf_modem_lib_trace.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -25,6 +26,15 @@ extern "C" {
  */
 typedef int (*trace_backend_processed_cb)(size_t len);
 
+/** @brief callback to signal the trace module that a vector write has completed.
+ *
+ * @param result Number of bytes written, or a negative error code if no bytes were written.
+ *               The error codes are the same as for @ref nrf_modem_lib_trace_backend.write.
+ */
+typedef void (*trace_backend_write_vec_done_cb)(int result);
+
+struct nrf_modem_trace_data;
+
 /**
  * @brief The trace backend interface, implemented by the trace backend.
  */
@@ -68,6 +78,28 @@ struct nrf_modem_lib_trace_backend {
 	 */
 	int (*write)(const void *data, size_t len);
 
+	/**
+	 * @brief Start writing a vector of trace data fragments to the compile-time selected trace
+	 *        backend.
+	 *
+	 * The fragments are written in order, as if they were one buffer. The write completes
+	 * asynchronously, and @p done is called, possibly from an interrupt, when the backend is
+	 * done with the fragments. The fragments and the array must be kept until then.
+	 * The backend does not signal the written data with the @c trace_processed_cb callback
+	 * given to @c init, the trace module does that upon completion instead.
+	 *
+	 * @note Set to @c NULL if this operation is not supported by the trace backend.
+	 *
+	 * @param frags Array of trace data fragments.
+	 * @param n_frags Number of fragments in the array.
+	 * @param done Function callback for signaling that the write has completed.
+	 *
+	 * @return 0 If the write was started and @p done will be called.
+	 *         Otherwise, a (negative) error code is returned, as for @c write.
+	 */
+	int (*write_vec)(const struct nrf_modem_trace_data *frags, size_t n_frags,
+			 trace_backend_write_vec_done_cb done);
+
 	/**
 	 * @brief Get the number of bytes stored in the compile-time selected trace backend.
 	 *
@@ -110,6 +142,24 @@ struct nrf_modem_lib_trace_backend {
 	 */
 	int (*peek_at)(size_t offset, void *buf, size_t len);
 
+	/**
+	 * @brief Get the flash regions holding trace data from a byte offset without consuming it.
+	 *
+	 * Fill @p regions with up to @p count consecutive regions of trace data, the first one
+	 * starting at @p offset from the oldest available byte, so that the data can be read
+	 * ahead directly from flash.
+	 *
+	 * @note Set to @c NULL if this operation is not supported by the trace backend.
+	 *
+	 * @param offset Start offset from the oldest available byte.
+	 * @param regions Output array of regions.
+	 * @param count Size of output array.
+	 *
+	 * @return Number of regions on success, negative errno on failure.
+	 */
+	int (*peek_regions)(size_t offset, struct nrf_modem_lib_trace_region *regions,
+			    size_t count);
+
 	/**
 	 * @brief Erase all captured trace data in the compile-time selected trace backend.
 	 *
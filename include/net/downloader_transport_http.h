@@ -24,6 +24,12 @@
 struct downloader_transport_http_cfg {
 	/** Socket receive timeout in milliseconds. The default timeout is 30000 ms. */
 	uint32_t sock_recv_timeo_ms;
+	/** Number of range requests kept in flight on the connection.
+	 *  The responses are received in order and passed on as one stream of fragments.
+	 *  Only used with range requests, see @c downloader_host_cfg.range_override.
+	 *  Zero or one sends the next request only when the previous response is received.
+	 */
+	uint8_t pipeline_depth;
 };
 
 /**
@@ -74,16 +74,55 @@ typedef struct lzma_dictionary_interface_t {
 	const lzma_dictionary_read_func_t read;
 } lzma_dictionary_interface;
 
+/** Size in bytes of the probabilities arena needed by an instance (lc + lp <= 4). */
+#define NRF_COMPRESS_LZMA_PROBS_SIZE (2 * (1984 + (0x300 << 4)))
+
+/** Size in bytes of the dictionary arena needed by an instance. */
+#define NRF_COMPRESS_LZMA_DICT_SIZE (128 * 1024)
+
+/**
+ * Size in bytes of the decoder state held in an instance.
+ *
+ * The state is private to the library, so its size cannot be taken from the decoder types
+ * here. The value must be kept at least the size of the state structure in lzma.c, which
+ * holds the LZMA or LZMA2 decoder and the dictionary cache, on all supported targets.
+ * Update it together with the decoder sources; lzma.c fails to build if it is too small.
+ */
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+#define NRF_COMPRESS_LZMA_STATE_SIZE (384 + CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE)
+#else
+#define NRF_COMPRESS_LZMA_STATE_SIZE 384
+#endif
+
 /**
  * @brief This is an initialization context struct type. Instantionize and pass it to
  * interface functions like for e.g. nrf_compress_init_func_t, nrf_compress_decompress_func_t.
+ *
+ * Every instance holds its own decoder state, so several streams can be decompressed
+ * concurrently, each with its own instance. The instance must be zero-initialized before
+ * the first call to nrf_compress_init_func_t and must not be moved while it is initialized.
  */
 typedef struct lzma_codec_t {
+	/** External dictionary interface, used with CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY. */
 	const lzma_dictionary_interface dict_if;
+	/**
+	 * Arena of @ref NRF_COMPRESS_LZMA_PROBS_SIZE bytes for the probabilities, aligned to
+	 * 4 bytes. If NULL, the static or heap buffer of the library is used, depending on the
+	 * selected memory type. The static buffers can only be used by one instance at a time.
+	 */
+	void *probs;
+	/**
+	 * Arena of @ref NRF_COMPRESS_LZMA_DICT_SIZE bytes for the dictionary, not used with
+	 * CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY. If NULL, the static or heap buffer of the
+	 * library is used, like for @a probs. The decompressed data is returned in this buffer.
+	 */
+	uint8_t *dict;
+	/** Decoder state, private to the library. */
+	uint64_t state[NRF_COMPRESS_LZMA_STATE_SIZE / sizeof(uint64_t)];
 } lzma_codec;
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif /* NRF_COMPRESS_IMPLEMENTATION_H_ */
+#endif /* NRF_COMPRESS_LZMA_TYPES_H_ */
@@ -21,6 +21,12 @@
  * @{
  */
 
+/** Number of fractional bits of the gains given to pcm_mix_weighted(). */
+#define PCM_MIX_GAIN_SHIFT 14
+
+/** Gain that leaves a stream unchanged in pcm_mix_weighted(). */
+#define PCM_MIX_GAIN_UNITY (1 << PCM_MIX_GAIN_SHIFT)
+
 enum pcm_mix_mode {
 	B_STEREO_INTO_A_STEREO,
 	B_MONO_INTO_A_MONO,
@@ -33,6 +39,8 @@ enum pcm_mix_mode {
  * @brief Mixes two buffers of PCM data.
  *
  * @note Uses simple addition with hard clip protection.
+ * Two samples are mixed at a time with the DSP extension if the CPU supports it,
+ * otherwise a C implementation that gives identical results is used.
  * Input can be mono or stereo as long as the inputs match.
  * By selecting the mix mode, mono can also be mixed into a stereo buffer.
  * Hard coded for the signed 16-bit PCM.
@@ -52,6 +60,46 @@ enum pcm_mix_mode {
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode);
 
+/**
+ * @brief Mixes two buffers of signed 32-bit PCM data.
+ *
+ * @note Same as pcm_mix(), but for the signed 32-bit PCM.
+ *
+ * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
+ * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
+ * @param pcm_b         [in]     Pointer to the PCM data buffer B.
+ * @param size_b        [in]     Size of the PCM data buffer B (in bytes).
+ * @param mix_mode      [in]     Mixing mode according to pcm_mix_mode.
+ *
+ * @retval 0            Success. Result stored in pcm_a.
+ * @retval -EINVAL      pcm_a is NULL or size_a = 0.
+ * @retval -EPERM       Either size_b < size_a (for stereo to stereo, mono to mono)
+ *			or size_a/2 < size_b (for mono to stereo mix).
+ * @retval -ESRCH       Invalid mixing mode.
+ */
+int pcm_mix_32(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+	       enum pcm_mix_mode mix_mode);
+
+/**
+ * @brief Mixes several buffers of signed 16-bit PCM data with a gain for each buffer.
+ *
+ * @note Each output sample is the sum of the input samples multiplied by their gains,
+ * rounded and clipped to the signed 16-bit range. The gains are fixed-point values with
+ * PCM_MIX_GAIN_SHIFT fractional bits, so PCM_MIX_GAIN_UNITY leaves a stream unchanged.
+ * All buffers have the same format, and pcm_out may be one of the input buffers.
+ *
+ * @param pcm_out       [out]    Pointer to the output PCM data buffer.
+ * @param size          [in]     Size of the output and each input buffer (in bytes).
+ * @param pcm_in        [in]     Array of pointers to the input PCM data buffers.
+ * @param gains         [in]     Array with the gain of each input buffer.
+ * @param num_streams   [in]     Number of input buffers.
+ *
+ * @retval 0            Success. Result stored in pcm_out.
+ * @retval -EINVAL      A pointer is NULL or num_streams = 0.
+ */
+int pcm_mix_weighted(void *const pcm_out, size_t size, void const *const *const pcm_in,
+		     int16_t const *const gains, size_t num_streams);
+
 /**
  * @}
  */
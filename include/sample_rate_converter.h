@@ -58,6 +58,14 @@ enum sample_rate_converter_filter {
  */
 #define SAMPLE_RATE_CONVERTER_OUTPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES 6
 
+/**
+ * The internal input buffer used during processing must be able to store the overflow samples in
+ * addition to the block size to meet filter requirements.
+ */
+#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_NUMBER_SAMPLES                                    \
+	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX +                                             \
+	 SAMPLE_RATE_CONVERTER_INPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES)
+
 #ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
 #define SAMPLE_RATE_CONVERTER_INPUT_BUF_SIZE                                                       \
 	(SAMPLE_RATE_CONVERTER_INPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES * sizeof(uint16_t))
@@ -65,6 +73,10 @@ enum sample_rate_converter_filter {
 	((CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX +                                            \
 	  SAMPLE_RATE_CONVERTER_OUTPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES) *                           \
 	 sizeof(uint16_t))
+#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
+	(SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint16_t))
+#define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
+	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint16_t))
 #elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
 #define SAMPLE_RATE_CONVERTER_INPUT_BUF_SIZE                                                       \
 	(SAMPLE_RATE_CONVERTER_INPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES * sizeof(uint32_t))
@@ -72,9 +84,15 @@ enum sample_rate_converter_filter {
 	((CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX +                                            \
 	  SAMPLE_RATE_CONVERTER_OUTPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES) *                           \
 	 sizeof(uint32_t))
+#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
+	(SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint32_t))
+#define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
+	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint32_t))
 #else
-#define SAMPLE_RATE_CONVERTER_INPUT_BUF_SIZE 0
-#define SAMPLE_RATE_CONVERTER_RINGBUF_SIZE   0
+#define SAMPLE_RATE_CONVERTER_INPUT_BUF_SIZE	       0
+#define SAMPLE_RATE_CONVERTER_RINGBUF_SIZE	       0
+#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE  0
+#define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE 0
 #endif
 
 /** Buffer used for storing input bytes to the sample rate converter */
@@ -123,7 +141,50 @@ struct sample_rate_converter_ctx {
 #elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
 	q31_t state_buf_31[SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE];
 #endif
+
+	/* Scratch buffers used during a process call. They are kept in the context so that the
+	 * conversion does not use the stack of the calling thread.
+	 */
+	uint8_t internal_input_buf[SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE];
+	uint8_t internal_output_buf[SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE];
+};
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/** Context for the polyphase sample rate conversion */
+struct sample_rate_converter_polyphase_ctx {
+	/* Input and output sample rate to be used for the conversion. */
+	uint32_t sample_rate_input;
+	uint32_t sample_rate_output;
+
+	/* Number of interleaved channels in each frame. */
+	uint8_t channels;
+
+	/* Interpolation and decimation factors, i.e. the output and input sample rates divided
+	 * by their greatest common divisor. The interpolation factor is the number of filter
+	 * phases.
+	 */
+	uint16_t interpolation;
+	uint16_t decimation;
+
+	/* Filter phase of the next output frame. Outputs are produced from the newest input frame
+	 * while the phase is less than the interpolation factor.
+	 */
+	uint32_t phase;
+
+	/* Position of the newest input frame in the history. */
+	uint16_t history_pos;
+
+	/* Filter coefficients in Q15 format, grouped by phase. */
+	int16_t coeffs[CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES_MAX *
+		       CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS];
+
+	/* Interleaved input frames, newest first. Each frame is stored twice so that the last
+	 * frames used by the filter are always contiguous.
+	 */
+	int32_t history[2 * CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS *
+			CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_CHANNELS_MAX];
 };
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
 
 /**
  * @brief	Open the sample rate converter for a new context.
@@ -172,6 +233,53 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  size_t output_size, size_t *output_written,
 				  uint32_t output_sample_rate);
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/**
+ * @brief	Open a polyphase sample rate converter context.
+ *
+ * @details	Calculates the polyphase filter for the conversion and clears the stream history.
+ *		Any ratio between the sample rates is supported, for example 44.1 kHz to 48 kHz,
+ *		as long as the output sample rate divided by the greatest common divisor of the
+ *		two sample rates does not exceed CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES_MAX.
+ *		The context must be opened again if the sample rates or the number of channels
+ *		change.
+ *
+ * @param[out]	ctx			Pointer to the polyphase sample rate conversion context.
+ * @param[in]	sample_rate_input	Sample rate of the input frames.
+ * @param[in]	sample_rate_output	Sample rate of the output frames.
+ * @param[in]	channels		Number of interleaved channels in each frame.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters or unsupported conversion ratio.
+ */
+int sample_rate_converter_polyphase_open(struct sample_rate_converter_polyphase_ctx *ctx,
+					 uint32_t sample_rate_input, uint32_t sample_rate_output,
+					 uint8_t channels);
+
+/**
+ * @brief	Process interleaved input frames and produce output frames with new sample rate.
+ *
+ * @details	All channels of a frame are filtered in the same pass, and no buffers are placed
+ *		on the stack. The number of output frames depends on the conversion ratio and the
+ *		filter phase left by the previous call. For example, 441 frames at 44.1 kHz give
+ *		480 frames at 48 kHz.
+ *
+ * @param[in,out]	ctx		Pointer to the polyphase sample rate conversion context.
+ * @param[in]		input		Pointer to the interleaved frames to process.
+ * @param[in]		input_size	Size of the input in bytes.
+ * @param[out]		output		Array that output frames will be written to.
+ * @param[in]		output_size	Size of the output array in bytes.
+ * @param[out]		output_written	Number of bytes written to output.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters, or the output array is too small.
+ */
+int sample_rate_converter_polyphase_process(struct sample_rate_converter_polyphase_ctx *ctx,
+					    void const *const input, size_t input_size,
+					    void *const output, size_t output_size,
+					    size_t *output_written);
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 /**
  * @}
  */
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 #include <stddef.h>
+#include <errno.h>
 #include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
@@ -15,8 +16,16 @@
 
 LOG_MODULE_REGISTER(at_monitor, CONFIG_AT_MONITOR_LOG_LEVEL);
 
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+#define MATCHED_WORDS DIV_ROUND_UP(CONFIG_AT_MONITOR_MATCHER_MONITORS, 32)
+#endif
+
 struct at_notif_fifo {
 	void *fifo_reserved;
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+	/* Bitmap of the monitors whose filter matches the notification */
+	uint32_t matched[MATCHED_WORDS];
+#endif
 	char data[]; /* Null-terminated AT notification string */
 };
 
@@ -41,19 +50,211 @@ static bool has_match(const struct at_monitor_entry *mon, const char *notif)
 	return (mon->filter == ANY || strstr(notif, mon->filter));
 }
 
-/* Dispatch AT notifications immediately, or schedules a workqueue task to do that.
- * Keep this function public so that it can be called by tests.
- * This function is called from an ISR.
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+
+/* Aho-Corasick automaton built from the filters of all monitors.
+ * Node zero is the root, and is also used as "none" for all node links.
  */
-void at_monitor_dispatch(const char *notif)
+struct matcher_node {
+	/* First child node */
+	uint16_t child;
+	/* Next sibling node */
+	uint16_t sibling;
+	/* Node of the longest proper suffix that is also a filter prefix */
+	uint16_t fail;
+	/* Nearest node in the suffix chain, including this one, where a filter ends */
+	uint16_t out;
+	/* First monitor whose filter ends at this node, plus one */
+	uint16_t mon;
+	/* Depth in the trie */
+	uint8_t depth;
+	/* Character leading to this node */
+	char c;
+};
+
+static struct matcher_node matcher_nodes[CONFIG_AT_MONITOR_MATCHER_NODES];
+static uint16_t matcher_node_count;
+/* Next monitor whose filter ends at the same node, plus one */
+static uint16_t matcher_mon_next[CONFIG_AT_MONITOR_MATCHER_MONITORS];
+/* Monitors with the ANY filter */
+static uint32_t matcher_any[MATCHED_WORDS];
+static bool matcher_ready;
+
+static uint16_t matcher_child(uint16_t node, char c)
 {
-	bool monitored;
-	struct at_notif_fifo *at_notif;
-	size_t sz_needed;
+	for (uint16_t n = matcher_nodes[node].child; n; n = matcher_nodes[n].sibling) {
+		if (matcher_nodes[n].c == c) {
+			return n;
+		}
+	}
 
-	__ASSERT_NO_MSG(notif != NULL);
+	return 0;
+}
+
+static int matcher_insert(const char *filter, uint16_t mon)
+{
+	uint16_t node = 0;
+	uint16_t next;
+
+	for (const char *c = filter; *c; c++) {
+		next = matcher_child(node, *c);
+		if (!next) {
+			if (matcher_node_count == ARRAY_SIZE(matcher_nodes) ||
+			    matcher_nodes[node].depth == UINT8_MAX) {
+				return -ENOMEM;
+			}
+
+			next = matcher_node_count++;
+			matcher_nodes[next] = (struct matcher_node) {
+				.sibling = matcher_nodes[node].child,
+				.depth = matcher_nodes[node].depth + 1,
+				.c = *c,
+			};
+			matcher_nodes[node].child = next;
+		}
+		node = next;
+	}
+
+	matcher_mon_next[mon] = matcher_nodes[node].mon;
+	matcher_nodes[node].mon = mon + 1;
+
+	return 0;
+}
+
+static void matcher_link(void)
+{
+	uint8_t max_depth = 0;
+
+	for (uint16_t n = 1; n < matcher_node_count; n++) {
+		max_depth = MAX(max_depth, matcher_nodes[n].depth);
+	}
+
+	/* Failure links point to shallower nodes, so resolve them one depth at a time. */
+	for (uint8_t depth = 1; depth <= max_depth; depth++) {
+		for (uint16_t p = 0; p < matcher_node_count; p++) {
+			if (matcher_nodes[p].depth != depth - 1) {
+				continue;
+			}
+
+			for (uint16_t n = matcher_nodes[p].child; n; n = matcher_nodes[n].sibling) {
+				uint16_t f = matcher_nodes[p].fail;
+				uint16_t fail = 0;
+
+				if (depth > 1) {
+					while (f && !matcher_child(f, matcher_nodes[n].c)) {
+						f = matcher_nodes[f].fail;
+					}
+					fail = matcher_child(f, matcher_nodes[n].c);
+				}
+
+				matcher_nodes[n].fail = fail;
+				matcher_nodes[n].out = matcher_nodes[n].mon ? n : matcher_nodes[fail].out;
+			}
+		}
+	}
+}
+
+static int matcher_init(void)
+{
+	int err;
+	size_t count;
+	struct at_monitor_entry *e;
+
+	STRUCT_SECTION_COUNT(at_monitor_entry, &count);
+	if (count > CONFIG_AT_MONITOR_MATCHER_MONITORS) {
+		return -E2BIG;
+	}
+
+	matcher_node_count = 1;
+
+	for (size_t i = 0; i < count; i++) {
+		STRUCT_SECTION_GET(at_monitor_entry, i, &e);
+
+		if (e->filter == ANY || e->filter[0] == '\0') {
+			matcher_any[i / 32] |= BIT(i % 32);
+			continue;
+		}
+
+		err = matcher_insert(e->filter, i);
+		if (err) {
+			return err;
+		}
+	}
+
+	matcher_link();
+
+	matcher_ready = true;
+
+	return 0;
+}
+
+/* Set the bits of all monitors whose filter occurs in the notification. */
+static void matcher_run(const char *notif, uint32_t *matched)
+{
+	uint16_t node = 0;
+
+	memcpy(matched, matcher_any, sizeof(matcher_any));
+
+	for (const char *c = notif; *c; c++) {
+		while (node && !matcher_child(node, *c)) {
+			node = matcher_nodes[node].fail;
+		}
+		node = matcher_child(node, *c);
+
+		for (uint16_t out = matcher_nodes[node].out; out;
+		     out = matcher_nodes[matcher_nodes[out].fail].out) {
+			for (uint16_t mon = matcher_nodes[out].mon; mon;
+			     mon = matcher_mon_next[mon - 1]) {
+				matched[(mon - 1) / 32] |= BIT((mon - 1) % 32);
+			}
+		}
+	}
+}
+
+static bool is_matched(const uint32_t *matched, size_t i)
+{
+	return matched[i / 32] & BIT(i % 32);
+}
+
+static bool dispatch_matched(const char *notif, uint32_t *matched)
+{
+	bool monitored = false;
+	size_t count;
+	struct at_monitor_entry *e;
+
+	matcher_run(notif, matched);
+
+	STRUCT_SECTION_COUNT(at_monitor_entry, &count);
+
+	for (size_t i = 0; i < count; i++) {
+		if (!is_matched(matched, i)) {
+			continue;
+		}
+
+		STRUCT_SECTION_GET(at_monitor_entry, i, &e);
+
+		if (is_direct(e)) {
+			/* Direct monitors are not dispatched again in the workqueue. */
+			matched[i / 32] &= ~BIT(i % 32);
+			if (!is_paused(e)) {
+				LOG_DBG("Dispatching to %p (ISR)", e->handler);
+				e->handler(notif);
+			}
+		} else if (!is_paused(e)) {
+			/* Copy and schedule work-queue task */
+			monitored = true;
+		}
+	}
+
+	return monitored;
+}
+
+#endif /* CONFIG_AT_MONITOR_MATCHER */
+
+static bool dispatch_filtered(const char *notif)
+{
+	bool monitored = false;
 
-	monitored = false;
 	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
 		if (!is_paused(e) && has_match(e, notif)) {
 			if (is_direct(e)) {
@@ -66,6 +267,34 @@ void at_monitor_dispatch(const char *notif)
 		}
 	}
 
+	return monitored;
+}
+
+/* Dispatch AT notifications immediately, or schedules a workqueue task to do that.
+ * Keep this function public so that it can be called by tests.
+ * This function is called from an ISR.
+ */
+void at_monitor_dispatch(const char *notif)
+{
+	bool monitored;
+	struct at_notif_fifo *at_notif;
+	size_t sz_needed;
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+	uint32_t matched[MATCHED_WORDS];
+#endif
+
+	__ASSERT_NO_MSG(notif != NULL);
+
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+	if (matcher_ready) {
+		monitored = dispatch_matched(notif, matched);
+	} else {
+		monitored = dispatch_filtered(notif);
+	}
+#else
+	monitored = dispatch_filtered(notif);
+#endif
+
 	if (!monitored) {
 		/* Only copy monitored notifications to save heap */
 		return;
@@ -81,20 +310,42 @@ void at_monitor_dispatch(const char *notif)
 	}
 
 	strcpy(at_notif->data, notif);
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+	if (matcher_ready) {
+		memcpy(at_notif->matched, matched, sizeof(at_notif->matched));
+	}
+#endif
 
 	k_fifo_put(&at_monitor_fifo, at_notif);
 	k_work_submit(&at_monitor_work);
 }
 
+/* Check whether a monitor should receive a notification in the workqueue. */
+static bool has_deferred_match(const struct at_monitor_entry *mon, size_t i,
+			       const struct at_notif_fifo *at_notif)
+{
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+	if (matcher_ready) {
+		return is_matched(at_notif->matched, i);
+	}
+#endif
+	return !is_direct(mon) && has_match(mon, at_notif->data);
+}
+
 static void at_monitor_task(struct k_work *work)
 {
 	struct at_notif_fifo *at_notif;
+	struct at_monitor_entry *e;
+	size_t count;
+
+	STRUCT_SECTION_COUNT(at_monitor_entry, &count);
 
 	while ((at_notif = k_fifo_get(&at_monitor_fifo, K_NO_WAIT))) {
 		/* Match notification with all monitors */
 		LOG_DBG("AT notif: %.*s", strlen(at_notif->data) - strlen("\r\n"), at_notif->data);
-		STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-			if (!is_paused(e) && !is_direct(e) && has_match(e, at_notif->data)) {
+		for (size_t i = 0; i < count; i++) {
+			STRUCT_SECTION_GET(at_monitor_entry, i, &e);
+			if (!is_paused(e) && has_deferred_match(e, i, at_notif)) {
 				LOG_DBG("Dispatching to %p", e->handler);
 				e->handler(at_notif->data);
 			}
@@ -107,6 +358,13 @@ static int at_monitor_sys_init(void)
 {
 	int err;
 
+#if defined(CONFIG_AT_MONITOR_MATCHER)
+	err = matcher_init();
+	if (err) {
+		LOG_WRN("Failed to build the filter matcher, err %d", err);
+	}
+#endif
+
 	err = nrf_modem_at_notif_handler_set(at_monitor_dispatch);
 	if (err) {
 		LOG_ERR("Failed to hook the dispatch function, err %d", err);
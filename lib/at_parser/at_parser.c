@@ -240,6 +240,7 @@ static int at_parser_seek(struct at_parser *parser, size_t index, struct at_toke
 		/* Rewind parser. */
 		parser->cursor = parser->at;
 		parser->count = 0;
+		parser->is_next_empty = false;
 	}
 
 	do {
@@ -249,6 +250,52 @@ static int at_parser_seek(struct at_parser *parser, size_t index, struct at_toke
 	return err;
 }
 
+/* Tokenize the current AT command line into the token table of an indexed AT parser. */
+static void at_parser_index(struct at_parser *parser)
+{
+	int err = 0;
+	struct at_token token = {0};
+
+	parser->tokens_count = 0;
+
+	while (parser->tokens_count < parser->tokens_size) {
+		err = at_parser_tok(parser, &token);
+		if (err) {
+			break;
+		}
+
+		parser->tokens[parser->tokens_count].start = token.start;
+		parser->tokens[parser->tokens_count].len = token.len;
+		parser->tokens[parser->tokens_count].type = token.type;
+		parser->tokens_count++;
+	}
+
+	parser->tokens_err = err;
+}
+
+/* Retrieve the token at the given index, from the token table if the AT parser is indexed. */
+static int at_parser_token_get(struct at_parser *parser, size_t index, struct at_token *token)
+{
+	if (parser->tokens) {
+		if (index < parser->tokens_count) {
+			token->start = parser->tokens[index].start;
+			token->len = parser->tokens[index].len;
+			token->type = parser->tokens[index].type;
+
+			return 0;
+		}
+
+		/* The whole line is in the token table, so the index is out of bounds. */
+		if (parser->tokens_err) {
+			return parser->tokens_err;
+		}
+
+		/* The token table is full, continue tokenizing past its last entry. */
+	}
+
+	return at_parser_seek(parser, index, token);
+}
+
 int at_parser_init(struct at_parser *parser, const char *at)
 {
 	if (!parser || !at) {
@@ -264,6 +311,28 @@ int at_parser_init(struct at_parser *parser, const char *at)
 	return 0;
 }
 
+int at_parser_init_indexed(struct at_parser *parser, const char *at,
+			   struct at_parser_token *tokens, size_t tokens_size)
+{
+	int err;
+
+	if (!tokens || tokens_size == 0) {
+		return -EINVAL;
+	}
+
+	err = at_parser_init(parser, at);
+	if (err) {
+		return err;
+	}
+
+	parser->tokens = tokens;
+	parser->tokens_size = tokens_size;
+
+	at_parser_index(parser);
+
+	return 0;
+}
+
 int at_parser_cmd_next(struct at_parser *parser)
 {
 	int err;
@@ -291,6 +360,10 @@ int at_parser_cmd_next(struct at_parser *parser)
 	 */
 	parser->at = parser->cursor;
 
+	if (parser->tokens) {
+		at_parser_index(parser);
+	}
+
 	return 0;
 }
 
@@ -365,7 +438,7 @@ static int at_parser_num_get_impl(struct at_parser *parser, size_t index, void *
 		return err;
 	}
 
-	err = at_parser_seek(parser, index, &token);
+	err = at_parser_token_get(parser, index, &token);
 	if (err) {
 		return err;
 	}
@@ -484,7 +557,7 @@ static int at_parser_string_common_get_impl(struct at_parser *parser, size_t ind
 		return err;
 	}
 
-	err = at_parser_seek(parser, index, &token);
+	err = at_parser_token_get(parser, index, &token);
 	if (err) {
 		return err;
 	}
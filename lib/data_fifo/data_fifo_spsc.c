@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "data_fifo_spsc.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(data_fifo, CONFIG_DATA_FIFO_LOG_LEVEL);
+
+/* The ring is split by four free running indices, each written by one side only:
+ *
+ *   free_idx <= read_idx <= lock_idx <= alloc_idx <= free_idx + elements_max
+ *
+ * Blocks from free_idx to read_idx are being read by the consumer, from read_idx to lock_idx
+ * they are queued, and from lock_idx to alloc_idx they are being written by the producer.
+ * The Zephyr atomic operations are sequentially consistent, so a block's content and size are
+ * visible to the other side before the index that hands it over.
+ */
+
+static uint32_t idx_get(atomic_t *idx)
+{
+	return (uint32_t)atomic_get(idx);
+}
+
+static void idx_inc(atomic_t *idx)
+{
+	atomic_set(idx, (atomic_val_t)(idx_get(idx) + 1));
+}
+
+static void *block_get(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return data_fifo->slab_buffer + (idx % data_fifo->elements_max) * data_fifo->block_size_max;
+}
+
+static bool producer_ready(struct data_fifo *data_fifo)
+{
+	return (idx_get(&data_fifo->alloc_idx) - idx_get(&data_fifo->free_idx)) <
+	       data_fifo->elements_max;
+}
+
+static bool consumer_ready(struct data_fifo *data_fifo)
+{
+	return idx_get(&data_fifo->lock_idx) != idx_get(&data_fifo->read_idx);
+}
+
+/** @brief Wait until one side of the ring can proceed.
+ *
+ * The waiting flag is set before the ring is checked again, so a wake up from the other side
+ * cannot be lost. A stale wake up only leads to one more check of the ring.
+ */
+static int ring_wait(struct data_fifo *data_fifo, bool (*ready)(struct data_fifo *),
+		     atomic_t *waiting, struct k_sem *wake, k_timeout_t timeout, int no_wait_err)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	while (!ready(data_fifo)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return no_wait_err;
+		}
+
+		atomic_set(waiting, true);
+
+		if (ready(data_fifo)) {
+			break;
+		}
+
+		if (k_sem_take(wake, sys_timepoint_timeout(end))) {
+			return -EAGAIN;
+		}
+	}
+
+	return 0;
+}
+
+static void ring_notify(atomic_t *waiting, struct k_sem *wake)
+{
+	if (atomic_get(waiting) && atomic_clear(waiting)) {
+		k_sem_give(wake);
+	}
+}
+
+int data_fifo_spsc_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
+					    k_timeout_t timeout)
+{
+	int ret;
+
+	ret = ring_wait(data_fifo, producer_ready, &data_fifo->producer_waiting,
+			&data_fifo->producer_wake, timeout, -ENOMEM);
+	if (ret) {
+		return ret;
+	}
+
+	*data = block_get(data_fifo, idx_get(&data_fifo->alloc_idx));
+	idx_inc(&data_fifo->alloc_idx);
+
+	return 0;
+}
+
+int data_fifo_spsc_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
+{
+	uint32_t idx = idx_get(&data_fifo->lock_idx);
+
+	if (idx == idx_get(&data_fifo->alloc_idx) || *data != block_get(data_fifo, idx)) {
+		LOG_ERR("Block %p not locked in allocation order", *data);
+		return -ESPIPE;
+	}
+
+	data_fifo->block_sizes[idx % data_fifo->elements_max] = size;
+	idx_inc(&data_fifo->lock_idx);
+
+	ring_notify(&data_fifo->consumer_waiting, &data_fifo->consumer_wake);
+
+	return 0;
+}
+
+int data_fifo_spsc_pointer_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+					   k_timeout_t timeout)
+{
+	int ret;
+	uint32_t idx;
+
+	ret = ring_wait(data_fifo, consumer_ready, &data_fifo->consumer_waiting,
+			&data_fifo->consumer_wake, timeout, -ENOMSG);
+	if (ret) {
+		return ret;
+	}
+
+	idx = idx_get(&data_fifo->read_idx);
+
+	*data = block_get(data_fifo, idx);
+	*size = data_fifo->block_sizes[idx % data_fifo->elements_max];
+	idx_inc(&data_fifo->read_idx);
+
+	return 0;
+}
+
+int data_fifo_spsc_block_free(struct data_fifo *data_fifo, void *data)
+{
+	uint32_t idx = idx_get(&data_fifo->free_idx);
+
+	if (idx == idx_get(&data_fifo->read_idx) || data != block_get(data_fifo, idx)) {
+		LOG_ERR("Block %p not freed in read order", data);
+		return -EINVAL;
+	}
+
+	idx_inc(&data_fifo->free_idx);
+
+	ring_notify(&data_fifo->producer_waiting, &data_fifo->producer_wake);
+
+	return 0;
+}
+
+void data_fifo_spsc_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num,
+				 uint32_t *locked_num)
+{
+	uint32_t free_idx = idx_get(&data_fifo->free_idx);
+	uint32_t read_idx = idx_get(&data_fifo->read_idx);
+	uint32_t lock_idx = idx_get(&data_fifo->lock_idx);
+	uint32_t alloc_idx = idx_get(&data_fifo->alloc_idx);
+
+	*alloced_num = alloc_idx - free_idx;
+	*locked_num = lock_idx - read_idx;
+}
+
+void data_fifo_spsc_reset(struct data_fifo *data_fifo)
+{
+	atomic_clear(&data_fifo->alloc_idx);
+	atomic_clear(&data_fifo->lock_idx);
+	atomic_clear(&data_fifo->read_idx);
+	atomic_clear(&data_fifo->free_idx);
+	atomic_clear(&data_fifo->producer_waiting);
+	atomic_clear(&data_fifo->consumer_waiting);
+
+	k_sem_init(&data_fifo->producer_wake, 0, 1);
+	k_sem_init(&data_fifo->consumer_wake, 0, 1);
+}
@@ -7,6 +7,8 @@
 #include <sys/types.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/ring_buffer.h>
 #include <modem/nrf_modem_lib.h>
 #include <modem/nrf_modem_lib_trace.h>
 #include <modem/trace_backend.h>
@@ -38,6 +40,39 @@ static void backend_suspend_handle(struct k_work *item);
 K_WORK_DELAYABLE_DEFINE(backend_suspend_work, backend_suspend_handle);
 #define BACKEND_SUSPEND_DELAY K_MSEC(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_SUSPEND_DELAY_MS)
 
+/* Completion of vector writes to the backend */
+static K_SEM_DEFINE(vec_write_sem, 0, 1);
+static int vec_write_result;
+
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+/* Trace data copied from the modem and not yet written to the backend. */
+RING_BUF_DECLARE(staging_ring, CONFIG_NRF_MODEM_LIB_TRACE_STAGING_BUF_SIZE);
+static struct k_spinlock staging_lock;
+/* Number of bytes in the staging buffer, counted before they are visible to the staging thread. */
+static atomic_t staged;
+/* Irrecoverable backend error, the staged data is dropped until the trace is deinitialized. */
+static int staging_err;
+static K_SEM_DEFINE(staging_data_sem, 0, 1);
+static K_SEM_DEFINE(staging_space_sem, 0, 1);
+static K_SEM_DEFINE(staging_drained_sem, 0, 1);
+/* Raised on deinitialization, to stop the staging thread from waiting for the backend. */
+static struct k_poll_signal staging_stop_sig = K_POLL_SIGNAL_INITIALIZER(staging_stop_sig);
+
+/* Staged trace data is released to the modem when it is copied, and the backend writes it from
+ * the staging buffer, which is released when the write returns.
+ */
+static int staging_processed(size_t len)
+{
+	ARG_UNUSED(len);
+
+	return 0;
+}
+
+#define TRACE_PROCESSED_CB staging_processed
+#else
+#define TRACE_PROCESSED_CB nrf_modem_trace_processed
+#endif
+
 static void backend_suspend(void)
 {
 	int err;
@@ -73,6 +108,14 @@ static void backend_resume(void)
 
 static void backend_suspend_handle(struct k_work *item)
 {
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+	if (atomic_get(&staged)) {
+		/* The backend is still writing staged trace data. */
+		k_work_schedule(&backend_suspend_work, BACKEND_SUSPEND_DELAY);
+		return;
+	}
+#endif
+
 	backend_suspend();
 }
 
@@ -232,6 +275,16 @@ int nrf_modem_lib_trace_processing_done_wait(k_timeout_t timeout)
 	return 0;
 }
 
+static void trace_write_error_log(int err)
+{
+	if ((err == -ENOSPC) || (err == -ENOSR)) {
+		LOG_DBG("trace_backend.write returned with %d", err);
+		LOG_DBG("Please make sure that the backend is properly connected.");
+	} else {
+		LOG_ERR("trace_backend.write failed with err: %d", err);
+	}
+}
+
 static int trace_fragment_write(struct nrf_modem_trace_data *frag)
 {
 	int ret;
@@ -261,12 +314,7 @@ static int trace_fragment_write(struct nrf_modem_trace_data *frag)
 		}
 
 		if (ret < 0) {
-			if ((ret == -ENOSPC) || (ret == -ENOSR)) {
-				LOG_DBG("trace_backend.write returned with %d", ret);
-				LOG_DBG("Please make sure that the backend is properly connected.");
-			} else {
-				LOG_ERR("trace_backend.write failed with err: %d", ret);
-			}
+			trace_write_error_log(ret);
 
 			return ret;
 		}
@@ -279,6 +327,311 @@ static int trace_fragment_write(struct nrf_modem_trace_data *frag)
 	return 0;
 }
 
+static void vec_write_done(int result)
+{
+	vec_write_result = result;
+	k_sem_give(&vec_write_sem);
+}
+
+/* Write a vector of trace fragments with a single backend operation and wait for it to complete.
+ * Returns the number of bytes written, or a negative error code.
+ */
+static int trace_vec_write(const struct nrf_modem_trace_data *frags, size_t n_frags)
+{
+	int ret;
+
+	do {
+		PERF_START();
+
+		ret = trace_backend.write_vec(frags, n_frags, vec_write_done);
+		if (ret == 0) {
+			k_sem_take(&vec_write_sem, K_FOREVER);
+			ret = vec_write_result;
+		}
+
+		PERF_END(ret);
+
+		__ASSERT(ret != 0, "Trace backend wrote 0 bytes");
+
+		/* As for trace_fragment_write(), no retry if the modem is shut down. */
+		if ((ret == -EAGAIN) && !nrf_modem_is_initialized()) {
+			return -ESHUTDOWN;
+		}
+	} while (ret == -EAGAIN);
+
+	if (ret < 0) {
+		trace_write_error_log(ret);
+	}
+
+	return ret;
+}
+
+/* Wait for the backend to recover from an error.
+ * The staging thread stops waiting when the trace is deinitialized, and returns -ESHUTDOWN.
+ */
+static int trace_recovery_wait(struct k_sem *sem)
+{
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+	struct k_poll_event events[] = {
+		K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SEM_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY, sem),
+		K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+					 &staging_stop_sig),
+	};
+
+	while (true) {
+		(void)k_poll(events, ARRAY_SIZE(events), K_FOREVER);
+
+		if (events[1].state == K_POLL_STATE_SIGNALED) {
+			return -ESHUTDOWN;
+		}
+
+		/* Another thread can take the semaphore first */
+		if (k_sem_take(sem, K_NO_WAIT) == 0) {
+			return 0;
+		}
+
+		events[0].state = K_POLL_STATE_NOT_READY;
+	}
+#else
+	return k_sem_take(sem, K_FOREVER);
+#endif
+}
+
+/* Handle an error from writing to the backend.
+ * Returns 0 if the write should be retried, or the error if it is irrecoverable.
+ */
+static int trace_write_error_handle(int err)
+{
+	switch (err) {
+	case -ENOSPC:
+		nrf_modem_lib_trace_callback(NRF_MODEM_LIB_TRACE_EVT_FULL);
+		if (!trace_backend.clear) {
+			return err;
+		}
+
+		has_space = false;
+		k_sem_give(&trace_done_sem);
+		return trace_recovery_wait(&trace_clear_sem);
+
+	case -ENOSR:
+		if (k_sem_take(&modem_trace_level_sem, K_NO_WAIT) != 0) {
+			/** If modem trace level is off, we wait for modem
+			 *  trace level semaphore, indicating modem traces
+			 *  are enabled. This is always available unless
+			 *  nrf_modem_lib_trace_level_set() is called with
+			 *  level 0 (off).
+			 */
+			k_sem_give(&trace_done_sem);
+			if (trace_recovery_wait(&modem_trace_level_sem)) {
+				/* The trace is deinitialized, which gives trace_done_sem */
+				return -ESHUTDOWN;
+			}
+			k_sem_take(&trace_done_sem, K_FOREVER);
+		}
+
+		k_sem_give(&modem_trace_level_sem);
+		return 0;
+
+	default:
+		/* Irrecoverable error */
+		return err;
+	}
+}
+
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+/* Copy the trace fragments to the staging buffer, releasing them to the modem as they are copied.
+ * Waits for space when the staging buffer is full.
+ */
+static int trace_frags_stage(const struct nrf_modem_trace_data *frags, size_t n_frags)
+{
+	k_spinlock_key_t key;
+	const uint8_t *data;
+	size_t left;
+	uint8_t *dst;
+	uint32_t len;
+
+	for (size_t i = 0; i < n_frags; i++) {
+		data = frags[i].data;
+		left = frags[i].len;
+
+		while (left) {
+			if (staging_err) {
+				return staging_err;
+			}
+
+			key = k_spin_lock(&staging_lock);
+			len = ring_buf_put_claim(&staging_ring, &dst, left);
+			k_spin_unlock(&staging_lock, key);
+
+			if (len == 0) {
+				k_sem_take(&staging_space_sem, K_FOREVER);
+				continue;
+			}
+
+			memcpy(dst, data, len);
+
+			atomic_add(&staged, len);
+
+			key = k_spin_lock(&staging_lock);
+			(void)ring_buf_put_finish(&staging_ring, len);
+			k_spin_unlock(&staging_lock, key);
+
+			k_sem_give(&staging_data_sem);
+
+			nrf_modem_trace_processed(len);
+
+			data += len;
+			left -= len;
+		}
+	}
+
+	return 0;
+}
+
+/* Release written or dropped bytes from the staging buffer. */
+static void staging_release(size_t len)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&staging_lock);
+	(void)ring_buf_get_finish(&staging_ring, len);
+	k_spin_unlock(&staging_lock, key);
+
+	atomic_sub(&staged, len);
+	k_sem_give(&staging_space_sem);
+}
+
+/* Write staged trace data to the backend, in one vector write if supported.
+ * Returns the number of bytes written, 0 if there is no staged data yet, or a negative error code.
+ */
+static int staging_write(void)
+{
+	/* The staged data wraps around the end of the buffer at most once. */
+	struct nrf_modem_trace_data frags[2];
+	size_t n_frags = 0;
+	k_spinlock_key_t key;
+	uint8_t *data;
+	uint32_t len;
+	size_t frag_len;
+	int written = 0;
+	int err = 0;
+
+	key = k_spin_lock(&staging_lock);
+	while (n_frags < ARRAY_SIZE(frags)) {
+		len = ring_buf_get_claim(&staging_ring, &data, UINT32_MAX);
+		if (len == 0) {
+			break;
+		}
+
+		frags[n_frags].data = data;
+		frags[n_frags].len = len;
+		n_frags++;
+	}
+	k_spin_unlock(&staging_lock, key);
+
+	if (n_frags == 0) {
+		return 0;
+	}
+
+	if (staging_err) {
+		/* Drop the data */
+		for (size_t i = 0; i < n_frags; i++) {
+			written += frags[i].len;
+		}
+	} else if (trace_backend.write_vec) {
+		written = trace_vec_write(frags, n_frags);
+	} else {
+		for (size_t i = 0; i < n_frags; i++) {
+			frag_len = frags[i].len;
+			err = trace_fragment_write(&frags[i]);
+			written += frag_len - frags[i].len;
+			if (err) {
+				break;
+			}
+		}
+
+		/* Report the error when it is hit again, if some data was written. */
+		written = written ? written : err;
+	}
+
+	staging_release(MAX(written, 0));
+
+	return written;
+}
+
+static void trace_staging_thread_handler(void)
+{
+	int err;
+
+	while (true) {
+		k_sem_take(&staging_data_sem, K_FOREVER);
+
+		while (atomic_get(&staged)) {
+			err = staging_write();
+			if (err == 0) {
+				/* The trace thread has yet to finish staging data. */
+				break;
+			}
+
+			if ((err < 0) && trace_write_error_handle(err)) {
+				/* Drop what is staged, the trace thread deinitializes the backend. */
+				staging_err = err;
+			}
+		}
+
+		k_sem_give(&staging_drained_sem);
+	}
+}
+
+/* Wait for the staged data to be written. If the staging thread is waiting for the backend to
+ * recover from an error, it is woken up and the staged data is dropped.
+ */
+static void staging_drain_wait(void)
+{
+	k_poll_signal_raise(&staging_stop_sig, 0);
+
+	while (atomic_get(&staged)) {
+		k_sem_take(&staging_drained_sem, K_FOREVER);
+	}
+
+	k_poll_signal_reset(&staging_stop_sig);
+	staging_err = 0;
+}
+#else
+/* Remove written bytes from the start of a vector of trace fragments. */
+static void trace_frags_advance(struct nrf_modem_trace_data **frags, size_t *n_frags, size_t len)
+{
+	while (*n_frags && (len >= (*frags)->len)) {
+		len -= (*frags)->len;
+		(*frags)++;
+		(*n_frags)--;
+	}
+
+	if (*n_frags) {
+		(*frags)->data = (void *)((uint8_t *)(*frags)->data + len);
+		(*frags)->len -= len;
+	}
+}
+
+/* Write the trace fragments from the modem in place, with vector writes. */
+static int trace_frags_write_vec(struct nrf_modem_trace_data **frags, size_t *n_frags)
+{
+	int ret;
+
+	while (*n_frags) {
+		ret = trace_vec_write(*frags, *n_frags);
+		if (ret < 0) {
+			return ret;
+		}
+
+		nrf_modem_trace_processed(ret);
+		trace_frags_advance(frags, n_frags, ret);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_STAGING */
+
 void trace_thread_handler(void)
 {
 	int err;
@@ -330,47 +683,34 @@ trace_reset:
 			backend_resume();
 		}
 
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+		err = trace_frags_stage(frags, n_frags);
+		if (err) {
+			goto deinit;
+		}
+#else
+		if (trace_backend.write_vec) {
+			do {
+				err = trace_frags_write_vec(&frags, &n_frags);
+			} while (err && !trace_write_error_handle(err));
+
+			if (err) {
+				goto deinit;
+			}
+
+			continue;
+		}
+
 		for (int i = 0; i < n_frags; i++) {
-retry:
-			err = trace_fragment_write(&frags[i]);
-			switch (err) {
-			case 0:
-				break;
-			case -ENOSPC:
-				nrf_modem_lib_trace_callback(NRF_MODEM_LIB_TRACE_EVT_FULL);
-				if (!trace_backend.clear) {
-					goto deinit;
-				}
-
-				has_space = false;
-				k_sem_give(&trace_done_sem);
-				k_sem_take(&trace_clear_sem, K_FOREVER);
-				/* Try the same fragment again */
-				goto retry;
-
-			case -ENOSR:
-				if (k_sem_take(&modem_trace_level_sem, K_NO_WAIT) != 0) {
-					/** If modem trace level is off, we wait for modem
-					 *  trace level semaphore, indicating modem traces
-					 *  are enabled. This is always available unless
-					 *  nrf_modem_lib_trace_level_set() is called with
-					 *  level 0 (off).
-					 */
-					k_sem_give(&trace_done_sem);
-					k_sem_take(&modem_trace_level_sem, K_FOREVER);
-					k_sem_take(&trace_done_sem, K_FOREVER);
-				}
-
-				k_sem_give(&modem_trace_level_sem);
-
-				/* Try the same fragment again */
-				goto retry;
-
-			default:
-				/* Irrecoverable error */
+			do {
+				err = trace_fragment_write(&frags[i]);
+			} while (err && !trace_write_error_handle(err));
+
+			if (err) {
 				goto deinit;
 			}
 		}
+#endif
 	}
 
 deinit:
@@ -393,7 +733,7 @@ static int trace_init(void)
 
 	k_sem_take(&trace_done_sem, K_FOREVER);
 
-	err = trace_backend.init(nrf_modem_trace_processed);
+	err = trace_backend.init(TRACE_PROCESSED_CB);
 	if (err) {
 		LOG_ERR("trace_backend: init failed with err: %d", err);
 		return err;
@@ -442,6 +782,10 @@ static int trace_deinit(void)
 {
 	int err;
 
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+	staging_drain_wait();
+#endif
+
 	err = trace_backend.deinit();
 	if (err) {
 		LOG_ERR("trace_backend: deinit failed with err: %d", err);
@@ -532,6 +876,16 @@ int nrf_modem_lib_trace_peek_at(size_t offset, uint8_t *buf, size_t len)
 	return trace_backend.peek_at(offset, buf, len);
 }
 
+int nrf_modem_lib_trace_peek_regions(size_t offset, struct nrf_modem_lib_trace_region *regions,
+				     size_t count)
+{
+	if (!trace_backend.peek_regions) {
+		return -ENOTSUP;
+	}
+
+	return trace_backend.peek_regions(offset, regions, count);
+}
+
 int nrf_modem_lib_trace_clear(void)
 {
 	int err;
@@ -556,3 +910,8 @@ int nrf_modem_lib_trace_clear(void)
 
 K_THREAD_DEFINE(trace_thread, CONFIG_NRF_MODEM_LIB_TRACE_STACK_SIZE, trace_thread_handler,
 	       NULL, NULL, NULL, TRACE_THREAD_PRIORITY, 0, 0);
+
+#if CONFIG_NRF_MODEM_LIB_TRACE_STAGING
+K_THREAD_DEFINE(trace_staging_thread, CONFIG_NRF_MODEM_LIB_TRACE_STACK_SIZE,
+		trace_staging_thread_handler, NULL, NULL, NULL, TRACE_THREAD_PRIORITY, 0, 0);
+#endif
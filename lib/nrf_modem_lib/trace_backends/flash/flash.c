@@ -62,12 +62,31 @@ struct peek_at_cache {
 	size_t in_entry_offset;
 };
 
+/* Sparse index of the trace data in flash, with the offset of the first byte of each FCB sector
+ * in use, oldest first. Offsets count all bytes appended since the index was reset, so that they
+ * stay valid as sectors are rotated out. They are only compared relative to the oldest byte, which
+ * makes them safe to wrap around.
+ */
+struct sector_index {
+	struct {
+		struct flash_sector *sector;
+		size_t base;
+	} recs[CONFIG_NRF_MODEM_LIB_TRACE_FLASH_SECTORS];
+	size_t first;
+	size_t count;
+	/* Offset of the oldest byte in flash */
+	size_t head;
+	/* Offset past the newest byte in flash */
+	size_t tail;
+};
+
 /* Store in __noinit RAM to perserve in warm boot. */
 static __noinit struct flash_backend_state backend_state;
 
 static bool is_initialized;
 static struct k_sem fcb_sem;
 static struct peek_at_cache peek_at_cache;
+static struct sector_index sector_index;
 
 static inline void peek_at_cache_set(size_t offset, struct fcb_entry *entry, size_t in_entry_offset)
 {
@@ -91,6 +110,99 @@ static inline bool peek_at_cache_is_valid(void)
 	return magic_valid && entry_valid;
 }
 
+static inline size_t sector_index_pos(size_t i)
+{
+	return (sector_index.first + i) % ARRAY_SIZE(sector_index.recs);
+}
+
+static void sector_index_reset(void)
+{
+	memset(&sector_index, 0, sizeof(sector_index));
+}
+
+/* Add an entry appended to the FCB. */
+static void sector_index_append(const struct fcb_entry *entry)
+{
+	size_t last = sector_index_pos(sector_index.count - 1);
+
+	if (!sector_index.count || (sector_index.recs[last].sector != entry->fe_sector)) {
+		__ASSERT_NO_MSG(sector_index.count < ARRAY_SIZE(sector_index.recs));
+
+		last = sector_index_pos(sector_index.count);
+		sector_index.recs[last].sector = entry->fe_sector;
+		sector_index.recs[last].base = sector_index.tail;
+		sector_index.count++;
+	}
+
+	sector_index.tail += entry->fe_data_len;
+}
+
+/* Drop the oldest sector, after it is erased by fcb_rotate(). */
+static void sector_index_rotate(void)
+{
+	if (!sector_index.count) {
+		return;
+	}
+
+	sector_index.count--;
+	sector_index.first = sector_index_pos(1);
+	sector_index.head = sector_index.count ?
+		sector_index.recs[sector_index.first].base : sector_index.tail;
+}
+
+/* Rebuild the index from the entries in flash, after a warm boot. */
+static void sector_index_rebuild(void)
+{
+	struct fcb_entry entry = { 0 };
+
+	sector_index_reset();
+
+	while (fcb_getnext(&trace_fcb, &entry) == 0) {
+		sector_index_append(&entry);
+	}
+}
+
+/* Find the first FCB entry of the sector holding the byte at offset from the oldest byte in
+ * flash, with a binary search of the index. On success, skip is the offset of the byte from the
+ * start of that entry. If the byte is not in flash, -ENOTSUP is returned like fcb_getnext() does,
+ * and skip is the offset of the byte in the RAM buffer.
+ * FCB sem has to be taken before calling this function!
+ */
+static int sector_index_find(size_t offset, struct fcb_entry *entry, size_t *skip)
+{
+	size_t lo = 0;
+	size_t hi = sector_index.count;
+	size_t mid;
+	size_t pos;
+
+	if (offset >= sector_index.tail - sector_index.head) {
+		*skip = offset - (sector_index.tail - sector_index.head);
+
+		return -ENOTSUP;
+	}
+
+	/* Last sector starting at or before the offset */
+	while (hi - lo > 1) {
+		mid = lo + (hi - lo) / 2;
+		pos = sector_index_pos(mid);
+
+		if (sector_index.recs[pos].base - sector_index.head <= offset) {
+			lo = mid;
+		} else {
+			hi = mid;
+		}
+	}
+
+	pos = sector_index_pos(lo);
+	*skip = offset - (sector_index.recs[pos].base - sector_index.head);
+
+	/* Served the first entry of the sector by fcb_getnext() */
+	entry->fe_sector = sector_index.recs[pos].sector;
+	entry->fe_elem_off = 0;
+
+	return fcb_getnext(&trace_fcb, entry);
+}
+
 static size_t buffer_append(const void *data, size_t len)
 {
 	size_t append_len;
@@ -156,6 +268,8 @@ static int buffer_flush_to_flash(void)
 				goto out;
 			}
 
+			sector_index_rotate();
+
 			err = fcb_append(&trace_fcb, backend_state.flash_buf_written, &loc_flush);
 
 			peek_at_cache_invalidate();
@@ -186,6 +300,8 @@ static int buffer_flush_to_flash(void)
 		goto out;
 	}
 
+	sector_index_append(&loc_flush);
+
 	backend_state.flash_buf_written = 0;
 
 out:
@@ -281,6 +397,8 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 		return err;
 	}
 
+	sector_index_rebuild();
+
 	is_initialized = true;
 
 	LOG_DBG("Modem trace flash storage initialized\n");
@@ -394,6 +512,7 @@ out:
 			return ret;
 		}
 
+		sector_index_rotate();
 		peek_at_cache_invalidate();
 		k_sem_give(&trace_clear_sem);
 	}
@@ -434,22 +553,19 @@ int trace_backend_peek_at(size_t offset, void *buf, size_t len)
 		return -EFAULT;
 	}
 
-	/* Initialize iterator from cache if possible, else from the oldest. */
-	if (peek_at_cache_is_valid() && (read_offset >= peek_at_cache.offset)) {
+	/* Find the sector holding the offset in the index, and start from the cached entry instead
+	 * if it is closer.
+	 */
+	err = sector_index_find(read_offset, &entry, &skip);
+
+	if (peek_at_cache_is_valid() && (read_offset >= peek_at_cache.offset) &&
+	    (err == 0) && (entry.fe_sector == peek_at_cache.entry.fe_sector)) {
 		/* Start from cached entry and skip only the offset delta. */
 		memcpy(&entry, &peek_at_cache.entry, sizeof(entry));
-		err = 0;
 
 		skip = (read_offset - peek_at_cache.offset) + peek_at_cache.in_entry_offset;
-	} else {
-		if (peek_at_cache_is_valid() && (read_offset < peek_at_cache.offset)) {
-			peek_at_cache_invalidate();
-		}
-
-		entry.fe_sector = NULL;
-		entry.fe_elem_off = 0;
-		skip = read_offset;
-		err = fcb_getnext(&trace_fcb, &entry);
+	} else if (peek_at_cache_is_valid() && (read_offset < peek_at_cache.offset)) {
+		peek_at_cache_invalidate();
 	}
 
 	while (err == 0) {
@@ -531,6 +647,60 @@ int trace_backend_peek_at(size_t offset, void *buf, size_t len)
 	return (int)copied;
 }
 
+int trace_backend_peek_regions(size_t offset, struct nrf_modem_lib_trace_region *regions,
+			       size_t count)
+{
+	int err;
+	size_t filled = 0;
+	struct fcb_entry entry;
+	size_t skip;
+
+	if (!is_initialized) {
+		return -EPERM;
+	}
+
+	if (regions == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	(void)k_sem_take(&fcb_sem, K_FOREVER);
+
+	if (offset >= backend_state.trace_bytes_unread) {
+		k_sem_give(&fcb_sem);
+
+		return -EFAULT;
+	}
+
+	err = sector_index_find(offset, &entry, &skip);
+
+	while (err == 0) {
+		if (skip < entry.fe_data_len) {
+			/* Entries are not contiguous in flash due to the FCB element headers. */
+			regions[filled].fa = trace_fcb.fap;
+			regions[filled].off = FCB_ENTRY_FA_DATA_OFF(entry) + skip;
+			regions[filled].len = entry.fe_data_len - skip;
+
+			skip = 0;
+
+			if (++filled == count) {
+				break;
+			}
+		} else {
+			skip -= entry.fe_data_len;
+		}
+
+		err = fcb_getnext(&trace_fcb, &entry);
+	}
+
+	k_sem_give(&fcb_sem);
+
+	if (filled == 0) {
+		return (err == -ENOTSUP) ? -ENODATA : err;
+	}
+
+	return (int)filled;
+}
+
 static int stream_write(const void *buf, size_t len)
 {
 	int ret;
@@ -616,6 +786,7 @@ int trace_backend_clear(void)
 
 	/* Storage rotated, invalidate cached peek_at iterator. */
 	peek_at_cache_invalidate();
+	sector_index_reset();
 
 	k_sem_give(&fcb_sem);
 
@@ -639,5 +810,6 @@ struct nrf_modem_lib_trace_backend trace_backend = {
 	.data_size = trace_backend_data_size,
 	.read = trace_backend_read,
 	.peek_at = trace_backend_peek_at,
+	.peek_regions = trace_backend_peek_regions,
 	.clear = trace_backend_clear,
 };
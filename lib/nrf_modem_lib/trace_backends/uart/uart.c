@@ -9,6 +9,7 @@
 #include <zephyr/logging/log.h>
 #include <modem/trace_backend.h>
 #include <zephyr/pm/device.h>
+#include <nrf_modem_trace.h>
 
 LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 
@@ -34,6 +35,68 @@ static trace_backend_processed_cb trace_processed_callback;
 
 static bool suspended;
 
+/* Vector write in progress, driven from the UART callback. */
+static struct {
+	const struct nrf_modem_trace_data *frags;
+	size_t n_frags;
+	/* Current fragment and offset in it */
+	size_t idx;
+	size_t off;
+	size_t written;
+	int retries;
+	trace_backend_write_vec_done_cb done;
+} vec;
+
+/* Send the next chunk of the vector write, or complete it. */
+static void vec_tx_next(void)
+{
+	trace_backend_write_vec_done_cb done;
+	const uint8_t *data;
+	size_t transfer_len;
+	int err = 0;
+
+	while ((vec.idx < vec.n_frags) && (vec.off == vec.frags[vec.idx].len)) {
+		vec.idx++;
+		vec.off = 0;
+	}
+
+	if ((vec.idx < vec.n_frags) && (vec.retries < UART_TX_RETRIES)) {
+		/* Split fragment into smaller DMA-able chunks */
+		data = (const uint8_t *)vec.frags[vec.idx].data + vec.off;
+		transfer_len = MIN(vec.frags[vec.idx].len - vec.off, CHUNK_SZ);
+
+		err = uart_tx(uart_dev, data, transfer_len, UART_TX_WAIT_TIME_MS * USEC_PER_MSEC);
+		if (!err) {
+			return;
+		}
+
+		LOG_ERR("UART TX failed, err %d", err);
+	}
+
+	done = vec.done;
+	vec.done = NULL;
+	k_sem_give(&tx_sem);
+
+	if (vec.written) {
+		done(vec.written);
+	} else {
+		done(err ? err : -EAGAIN);
+	}
+}
+
+static void vec_tx_done(size_t len)
+{
+	if (len) {
+		vec.off += len;
+		vec.written += len;
+		vec.retries = 0;
+	} else {
+		vec.retries++;
+	}
+
+	vec_tx_next();
+}
+
 static void uart_callback(const struct device *dev, struct uart_event *evt, void *user_data)
 {
 	ARG_UNUSED(dev);
@@ -42,6 +105,11 @@ static void uart_callback(const struct device *dev, struct uart_event *evt, void
 	switch (evt->type) {
 	case UART_TX_DONE:
 	case UART_TX_ABORTED:
+		if (vec.done) {
+			vec_tx_done(evt->data.tx.len);
+			break;
+		}
+
 		tx_bytes = evt->data.tx.len;
 		k_sem_give(&tx_done_sem);
 		break;
@@ -176,6 +244,32 @@ out:
 	return ret;
 }
 
+int trace_backend_write_vec(const struct nrf_modem_trace_data *frags, size_t n_frags,
+			    trace_backend_write_vec_done_cb done)
+{
+	if (suspended) {
+		return -EPERM;
+	}
+
+	if (!frags || !n_frags || !done) {
+		return -EINVAL;
+	}
+
+	k_sem_take(&tx_sem, K_FOREVER);
+
+	vec.frags = frags;
+	vec.n_frags = n_frags;
+	vec.idx = 0;
+	vec.off = 0;
+	vec.written = 0;
+	vec.retries = 0;
+	vec.done = done;
+
+	vec_tx_next();
+
+	return 0;
+}
+
 int trace_backend_suspend(void)
 {
 #if CONFIG_PM_DEVICE
@@ -213,6 +307,7 @@ struct nrf_modem_lib_trace_backend trace_backend = {
 	.init = trace_backend_init,
 	.deinit = trace_backend_deinit,
 	.write = trace_backend_write,
+	.write_vec = trace_backend_write_vec,
 	.suspend = trace_backend_suspend,
 	.resume = trace_backend_resume
 };
@@ -6,90 +6,157 @@
 
 #include <pcm_mix.h>
 
+#include <string.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <cmsis_core.h>
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
 
-/* Clip signal if amplitude is outside legal range */
-static void hard_limiter(int32_t *const pcm)
+/* The helpers below use the DSP extension when available. The C versions give the same results,
+ * so that the mixer behaves identically on all targets.
+ */
+
+/* Read two 16-bit samples, the buffers need not be word aligned */
+static inline uint32_t read_x2(void const *const pcm)
 {
-	if (*pcm < INT16_MIN) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MIN;
-	} else if (*pcm > INT16_MAX) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MAX;
-	}
+	uint32_t val;
+
+	memcpy(&val, pcm, sizeof(val));
+
+	return val;
 }
 
-/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
-static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
-			      size_t size_b)
+/* Write two 16-bit samples, the buffers need not be word aligned */
+static inline void write_x2(void *const pcm, uint32_t val)
 {
-	int32_t res;
+	memcpy(pcm, &val, sizeof(val));
+}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
+/* Pack two 16-bit samples, the first one in the lower half */
+static inline uint32_t pack_x2(int16_t lo, int16_t hi)
+{
+	return (uint16_t)lo | ((uint32_t)(uint16_t)hi << 16);
+}
 
-		hard_limiter(&res);
+/* Clip signal if amplitude is outside legal range */
+static inline int16_t sat16(int32_t val)
+{
+	return (int16_t)CLAMP(val, INT16_MIN, INT16_MAX);
+}
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
-	}
+/* Saturating addition of two pairs of 16-bit samples */
+static inline uint32_t qadd16(uint32_t a, uint32_t b)
+{
+#if defined(__ARM_FEATURE_DSP)
+	return __QADD16(a, b);
+#else
+	return pack_x2(sat16((int16_t)a + (int16_t)b),
+		       sat16((int16_t)(a >> 16) + (int16_t)(b >> 16)));
+#endif
 }
 
-/* Mix mono into both channels of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
-					    void const *const pcm_b, size_t size_b)
+/* Saturating addition of two 32-bit samples */
+static inline int32_t qadd32(int32_t a, int32_t b)
 {
-	int32_t res;
+#if defined(__ARM_FEATURE_DSP)
+	return __QADD(a, b);
+#else
+	return (int32_t)CLAMP((int64_t)a + b, INT32_MIN, INT32_MAX);
+#endif
+}
 
-	/* Use size_b as this is the length of the mono sample.
-	 * This must be *2 to traverse the stereo sample and /2 since
-	 * the sample is two bytes in size.
-	 */
-	for (uint32_t i = 0; i < size_b; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
+/* Dual 16-bit multiply with 64-bit accumulation */
+static inline int64_t smlald(uint32_t x, uint32_t y, int64_t acc)
+{
+#if defined(__ARM_FEATURE_DSP)
+	return (int64_t)__SMLALD(x, y, (uint64_t)acc);
+#else
+	return acc + (int32_t)(int16_t)x * (int16_t)y +
+	       (int32_t)(int16_t)(x >> 16) * (int16_t)(y >> 16);
+#endif
+}
 
-		hard_limiter(&res);
+static int mix_sizes_check(size_t size_a, size_t size_b, enum pcm_mix_mode mix_mode)
+{
+	switch (mix_mode) {
+	case B_STEREO_INTO_A_STEREO:
+		/* Fall through */
+	case B_MONO_INTO_A_MONO:
+		if (size_b > size_a) {
+			return -EPERM;
+		}
+		break;
+	case B_MONO_INTO_A_STEREO_LR:
+		/* Fall through */
+	case B_MONO_INTO_A_STEREO_L:
+		/* Fall through */
+	case B_MONO_INTO_A_STEREO_R:
+		if (size_b > (size_a / 2)) {
+			LOG_ERR("size a %zu size b %zu", size_a, size_b);
+			return -EPERM;
+		}
+		break;
+	default:
+		return -ESRCH;
+	};
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
-	}
+	return 0;
 }
 
-/* Mix mono into left channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_l(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
+static void pcm_mix_identical(void *const pcm_a, void const *const pcm_b, size_t size_b)
 {
-	int32_t res;
+	uint8_t *a = pcm_a;
+	uint8_t const *b = pcm_b;
+	size_t samples = size_b / sizeof(int16_t);
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2] + ((int16_t *)pcm_b)[i];
-
-		hard_limiter(&res);
+	/* Two samples at a time */
+	for (size_t i = 0; i < samples / 2; i++) {
+		write_x2(&a[i * 4], qadd16(read_x2(&a[i * 4]), read_x2(&b[i * 4])));
+	}
 
-		((int16_t *)pcm_a)[i * 2] = (int16_t)res;
+	if (samples % 2) {
+		((int16_t *)pcm_a)[samples - 1] =
+			sat16(((int16_t *)pcm_a)[samples - 1] + ((int16_t *)pcm_b)[samples - 1]);
 	}
 }
 
-/* Mix mono into right channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+/* Mix mono into one or both channels of a stereo buffer */
+static void pcm_mix_b_mono_into_a_stereo(void *const pcm_a, void const *const pcm_b,
+					 size_t size_b, enum pcm_mix_mode mix_mode)
 {
-	int32_t res;
+	uint8_t *a = pcm_a;
+	uint32_t mask;
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2 + 1] + ((int16_t *)pcm_b)[i];
+	/* Select the channels the mono sample is added to */
+	if (mix_mode == B_MONO_INTO_A_STEREO_LR) {
+		mask = UINT32_MAX;
+	} else if (mix_mode == B_MONO_INTO_A_STEREO_L) {
+		mask = UINT16_MAX;
+	} else {
+		mask = (uint32_t)UINT16_MAX << 16;
+	}
 
-		hard_limiter(&res);
+	/* Use size_b as this is the length of the mono sample.
+	 * Each mono sample is added to one stereo sample, i.e. two 16-bit samples at a time.
+	 */
+	for (size_t i = 0; i < size_b / sizeof(int16_t); i++) {
+		int16_t mono = ((int16_t *)pcm_b)[i];
 
-		((int16_t *)pcm_a)[i * 2 + 1] = (int16_t)res;
+		write_x2(&a[i * 4], qadd16(read_x2(&a[i * 4]), pack_x2(mono, mono) & mask));
 	}
 }
 
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode)
 {
+	int ret;
+
 	if (pcm_a == NULL || size_a == 0) {
 		return -EINVAL;
 	}
@@ -99,37 +166,101 @@ int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t si
 		return 0;
 	}
 
-	switch (mix_mode) {
-	case B_STEREO_INTO_A_STEREO:
-		/* Fall through */
-	case B_MONO_INTO_A_MONO:
-		if (size_b > size_a) {
-			return -EPERM;
+	ret = mix_sizes_check(size_a, size_b, mix_mode);
+	if (ret) {
+		return ret;
+	}
+
+	if (mix_mode == B_STEREO_INTO_A_STEREO || mix_mode == B_MONO_INTO_A_MONO) {
+		pcm_mix_identical(pcm_a, pcm_b, size_b);
+	} else {
+		pcm_mix_b_mono_into_a_stereo(pcm_a, pcm_b, size_b, mix_mode);
+	}
+
+	return 0;
+}
+
+int pcm_mix_32(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+	       enum pcm_mix_mode mix_mode)
+{
+	int ret;
+	int32_t *a = pcm_a;
+	int32_t const *b = pcm_b;
+
+	if (pcm_a == NULL || size_a == 0) {
+		return -EINVAL;
+	}
+
+	if (pcm_b == NULL || size_b == 0) {
+		/* Nothing to mix, returning */
+		return 0;
+	}
+
+	ret = mix_sizes_check(size_a, size_b, mix_mode);
+	if (ret) {
+		return ret;
+	}
+
+	if (mix_mode == B_STEREO_INTO_A_STEREO || mix_mode == B_MONO_INTO_A_MONO) {
+		for (size_t i = 0; i < size_b / sizeof(int32_t); i++) {
+			a[i] = qadd32(a[i], b[i]);
 		}
-		pcm_mix_identical(pcm_a, size_a, pcm_b, size_b);
-		break;
-	case B_MONO_INTO_A_STEREO_LR:
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
+
+		return 0;
+	}
+
+	/* Mix mono into one or both channels of a stereo buffer */
+	for (size_t i = 0; i < size_b / sizeof(int32_t); i++) {
+		if (mix_mode != B_MONO_INTO_A_STEREO_R) {
+			a[i * 2] = qadd32(a[i * 2], b[i]);
 		}
-		pcm_mix_b_mono_into_a_stereo_lr(pcm_a, size_a, pcm_b, size_b);
-		break;
-	case B_MONO_INTO_A_STEREO_L:
-		pcm_mix_b_mono_into_a_stereo_l(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			LOG_ERR("size a %d size b %d", size_a, size_b);
-			return -EPERM;
+
+		if (mix_mode != B_MONO_INTO_A_STEREO_L) {
+			a[i * 2 + 1] = qadd32(a[i * 2 + 1], b[i]);
 		}
-		break;
-	case B_MONO_INTO_A_STEREO_R:
-		pcm_mix_b_mono_into_a_stereo_r(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
+	}
+
+	return 0;
+}
+
+int pcm_mix_weighted(void *const pcm_out, size_t size, void const *const *const pcm_in,
+		     int16_t const *const gains, size_t num_streams)
+{
+	size_t s;
+	int64_t acc;
+
+	if (pcm_out == NULL || pcm_in == NULL || gains == NULL || num_streams == 0) {
+		return -EINVAL;
+	}
+
+	for (s = 0; s < num_streams; s++) {
+		if (pcm_in[s] == NULL) {
+			return -EINVAL;
 		}
-		break;
-	default:
-		return -ESRCH;
-	};
+	}
+
+	/* All streams are read at a sample before it is written, so pcm_out may be one of the
+	 * input buffers.
+	 */
+	for (size_t i = 0; i < size / sizeof(int16_t); i++) {
+		acc = 0;
+
+		/* Two streams at a time */
+		for (s = 0; s + 1 < num_streams; s += 2) {
+			acc = smlald(pack_x2(((int16_t const *)pcm_in[s])[i],
+					     ((int16_t const *)pcm_in[s + 1])[i]),
+				     pack_x2(gains[s], gains[s + 1]), acc);
+		}
+
+		if (s < num_streams) {
+			acc += (int32_t)((int16_t const *)pcm_in[s])[i] * gains[s];
+		}
+
+		/* Round to nearest */
+		acc = (acc + (1 << (PCM_MIX_GAIN_SHIFT - 1))) >> PCM_MIX_GAIN_SHIFT;
+
+		((int16_t *)pcm_out)[i] = (int16_t)CLAMP(acc, INT16_MIN, INT16_MAX);
+	}
 
 	return 0;
 }
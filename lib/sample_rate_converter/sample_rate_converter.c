@@ -14,26 +14,6 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
 
-/**
- * The input buffer must be able to store two samples in addition to the block size to meet
- * filter requirements.
- */
-#define INTERNAL_INPUT_BUF_NUMBER_SAMPLES                                                          \
-	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX +                                             \
-	 SAMPLE_RATE_CONVERTER_INPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES)
-
-#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
-#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
-	(INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint16_t))
-#define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
-	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint16_t))
-#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
-#define SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE                                              \
-	(INTERNAL_INPUT_BUF_NUMBER_SAMPLES * sizeof(uint32_t))
-#define SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE                                             \
-	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint32_t))
-#endif
-
 static int validate_sample_rates(uint32_t sample_rate_input, uint32_t sample_rate_output)
 {
 	if (sample_rate_input > sample_rate_output) {
@@ -209,9 +189,8 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 	const uint8_t *read_ptr;
 	uint8_t *write_ptr;
 	size_t samples_to_process;
-
-	uint8_t internal_input_buf[SAMPLE_RATE_CONVERTER_INTERNAL_INPUT_BUF_SIZE];
-	uint8_t internal_output_buf[SAMPLE_RATE_CONVERTER_INTERNAL_OUTPUT_BUF_SIZE];
+	uint8_t *internal_input_buf;
+	uint8_t *internal_output_buf;
 
 #if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
 	size_t bytes_per_sample = sizeof(uint16_t);
@@ -272,6 +251,9 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 		return -EINVAL;
 	}
 
+	internal_input_buf = ctx->internal_input_buf;
+	internal_output_buf = ctx->internal_output_buf;
+
 	if (ctx->conversion_ratio == 3) {
 		read_ptr = internal_input_buf;
 		write_ptr = internal_output_buf;
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sample_rate_converter.h"
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
+
+#define PHASES_MAX   CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_PHASES_MAX
+#define TAPS	     CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS
+#define CHANNELS_MAX CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_CHANNELS_MAX
+
+/* Coefficients are in Q15 format */
+#define COEFF_SHIFT 15
+#define COEFF_UNITY (1 << COEFF_SHIFT)
+
+/* Cutoff frequency of the filter relative to the Nyquist frequency of the slower sample rate */
+#define CUTOFF_RATIO 0.9f
+
+#define PI_F 3.14159265358979f
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef int16_t polyphase_sample_t;
+#define SAMPLE_MIN INT16_MIN
+#define SAMPLE_MAX INT16_MAX
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef int32_t polyphase_sample_t;
+#define SAMPLE_MIN INT32_MIN
+#define SAMPLE_MAX INT32_MAX
+#endif
+
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+	while (b != 0) {
+		uint32_t rem = a % b;
+
+		a = b;
+		b = rem;
+	}
+
+	return a;
+}
+
+/**
+ * @brief Calculate the polyphase filter.
+ *
+ * The prototype is a Blackman windowed sinc low-pass filter at the interpolated sample rate,
+ * with TAPS coefficients for each of the phases. Coefficient k of phase p is tap k * L + p of
+ * the prototype. Each phase is normalized to unity gain at DC, so that a constant input gives a
+ * constant output whatever phase an output frame falls on.
+ */
+static void coeffs_calculate(struct sample_rate_converter_polyphase_ctx *ctx)
+{
+	uint16_t phases = ctx->interpolation;
+	uint32_t length = phases * TAPS;
+	float cutoff = CUTOFF_RATIO * 0.5f / MAX(ctx->interpolation, ctx->decimation);
+	float center = (length - 1) / 2.0f;
+	float taps[TAPS];
+
+	for (uint16_t p = 0; p < phases; p++) {
+		int16_t *coeffs = &ctx->coeffs[p * TAPS];
+		float sum = 0.0f;
+		int32_t quantized_sum = 0;
+		uint8_t largest = 0;
+
+		for (uint8_t k = 0; k < TAPS; k++) {
+			uint32_t n = k * phases + p;
+			float x = 2.0f * cutoff * (n - center);
+			float window = 0.42f;
+
+			if (length > 1) {
+				window -= 0.5f * cosf(2.0f * PI_F * n / (length - 1)) -
+					  0.08f * cosf(4.0f * PI_F * n / (length - 1));
+			}
+
+			taps[k] = window * ((x == 0.0f) ? 1.0f : sinf(PI_F * x) / (PI_F * x));
+			sum += taps[k];
+		}
+
+		for (uint8_t k = 0; k < TAPS; k++) {
+			coeffs[k] = (int16_t)CLAMP(lrintf(taps[k] / sum * COEFF_UNITY), INT16_MIN,
+						   INT16_MAX);
+			quantized_sum += coeffs[k];
+
+			if (coeffs[k] > coeffs[largest]) {
+				largest = k;
+			}
+		}
+
+		/* Give the rounding error to the largest coefficient to keep unity gain */
+		coeffs[largest] = (int16_t)CLAMP(coeffs[largest] + COEFF_UNITY - quantized_sum,
+						 INT16_MIN, INT16_MAX);
+	}
+}
+
+/* Add an input frame to the history, newest first */
+static void history_push(struct sample_rate_converter_polyphase_ctx *ctx,
+			 polyphase_sample_t const *frame)
+{
+	int32_t *hist;
+
+	ctx->history_pos = (ctx->history_pos == 0) ? (TAPS - 1) : (ctx->history_pos - 1);
+	hist = &ctx->history[ctx->history_pos * ctx->channels];
+
+	for (uint8_t c = 0; c < ctx->channels; c++) {
+		hist[c] = frame[c];
+		hist[c + TAPS * ctx->channels] = frame[c];
+	}
+}
+
+/* Calculate one output frame for all channels */
+static void frame_filter(struct sample_rate_converter_polyphase_ctx *ctx,
+			 polyphase_sample_t *frame)
+{
+	int16_t const *coeffs = &ctx->coeffs[ctx->phase * TAPS];
+	int32_t const *hist = &ctx->history[ctx->history_pos * ctx->channels];
+	uint8_t channels = ctx->channels;
+	int64_t acc[CHANNELS_MAX] = {0};
+
+	for (uint8_t k = 0; k < TAPS; k++) {
+		for (uint8_t c = 0; c < channels; c++) {
+			acc[c] += (int64_t)hist[c] * coeffs[k];
+		}
+
+		hist += channels;
+	}
+
+	for (uint8_t c = 0; c < channels; c++) {
+		/* Round to nearest */
+		acc[c] = (acc[c] + (1 << (COEFF_SHIFT - 1))) >> COEFF_SHIFT;
+
+		frame[c] = (polyphase_sample_t)CLAMP(acc[c], SAMPLE_MIN, SAMPLE_MAX);
+	}
+}
+
+int sample_rate_converter_polyphase_open(struct sample_rate_converter_polyphase_ctx *ctx,
+					 uint32_t sample_rate_input, uint32_t sample_rate_output,
+					 uint8_t channels)
+{
+	uint32_t divisor;
+
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if (sample_rate_input == 0 || sample_rate_output == 0 ||
+	    sample_rate_input == sample_rate_output) {
+		LOG_ERR("Invalid sample rates, input: %d output: %d", sample_rate_input,
+			sample_rate_output);
+		return -EINVAL;
+	}
+
+	if (channels == 0 || channels > CHANNELS_MAX) {
+		LOG_ERR("Invalid number of channels: %d", channels);
+		return -EINVAL;
+	}
+
+	divisor = gcd(sample_rate_input, sample_rate_output);
+
+	if ((sample_rate_output / divisor) > PHASES_MAX ||
+	    (sample_rate_input / divisor) > UINT16_MAX) {
+		LOG_ERR("Conversion from %d to %d needs %d filter phases, max is %d",
+			sample_rate_input, sample_rate_output, sample_rate_output / divisor,
+			PHASES_MAX);
+		return -EINVAL;
+	}
+
+	memset(ctx, 0, sizeof(struct sample_rate_converter_polyphase_ctx));
+
+	ctx->sample_rate_input = sample_rate_input;
+	ctx->sample_rate_output = sample_rate_output;
+	ctx->channels = channels;
+	ctx->interpolation = sample_rate_output / divisor;
+	ctx->decimation = sample_rate_input / divisor;
+
+	coeffs_calculate(ctx);
+
+	LOG_DBG("Polyphase sample rate converter initialized. Input sample rate: %d, Output "
+		"sample rate: %d, interpolation: %d, decimation: %d, channels: %d",
+		ctx->sample_rate_input, ctx->sample_rate_output, ctx->interpolation,
+		ctx->decimation, ctx->channels);
+
+	return 0;
+}
+
+int sample_rate_converter_polyphase_process(struct sample_rate_converter_polyphase_ctx *ctx,
+					    void const *const input, size_t input_size,
+					    void *const output, size_t output_size,
+					    size_t *output_written)
+{
+	polyphase_sample_t const *in = input;
+	polyphase_sample_t *out = output;
+	size_t frame_size;
+	size_t frames_in;
+	uint64_t upsampled;
+	size_t frames_out = 0;
+
+	if (ctx == NULL || input == NULL || output == NULL || output_written == NULL) {
+		LOG_ERR("Null pointer received");
+		return -EINVAL;
+	}
+
+	if (ctx->channels == 0) {
+		LOG_ERR("Context has not been opened");
+		return -EINVAL;
+	}
+
+	frame_size = ctx->channels * sizeof(polyphase_sample_t);
+
+	if (input_size % frame_size) {
+		LOG_ERR("Input size %zu is not a whole number of frames", input_size);
+		return -EINVAL;
+	}
+
+	frames_in = input_size / frame_size;
+
+	/* Each input frame moves the filter L phases on, and each output frame moves it M phases
+	 * on. Outputs are produced until the phase passes the end of the last input frame.
+	 */
+	upsampled = (uint64_t)frames_in * ctx->interpolation;
+	if (upsampled > ctx->phase) {
+		frames_out = DIV_ROUND_UP(upsampled - ctx->phase, ctx->decimation);
+	}
+
+	if (output_size < frames_out * frame_size) {
+		LOG_ERR("Output buffer too small. Bytes required: %zu, size: %zu",
+			frames_out * frame_size, output_size);
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < frames_in; i++) {
+		history_push(ctx, in);
+		in += ctx->channels;
+
+		while (ctx->phase < ctx->interpolation) {
+			frame_filter(ctx, out);
+			out += ctx->channels;
+			ctx->phase += ctx->decimation;
+		}
+
+		ctx->phase -= ctx->interpolation;
+	}
+
+	*output_written = frames_out * frame_size;
+
+	return 0;
+}
@@ -12,17 +12,82 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/reboot.h>
 
+#include "app_event_manager_slab.h"
+
 LOG_MODULE_REGISTER(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+#define LANE_CNT APP_EVENT_LANE_COUNT
+#else
+#define LANE_CNT 1
+#endif
+
 static void event_processor_fn(struct k_work *work);
 
 struct app_event_manager_event_display_bm _app_event_manager_event_display_bm;
 
 static K_WORK_DEFINE(event_processor, event_processor_fn);
-static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
+static sys_slist_t eventq[LANE_CNT];
 static struct k_spinlock lock;
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+struct lane_thread {
+	struct k_work_q work_q;
+	struct k_work work;
+	k_thread_stack_t *stack;
+	size_t stack_size;
+	int prio;
+	const char *name;
+	bool started;
+};
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANE_HIGH_THREAD)
+static K_THREAD_STACK_DEFINE(lane_high_stack, CONFIG_APP_EVENT_MANAGER_LANE_HIGH_THREAD_STACK_SIZE);
+#endif
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANE_LOW_THREAD)
+static K_THREAD_STACK_DEFINE(lane_low_stack, CONFIG_APP_EVENT_MANAGER_LANE_LOW_THREAD_STACK_SIZE);
+#endif
+
+/* Lanes without a stack are processed in the system workqueue. */
+static struct lane_thread lane_threads[LANE_CNT] = {
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANE_HIGH_THREAD)
+	[APP_EVENT_LANE_HIGH] = {
+		.stack = lane_high_stack,
+		.stack_size = K_THREAD_STACK_SIZEOF(lane_high_stack),
+		.prio = CONFIG_APP_EVENT_MANAGER_LANE_HIGH_THREAD_PRIORITY,
+		.name = "aem_lane_high",
+	},
+#endif
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANE_LOW_THREAD)
+	[APP_EVENT_LANE_LOW] = {
+		.stack = lane_low_stack,
+		.stack_size = K_THREAD_STACK_SIZEOF(lane_low_stack),
+		.prio = CONFIG_APP_EVENT_MANAGER_LANE_LOW_THREAD_PRIORITY,
+		.name = "aem_lane_low",
+	},
+#endif
+};
+#endif /* CONFIG_APP_EVENT_MANAGER_LANES */
+
+static size_t event_lane(const struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+	return app_event_get_type_lane(aeh->type_id);
+#else
+	return 0;
+#endif
+}
+
+static bool lane_has_thread(size_t lane)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+	return lane_threads[lane].stack != NULL;
+#else
+	return false;
+#endif
+}
+
 static bool log_is_event_displayed(const struct event_type *et)
 {
 	size_t idx = et - _event_type_list_start;
@@ -114,9 +179,15 @@ static void log_event_init(void)
 	}
 }
 
-void * __weak app_event_manager_alloc(size_t size)
+static void *event_alloc(size_t size, bool dyndata)
 {
-	void *event = k_malloc(size);
+	void *event;
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SLAB_ALLOCATOR)) {
+		event = app_event_manager_slab_alloc(size, dyndata);
+	} else {
+		event = k_malloc(size);
+	}
 
 	if (unlikely(!event)) {
 		LOG_ERR("Application Event Manager OOM error\n");
@@ -132,83 +203,253 @@ void * __weak app_event_manager_alloc(size_t size)
 	return event;
 }
 
-void __weak app_event_manager_free(void *addr)
+void * __weak app_event_manager_alloc(size_t size)
 {
-	k_free(addr);
+	return event_alloc(size, false);
 }
 
-static void event_processor_fn(struct k_work *work)
+void *_app_event_manager_alloc_dyndata(size_t size)
 {
-	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SLAB_ALLOCATOR)) {
+		return event_alloc(size, true);
+	}
 
-	/* Make current event list local. */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	return app_event_manager_alloc(size);
+}
 
-	if (sys_slist_is_empty(&eventq)) {
-		k_spin_unlock(&lock, key);
-		return;
+void __weak app_event_manager_free(void *addr)
+{
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SLAB_ALLOCATOR)) {
+		app_event_manager_slab_free(addr);
+	} else {
+		k_free(addr);
 	}
+}
 
-	sys_slist_merge_slist(&events, &eventq);
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+struct listener_stats {
+	atomic_t event_cnt;
+	atomic_t notified_cnt;
+	atomic_t not_consumed_cnt;
+	atomic_t filtered_cnt;
+};
 
-	k_spin_unlock(&lock, key);
+static struct listener_stats listener_stats[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
 
-	/* Traverse the list of events. */
-	sys_snode_t *node;
-	while (NULL != (node = sys_slist_get(&events))) {
-		struct app_event_header *aeh = CONTAINER_OF(node,
-						       struct app_event_header,
-						       node);
+void app_event_manager_listener_stats_get(const struct event_type *et,
+					  struct app_event_manager_listener_stats *stats)
+{
+	APP_EVENT_ASSERT_ID(et);
 
-		APP_EVENT_ASSERT_ID(aeh->type_id);
+	struct listener_stats *ls = &listener_stats[et - _event_type_list_start];
 
-		const struct event_type *et = aeh->type_id;
+	stats->event_cnt = atomic_get(&ls->event_cnt);
+	stats->notified_cnt = atomic_get(&ls->notified_cnt);
+	stats->not_consumed_cnt = atomic_get(&ls->not_consumed_cnt);
+	stats->filtered_cnt = atomic_get(&ls->filtered_cnt);
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_LISTENER_STATS */
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
-				h->hook(aeh);
-			}
+static void listener_stats_update(const struct event_type *et, size_t notified_cnt,
+				  size_t filtered_cnt, bool consumed)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+	struct listener_stats *ls = &listener_stats[et - _event_type_list_start];
+
+	atomic_inc(&ls->event_cnt);
+	atomic_add(&ls->notified_cnt, notified_cnt);
+	atomic_add(&ls->not_consumed_cnt, consumed ? (notified_cnt - 1) : notified_cnt);
+	atomic_add(&ls->filtered_cnt, filtered_cnt);
+#endif
+}
+
+static bool subscriber_accepts(const struct event_subscriber *es,
+			       const struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBSCRIBER_FILTERS)
+	if (es->filter_offset == 0) {
+		return true;
+	}
+
+	/* The field may be unaligned, for example in a packed event structure. */
+	const void *field = (const uint8_t *)aeh + es->filter_offset;
+	uint32_t value;
+
+	switch (es->filter_size) {
+	case sizeof(uint8_t):
+		value = *(const uint8_t *)field;
+		break;
+	case sizeof(uint16_t):
+		value = UNALIGNED_GET((const uint16_t *)field);
+		break;
+	default:
+		value = UNALIGNED_GET((const uint32_t *)field);
+		break;
+	}
+
+	return (value < 32) && ((es->filter_values & BIT(value)) != 0);
+#else
+	return true;
+#endif
+}
+
+static void event_process(struct app_event_header *aeh)
+{
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	const struct event_type *et = aeh->type_id;
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
+			h->hook(aeh);
 		}
+	}
 
-		log_event(aeh);
+	log_event(aeh);
 
-		bool consumed = false;
+	bool consumed = false;
+	size_t notified_cnt = 0;
+	size_t filtered_cnt = 0;
 
-		for (const struct event_subscriber *es = et->subs_start;
-		     (es != et->subs_stop) && !consumed;
-		     es++) {
+	for (const struct event_subscriber *es = et->subs_start;
+	     (es != et->subs_stop) && !consumed;
+	     es++) {
 
-			__ASSERT_NO_MSG(es != NULL);
+		__ASSERT_NO_MSG(es != NULL);
 
-			const struct event_listener *el = es->listener;
+		const struct event_listener *el = es->listener;
 
-			__ASSERT_NO_MSG(el != NULL);
-			__ASSERT_NO_MSG(el->notification != NULL);
+		__ASSERT_NO_MSG(el != NULL);
+		__ASSERT_NO_MSG(el->notification != NULL);
 
-			log_event_progress(et, el);
+		if (!subscriber_accepts(es, aeh)) {
+			filtered_cnt++;
+			continue;
+		}
 
-			consumed = el->notification(aeh);
+		log_event_progress(et, el);
 
-			if (consumed) {
-				log_event_consumed(et);
-			}
+		consumed = el->notification(aeh);
+		notified_cnt++;
+
+		if (consumed) {
+			log_event_consumed(et);
 		}
+	}
+
+	listener_stats_update(et, notified_cnt, filtered_cnt, consumed);
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
-				h->hook(aeh);
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
+			h->hook(aeh);
+		}
+	}
+
+	app_event_manager_free(aeh);
+}
+
+/* Get the next event from the highest priority lane that is not empty, out of the lanes processed
+ * in the system workqueue or in a dedicated thread.
+ */
+static struct app_event_header *lane_event_get(bool has_thread, size_t lane)
+{
+	sys_snode_t *node = NULL;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (has_thread) {
+		node = sys_slist_get(&eventq[lane]);
+	} else {
+		for (size_t i = 0; (i < LANE_CNT) && !node; i++) {
+			if (!lane_has_thread(i)) {
+				node = sys_slist_get(&eventq[i]);
 			}
 		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return node ? CONTAINER_OF(node, struct app_event_header, node) : NULL;
+}
 
-		app_event_manager_free(aeh);
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+static void lane_processor_fn(struct k_work *work)
+{
+	struct lane_thread *lt = CONTAINER_OF(work, struct lane_thread, work);
+	size_t lane = lt - lane_threads;
+	struct app_event_header *aeh;
+
+	while (NULL != (aeh = lane_event_get(true, lane))) {
+		event_process(aeh);
 	}
 }
+#endif
+
+static void event_processor_fn(struct k_work *work)
+{
+	if (LANE_CNT > 1) {
+		struct app_event_header *aeh;
+
+		/* Get the events one by one, so that events submitted to a higher priority lane
+		 * in the meantime are processed first.
+		 */
+		while (NULL != (aeh = lane_event_get(false, 0))) {
+			event_process(aeh);
+		}
+
+		return;
+	}
+
+	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+
+	/* Make current event list local. */
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (sys_slist_is_empty(&eventq[0])) {
+		k_spin_unlock(&lock, key);
+		return;
+	}
+
+	sys_slist_merge_slist(&events, &eventq[0]);
+
+	k_spin_unlock(&lock, key);
+
+	/* Traverse the list of events. */
+	sys_snode_t *node;
+	while (NULL != (node = sys_slist_get(&events))) {
+		struct app_event_header *aeh = CONTAINER_OF(node,
+						       struct app_event_header,
+						       node);
+
+		event_process(aeh);
+	}
+}
+
+static void lane_work_submit(size_t lane)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+	if (lane_has_thread(lane)) {
+		/* Events submitted before the thread is started are processed once it starts. */
+		if (lane_threads[lane].started) {
+			(void)k_work_submit_to_queue(&lane_threads[lane].work_q,
+						     &lane_threads[lane].work);
+		}
+		return;
+	}
+#endif
+	k_work_submit(&event_processor);
+}
 
 void _event_submit(struct app_event_header *aeh)
 {
 	__ASSERT_NO_MSG(aeh);
 	APP_EVENT_ASSERT_ID(aeh->type_id);
 
+	size_t lane = event_lane(aeh);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_TIMESTAMP)
+	aeh->submit_time = k_cycle_get_32();
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
@@ -216,12 +457,36 @@ void _event_submit(struct app_event_header *aeh)
 			h->hook(aeh);
 		}
 	}
-	sys_slist_append(&eventq, &aeh->node);
+	sys_slist_append(&eventq[lane], &aeh->node);
 	k_spin_unlock(&lock, key);
 
-	k_work_submit(&event_processor);
+	lane_work_submit(lane);
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+static void lane_threads_start(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(lane_threads); i++) {
+		struct lane_thread *lt = &lane_threads[i];
+		struct k_work_queue_config cfg = {
+			.name = lt->name,
+		};
+
+		if (!lane_has_thread(i)) {
+			continue;
+		}
+
+		k_work_init(&lt->work, lane_processor_fn);
+		k_work_queue_init(&lt->work_q);
+		k_work_queue_start(&lt->work_q, lt->stack, lt->stack_size, lt->prio, &cfg);
+		lt->started = true;
+
+		/* Process the events submitted before initialization. */
+		(void)k_work_submit_to_queue(&lt->work_q, &lt->work);
+	}
+}
+#endif
+
 int app_event_manager_init(void)
 {
 	int ret = 0;
@@ -231,6 +496,17 @@ int app_event_manager_init(void)
 
 	log_event_init();
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+	lane_threads_start();
+#endif
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SLAB_ALLOCATOR)) {
+		ret = app_event_manager_slab_init();
+		if (ret) {
+			return ret;
+		}
+	}
+
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTINIT_HOOK)) {
 		STRUCT_SECTION_FOREACH(app_event_manager_postinit_hook, h) {
 			ret = h->hook();
@@ -115,6 +115,35 @@ extern "C" {
 	}
 
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBSCRIBER_FILTERS)
+#define _APP_EVENT_SUBSCRIBER_FILTER(ename, field, values)				\
+	.filter_offset = offsetof(struct ename, field),					\
+	.filter_size = sizeof(((struct ename *)0)->field),				\
+	.filter_values = (values),
+#else
+#define _APP_EVENT_SUBSCRIBER_FILTER(ename, field, values)
+#endif
+
+/* Subscribe a listener to an event with a filter on an event field. */
+#define _APP_EVENT_SUBSCRIBE_FILTERED(lname, ename, prio, field, values)		\
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBSCRIBER_FILTERS),		\
+		     "Enable APP_EVENT_MANAGER_SUBSCRIBER_FILTERS before usage");	\
+	BUILD_ASSERT((sizeof(((struct ename *)0)->field) == sizeof(uint8_t)) ||		\
+		     (sizeof(((struct ename *)0)->field) == sizeof(uint16_t)) ||	\
+		     (sizeof(((struct ename *)0)->field) == sizeof(uint32_t)),		\
+		     "Unsupported size of the filtered field");				\
+	BUILD_ASSERT(offsetof(struct ename, field) <= UINT16_MAX,			\
+		     "Offset of the filtered field does not fit the subscriber");	\
+	const struct event_subscriber _CONCAT(_CONCAT(__event_subscriber_, ename), lname)\
+	__used __aligned(__alignof(struct event_subscriber))				\
+	__attribute__((__section__(_APP_EVENT_SUBSCRIBERS_SECTION_NAME(ename, prio)))) = {\
+		.listener = &_CONCAT(__event_listener_, lname),				\
+		_APP_EVENT_SUBSCRIBER_FILTER(ename, field, values)			\
+	}
+
+#define _APP_EVENT_FILTER_VALUE(value) BIT(value)
+
+
 /* Pointer to event type definition is used as event type identifier. */
 #define _EVENT_ID(ename) (&_CONCAT(__event_type_, ename))
 
@@ -145,7 +174,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(size_t size)			\
 	{										\
 		struct ename *event =							\
-			(struct ename *)app_event_manager_alloc(sizeof(*event) + size);	\
+			(struct ename *)_app_event_manager_alloc_dyndata(sizeof(*event) + size);\
 		BUILD_ASSERT((offsetof(struct ename, dyndata) +				\
 				  sizeof(event->dyndata.size)) ==			\
 				 sizeof(*event), "");					\
@@ -230,6 +259,11 @@ struct app_event_header {
 
 	/** Pointer to the event type object. */
 	const struct event_type *type_id;
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_TIMESTAMP)
+	/** Cycle count at event submission. */
+	uint32_t submit_time;
+#endif
 };
 
 /** Function to log data from this event. */
@@ -299,10 +333,22 @@ extern struct event_type _event_type_list_start[];
 extern struct event_type _event_type_list_end[];
 
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+#define _APP_EVENT_LANE_FLAGS_CHECK(et_flags)						\
+	BUILD_ASSERT(((et_flags) & (BIT(APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY) |		\
+		BIT(APP_EVENT_TYPE_FLAGS_LOW_PRIORITY))) !=				\
+		(BIT(APP_EVENT_TYPE_FLAGS_HIGH_PRIORITY) |				\
+		BIT(APP_EVENT_TYPE_FLAGS_LOW_PRIORITY)),				\
+		"Event type cannot be both high and low priority")
+#else
+#define _APP_EVENT_LANE_FLAGS_CHECK(et_flags) BUILD_ASSERT(1)
+#endif
+
 #define _APP_EVENT_TYPE_DEFINE(ename, log_fn, trace_data_pointer, et_flags)		\
 	BUILD_ASSERT(((et_flags) & ((BIT_MASK(APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START-	\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START))<<					\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START)) == 0);				\
+	_APP_EVENT_LANE_FLAGS_CHECK(et_flags);						\
 	_APP_EVENT_SUBSCRIBERS_ARRAY_TAGS(ename);					\
 	STRUCT_SECTION_ITERABLE(event_type, _CONCAT(__event_type_, ename)) = {		\
 		.name            = STRINGIFY(ename),					\
@@ -395,6 +441,17 @@ struct event_listener {
 struct event_subscriber {
 	/** Pointer to the listener. */
 	const struct event_listener *listener;
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBSCRIBER_FILTERS)
+	/** Offset of the filtered event field, zero if the subscriber is not filtered. */
+	uint16_t filter_offset;
+
+	/** Size of the filtered event field. */
+	uint8_t filter_size;
+
+	/** Bitmask of the accepted values of the filtered event field. */
+	uint32_t filter_values;
+#endif
 };
 
 
@@ -433,6 +490,16 @@ struct event_postprocess_hook {
  */
 void _event_submit(struct app_event_header *aeh);
 
+/** @brief Allocate an event with dynamic data.
+ *
+ * With the slab allocator, events with dynamic data are allocated from the system heap.
+ * Otherwise, the function calls @ref app_event_manager_alloc.
+ *
+ * @param size  Size of the event, including the dynamic data.
+ * @retval Address of the allocated memory if successful, otherwise NULL.
+ */
+void *_app_event_manager_alloc_dyndata(size_t size);
+
 #ifdef __cplusplus
 }
 #endif
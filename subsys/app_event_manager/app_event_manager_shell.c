@@ -8,6 +8,7 @@
 #include <zephyr/shell/shell.h>
 #include <app_event_manager.h>
 
+#include "app_event_manager_slab.h"
 
 static int show_events(const struct shell *shell, size_t argc,
 		char **argv)
@@ -81,6 +82,55 @@ static int show_subscribers(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SLAB_ALLOCATOR)
+static int show_allocator(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	size_t class_cnt = app_event_manager_slab_class_cnt();
+
+	shell_fprintf(shell, SHELL_NORMAL, "Event slabs:\n");
+
+	for (size_t i = 0; i < class_cnt; i++) {
+		struct app_event_manager_slab_stats stats;
+		int err = app_event_manager_slab_stats_get(i, &stats);
+
+		__ASSERT_NO_MSG(!err);
+		ARG_UNUSED(err);
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t%zu B: used %zu/%zu, max used %zu, failures %u, types %zu\n",
+			      stats.block_size, stats.num_used, stats.num_blocks,
+			      stats.max_used, stats.alloc_fail, stats.type_cnt);
+	}
+
+	shell_fprintf(shell, SHELL_NORMAL, "Events allocated from heap: %zu\n",
+		      app_event_manager_slab_heap_alloc_cnt());
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_SLAB_ALLOCATOR */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS)
+static int show_listener_stats(const struct shell *shell, size_t argc,
+		char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Listener statistics:\n");
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		struct app_event_manager_listener_stats stats;
+
+		app_event_manager_listener_stats_get(et, &stats);
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t[E:%s] events %u, notified %u, not consumed %u, filtered %u\n",
+			      et->name, stats.event_cnt, stats.notified_cnt,
+			      stats.not_consumed_cnt, stats.filtered_cnt);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_LISTENER_STATS */
+
 static void set_event_displaying(const struct shell *shell, size_t argc,
 				 char **argv, bool enable)
 {
@@ -155,6 +205,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_event_manager,
 	SHELL_CMD_ARG(show_subscribers, NULL, "Show subscribers",
 		      show_subscribers, 0, 0),
 	SHELL_CMD_ARG(show_events, NULL, "Show events", show_events, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_SLAB_ALLOCATOR, show_allocator, NULL,
+			   "Show event slab statistics", show_allocator, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_LISTENER_STATS, show_listener_stats, NULL,
+			   "Show listener statistics", show_listener_stats, 0, 0),
 	SHELL_CMD_ARG(disable, NULL, "Disable displaying event with given ID",
 		      disable_event_displaying, 0,
 		      sizeof(_app_event_manager_event_display_bm) * 8 - 1),
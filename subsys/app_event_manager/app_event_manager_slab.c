@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <app_event_manager.h>
+#include <zephyr/logging/log.h>
+
+#include "app_event_manager_slab.h"
+
+LOG_MODULE_DECLARE(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
+
+#define SLAB_ALIGN sizeof(void *)
+
+struct slab_class {
+	struct k_mem_slab slab;
+	/* Number of event types whose event structure fits this class best. */
+	size_t type_cnt;
+	atomic_t max_used;
+	atomic_t alloc_fail;
+};
+
+static uint8_t slab_arena[CONFIG_APP_EVENT_MANAGER_SLAB_ALLOCATOR_ARENA_SIZE]
+	__aligned(SLAB_ALIGN);
+static struct slab_class slab_classes[CONFIG_APP_EVENT_MANAGER_SLAB_ALLOCATOR_MAX_CLASSES];
+static size_t slab_class_cnt;
+static atomic_t heap_alloc_cnt;
+static bool slab_ready;
+
+static void class_add(size_t *sizes, size_t *type_cnts, size_t *cnt, size_t size)
+{
+	size_t i;
+
+	for (i = 0; i < *cnt; i++) {
+		if (sizes[i] == size) {
+			type_cnts[i]++;
+			return;
+		}
+		if (sizes[i] > size) {
+			break;
+		}
+	}
+
+	/* Keep the sizes sorted in ascending order. */
+	memmove(&sizes[i + 1], &sizes[i], (*cnt - i) * sizeof(sizes[0]));
+	memmove(&type_cnts[i + 1], &type_cnts[i], (*cnt - i) * sizeof(type_cnts[0]));
+	sizes[i] = size;
+	type_cnts[i] = 1;
+	(*cnt)++;
+}
+
+/* Merge size classes until they fit the limit. The class with the smallest gap to the next larger
+ * one is merged into it, as this wastes the least memory per block.
+ */
+static void class_merge(size_t *sizes, size_t *type_cnts, size_t *cnt, size_t max_cnt)
+{
+	while (*cnt > max_cnt) {
+		size_t merged = 0;
+
+		for (size_t i = 1; i < *cnt - 1; i++) {
+			if ((sizes[i + 1] - sizes[i]) < (sizes[merged + 1] - sizes[merged])) {
+				merged = i;
+			}
+		}
+
+		type_cnts[merged + 1] += type_cnts[merged];
+		memmove(&sizes[merged], &sizes[merged + 1], (*cnt - merged - 1) * sizeof(sizes[0]));
+		memmove(&type_cnts[merged], &type_cnts[merged + 1],
+			(*cnt - merged - 1) * sizeof(type_cnts[0]));
+		(*cnt)--;
+	}
+}
+
+int app_event_manager_slab_init(void)
+{
+	size_t sizes[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+	size_t type_cnts[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+	size_t cnt = 0;
+	size_t weighted_size = 0;
+	size_t blocks_per_type;
+	uint8_t *buf = slab_arena;
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		/* The size of events with dynamic data is only known at allocation. */
+		if (app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) {
+			continue;
+		}
+
+		class_add(sizes, type_cnts, &cnt, ROUND_UP(et->struct_size, SLAB_ALIGN));
+	}
+
+	if (cnt == 0) {
+		return 0;
+	}
+
+	class_merge(sizes, type_cnts, &cnt, ARRAY_SIZE(slab_classes));
+
+	for (size_t i = 0; i < cnt; i++) {
+		weighted_size += sizes[i] * type_cnts[i];
+	}
+
+	/* Each event type gets the same number of blocks in its size class. */
+	blocks_per_type = sizeof(slab_arena) / weighted_size;
+	if (blocks_per_type == 0) {
+		LOG_ERR("Event slab arena too small, %zu bytes required", weighted_size);
+		return -ENOMEM;
+	}
+
+	for (size_t i = 0; i < cnt; i++) {
+		struct slab_class *sc = &slab_classes[i];
+		size_t num_blocks = blocks_per_type * type_cnts[i];
+		int err;
+
+		err = k_mem_slab_init(&sc->slab, buf, sizes[i], num_blocks);
+		if (err) {
+			LOG_ERR("Cannot init event slab of %zu bytes (err %d)", sizes[i], err);
+			return err;
+		}
+
+		sc->type_cnt = type_cnts[i];
+		buf += sizes[i] * num_blocks;
+
+		LOG_DBG("Event slab: %zu blocks of %zu bytes", num_blocks, sizes[i]);
+	}
+
+	slab_class_cnt = cnt;
+	slab_ready = true;
+
+	return 0;
+}
+
+static void max_used_update(struct slab_class *sc)
+{
+	atomic_val_t used = k_mem_slab_num_used_get(&sc->slab);
+	atomic_val_t max_used;
+
+	do {
+		max_used = atomic_get(&sc->max_used);
+		if (used <= max_used) {
+			break;
+		}
+	} while (!atomic_cas(&sc->max_used, max_used, used));
+}
+
+void *app_event_manager_slab_alloc(size_t size, bool dyndata)
+{
+	void *block;
+
+	/* The size classes only hold events without dynamic data. */
+	for (size_t i = 0; slab_ready && !dyndata && (i < slab_class_cnt); i++) {
+		struct slab_class *sc = &slab_classes[i];
+
+		if (sc->slab.info.block_size < size) {
+			continue;
+		}
+
+		if (k_mem_slab_alloc(&sc->slab, &block, K_NO_WAIT)) {
+			atomic_inc(&sc->alloc_fail);
+			return NULL;
+		}
+
+		max_used_update(sc);
+
+		return block;
+	}
+
+	/* Events with dynamic data or allocated before initialization are not taken from a slab. */
+	block = k_malloc(size);
+	if (block) {
+		atomic_inc(&heap_alloc_cnt);
+	}
+
+	return block;
+}
+
+void app_event_manager_slab_free(void *addr)
+{
+	for (size_t i = 0; i < slab_class_cnt; i++) {
+		struct slab_class *sc = &slab_classes[i];
+		const uint8_t *start = sc->slab.buffer;
+		const uint8_t *end = start + sc->slab.info.block_size * sc->slab.info.num_blocks;
+
+		if (((const uint8_t *)addr >= start) && ((const uint8_t *)addr < end)) {
+			k_mem_slab_free(&sc->slab, addr);
+			return;
+		}
+	}
+
+	k_free(addr);
+}
+
+size_t app_event_manager_slab_class_cnt(void)
+{
+	return slab_class_cnt;
+}
+
+int app_event_manager_slab_stats_get(size_t idx, struct app_event_manager_slab_stats *stats)
+{
+	if (idx >= slab_class_cnt) {
+		return -EINVAL;
+	}
+
+	struct slab_class *sc = &slab_classes[idx];
+
+	stats->block_size = sc->slab.info.block_size;
+	stats->num_blocks = sc->slab.info.num_blocks;
+	stats->num_used = k_mem_slab_num_used_get(&sc->slab);
+	stats->max_used = atomic_get(&sc->max_used);
+	stats->alloc_fail = atomic_get(&sc->alloc_fail);
+	stats->type_cnt = sc->type_cnt;
+
+	return 0;
+}
+
+size_t app_event_manager_slab_heap_alloc_cnt(void)
+{
+	return atomic_get(&heap_alloc_cnt);
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Application Event Manager slab allocator.
+ *
+ * Internal interface used by the Application Event Manager and its shell integration.
+ */
+
+#ifndef _APP_EVENT_MANAGER_SLAB_H_
+#define _APP_EVENT_MANAGER_SLAB_H_
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Statistics of a slab allocator size class. */
+struct app_event_manager_slab_stats {
+	/** Size of a block, in bytes. */
+	size_t block_size;
+
+	/** Number of blocks. */
+	size_t num_blocks;
+
+	/** Number of blocks currently allocated. */
+	size_t num_used;
+
+	/** Highest number of blocks allocated at the same time. */
+	size_t max_used;
+
+	/** Number of event types assigned to the size class. */
+	size_t type_cnt;
+
+	/** Number of allocations that failed because all blocks were in use. */
+	uint32_t alloc_fail;
+};
+
+/** @brief Create the size classes from the sizes of the registered event types.
+ *
+ * @return 0 if the operation was successful. Otherwise, a (negative) error code is returned.
+ */
+int app_event_manager_slab_init(void);
+
+/** @brief Allocate an event from the smallest size class that fits it.
+ *
+ * Events with dynamic data and events that do not fit any size class are allocated from the
+ * system heap.
+ *
+ * @param size Size of the event.
+ * @param dyndata True if the event has dynamic data.
+ *
+ * @return Pointer to the allocated event, or NULL if the size class is exhausted.
+ */
+void *app_event_manager_slab_alloc(size_t size, bool dyndata);
+
+/** @brief Free an event allocated with @ref app_event_manager_slab_alloc.
+ *
+ * @param addr Pointer to the event.
+ */
+void app_event_manager_slab_free(void *addr);
+
+/** @brief Get the number of size classes.
+ *
+ * @return Number of size classes.
+ */
+size_t app_event_manager_slab_class_cnt(void);
+
+/** @brief Get the statistics of a size class.
+ *
+ * @param idx   Index of the size class.
+ * @param stats Pointer to the statistics.
+ *
+ * @return 0 if the operation was successful. Otherwise, a (negative) error code is returned.
+ */
+int app_event_manager_slab_stats_get(size_t idx, struct app_event_manager_slab_stats *stats);
+
+/** @brief Get the number of events allocated from the system heap.
+ *
+ * @return Number of events that did not fit any size class.
+ */
+size_t app_event_manager_slab_heap_alloc_cnt(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _APP_EVENT_MANAGER_SLAB_H_ */
@@ -10,7 +10,13 @@
 
 LOG_MODULE_REGISTER(app_event_manager_profiler_tracer, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
-#define IDS_COUNT (CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT + 2)
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_LANE_DELAY)
+#define LANE_DELAY_IDS_COUNT APP_EVENT_LANE_COUNT
+#else
+#define LANE_DELAY_IDS_COUNT 0
+#endif
+
+#define IDS_COUNT (CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT + 2 + LANE_DELAY_IDS_COUNT)
 
 extern struct nrf_profiler_info _nrf_profiler_info_list_start[];
 extern struct nrf_profiler_info _nrf_profiler_info_list_end[];
@@ -45,8 +51,41 @@ static void app_event_manager_trace_event_execution(const struct app_event_heade
 	nrf_profiler_log_send(&buf, trace_evt_id);
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_LANE_DELAY)
+/** @brief Trace the time an event spent in the queue of its processing lane.
+ *
+ * @param aeh        Pointer to the application event header of the event that is
+ *                   processed by app_event_manager.
+ **/
+static void app_event_manager_trace_lane_delay(const struct app_event_header *aeh)
+{
+	size_t event_cnt = _nrf_profiler_info_list_end - _nrf_profiler_info_list_start;
+	enum app_event_lane lane = app_event_get_type_lane(aeh->type_id);
+	size_t trace_evt_id = nrf_profiler_event_ids[event_cnt + 2 + lane];
+	uint32_t delay_cycles = k_cycle_get_32() - aeh->submit_time;
+
+	if (!is_profiling_enabled(trace_evt_id)) {
+		return;
+	}
+
+	struct log_event_buf buf;
+
+	ARG_UNUSED(buf);
+
+	nrf_profiler_log_start(&buf);
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_EVENT_EXECUTION)) {
+		nrf_profiler_log_add_mem_address(&buf, aeh);
+	}
+	nrf_profiler_log_encode_uint32(&buf, k_cyc_to_us_floor32(delay_cycles));
+	nrf_profiler_log_send(&buf, trace_evt_id);
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_LANE_DELAY */
+
 static void app_event_manager_trace_event_preprocess(const struct app_event_header *aeh)
 {
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_LANE_DELAY)
+	app_event_manager_trace_lane_delay(aeh);
+#endif
 	app_event_manager_trace_event_execution(aeh, true);
 }
 
@@ -120,6 +159,28 @@ static void trace_register_execution_tracking_events(void)
 	nrf_profiler_event_ids[event_cnt + 1] = nrf_profiler_event_id;
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_LANE_DELAY)
+static void trace_register_lane_delay_events(void)
+{
+	static const char * const names[] = {
+		[APP_EVENT_LANE_HIGH] = "event_lane_high_delay",
+		[APP_EVENT_LANE_NORMAL] = "event_lane_normal_delay",
+		[APP_EVENT_LANE_LOW] = "event_lane_low_delay",
+	};
+	static const char * const labels[] = {EM_MEM_ADDRESS_LABEL "delay_us"};
+	enum nrf_profiler_arg types[] = {MEM_ADDRESS_TYPE NRF_PROFILER_ARG_U32};
+	size_t event_cnt = _nrf_profiler_info_list_end - _nrf_profiler_info_list_start;
+
+	BUILD_ASSERT(ARRAY_SIZE(names) == APP_EVENT_LANE_COUNT);
+
+	/* Lane delay events after the event execution start and end events. */
+	for (size_t i = 0; i < ARRAY_SIZE(names); i++) {
+		nrf_profiler_event_ids[event_cnt + 2 + i] = nrf_profiler_register_event_type(
+			names[i], labels, types, ARRAY_SIZE(types));
+	}
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_LANE_DELAY */
+
 static void trace_register_events(void)
 {
 	STRUCT_SECTION_FOREACH(nrf_profiler_info, pi) {
@@ -137,6 +198,10 @@ static void trace_register_events(void)
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_EVENT_EXECUTION)) {
 		trace_register_execution_tracking_events();
 	}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROFILER_TRACER_TRACE_LANE_DELAY)
+	trace_register_lane_delay_events();
+#endif
 }
 
 /** @brief Initialize tracing in the Application Event Manager.
@@ -148,10 +213,11 @@ static int app_event_manager_trace_event_init(void)
 {
 	/* Every profiled Application Event Manager event registers a single nrf_profiler event.
 	 * Apart from that 2 additional nrf_profiler events are used to indicate processing
-	 * start and end of an Application Event Manager event.
+	 * start and end of an Application Event Manager event, and one per processing lane
+	 * to indicate the queueing delay.
 	 */
-	__ASSERT_NO_MSG(_nrf_profiler_info_list_end - _nrf_profiler_info_list_start + 2 <=
-			CONFIG_NRF_PROFILER_MAX_NUMBER_OF_APP_EVENTS);
+	__ASSERT_NO_MSG(_nrf_profiler_info_list_end - _nrf_profiler_info_list_start + 2 +
+			LANE_DELAY_IDS_COUNT <= CONFIG_NRF_PROFILER_MAX_NUMBER_OF_APP_EVENTS);
 
 	if (nrf_profiler_init()) {
 		LOG_ERR("System nrf_profiler: initialization problem\n");
@@ -133,6 +133,44 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 	return true;
 }
 
+/**
+ * @brief Helper function to get the reference count of an audio data item.
+ *
+ * @param handle  [in]  The handle of the module that allocated the audio data.
+ * @param data    [in]  Pointer to the audio data item in the module's data slab.
+ *
+ * @return Pointer to the reference count of the audio data item.
+ */
+static atomic_t *data_ref_cnt_get(struct audio_module_handle *handle, void const *const data)
+{
+	struct k_mem_slab *slab = handle->thread.data_slab;
+	size_t idx = ((uint8_t const *)data - (uint8_t const *)slab->buffer) /
+		     slab->info.block_size;
+
+	__ASSERT(idx < ARRAY_SIZE(handle->data_ref_cnt), "Audio data not from module %s slab",
+		 handle->name);
+
+	return &handle->data_ref_cnt[idx];
+}
+
+/**
+ * @brief Helper function to release a reference to an audio data item.
+ *
+ * @note The audio data item is freed when the last reference is released.
+ *
+ * @param handle  [in/out]  The handle of the module that allocated the audio data.
+ * @param data    [in]      Pointer to the audio data item in the module's data slab.
+ */
+static void data_ref_release(struct audio_module_handle *handle, void const *const data)
+{
+	if (atomic_dec(data_ref_cnt_get(handle, data)) == 1) {
+		LOG_DBG("Audio data has been consumed in module %s", handle->name);
+
+		/* Audio data has been consumed by all modules so now can free the data memory. */
+		k_mem_slab_free(handle->thread.data_slab, (void *)data);
+	}
+}
+
 /**
  * @brief General callback for releasing the data when inter-module data
  *        passing.
@@ -143,21 +181,7 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 static void audio_data_release_cb(struct audio_module_handle_private *handle,
 				  struct audio_data const *const audio_data)
 {
-	int ret;
-	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
-
-	ret = k_sem_take(&hdl->sem, K_NO_WAIT);
-	if (ret) {
-		LOG_ERR("Failed to take semaphore for data release callback function");
-		return;
-	}
-
-	if (k_sem_count_get(&hdl->sem) == 0) {
-		LOG_DBG("Audio data has been consumed in module %s", hdl->name);
-
-		/* Audio data has been consumed by all modules so now can free the data memory. */
-		k_mem_slab_free(hdl->thread.data_slab, (void *)audio_data->data);
-	}
+	data_ref_release((struct audio_module_handle *)handle, audio_data->data);
 }
 
 /**
@@ -248,11 +272,6 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 
 		data_fifo_block_free(handle->thread.msg_tx, (void *)data_msg_tx);
 
-		ret = k_sem_take(&handle->sem, K_NO_WAIT);
-		if (ret) {
-			LOG_ERR("Failed to take semaphore for TX FIFO put");
-		}
-
 		return ret;
 	}
 
@@ -274,6 +293,7 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 {
 	int ret;
 	struct audio_module_handle *handle_to;
+	atomic_t *ref_cnt;
 
 	if (handle->dest_count == 0) {
 		LOG_WRN("Nowhere to send the audio data from module %s so releasing it",
@@ -284,63 +304,56 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 		return 0;
 	}
 
-	/* We need to ensure that all receiving modules have got the audio data.
-	 * This is so the first receiver cannot free the audio data before all receivers
-	 * have all gotten the audio data.
+	/* The sending module holds a reference until the audio data has been passed to all
+	 * receivers, so that the first receiver cannot free the audio data before the others
+	 * have gotten it. Each receiver releases its own reference.
 	 */
+	ref_cnt = data_ref_cnt_get(handle, audio_data->data);
+	atomic_set(ref_cnt, 1);
+
 	ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
 	if (ret) {
 		LOG_ERR("Failed to take MUTEX lock in time");
-		return ret;
-	}
-
-	/* Here the semaphore is used as a count of the number of audio data items out in the
-	 * connected modules.
-	 */
-	ret = k_sem_init(&handle->sem, handle->dest_count, handle->dest_count);
-	if (ret) {
-		LOG_ERR("Failed to initiate semaphore");
+		data_ref_release(handle, audio_data->data);
 		return ret;
 	}
 
 	/* Send to all internally connected modules. */
 	SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
+		atomic_inc(ref_cnt);
+
 		ret = data_tx(handle, handle_to, audio_data, &audio_data_release_cb);
 		if (ret) {
 			LOG_ERR("Failed to send audio data to module %s from %s, ret %d",
 				handle_to->name, handle->name, ret);
 
-			return ret;
+			atomic_dec(ref_cnt);
+			break;
 		}
 	}
 
-	ret = k_mutex_unlock(&handle->dest_mutex);
-	if (ret) {
-		LOG_ERR("Failed to release MUTEX");
-		return ret;
-	}
+	k_mutex_unlock(&handle->dest_mutex);
 
 	/* Send to this module's TX FIFO for extraction by an external
 	 * process with audio_module_rx().
 	 */
-	if (handle->use_tx_queue && handle->thread.msg_tx) {
+	if (!ret && handle->use_tx_queue && handle->thread.msg_tx) {
+		atomic_inc(ref_cnt);
+
 		ret = tx_fifo_put(handle, audio_data);
 		if (ret) {
 			LOG_ERR("Failed to send audio data on module %s TX message queue",
 				handle->name);
 
-			ret = k_sem_take(&handle->sem, K_NO_WAIT);
-			if (ret) {
-				LOG_ERR("Failed to take semaphore");
-			}
-
-			return ret;
+			atomic_dec(ref_cnt);
+		} else {
+			LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
 		}
-
-		LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
 	}
 
-	return 0;
+	data_ref_release(handle, audio_data->data);
+
+	return ret;
 }
 
 /**
@@ -561,6 +574,12 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 		return -ECANCELED;
 	}
 
+	if (parameters->thread.data_slab != NULL &&
+	    parameters->thread.data_slab->info.num_blocks > CONFIG_AUDIO_MODULE_DATA_BLOCKS_MAX) {
+		LOG_ERR("Too many blocks in the data slab for module");
+		return -ECANCELED;
+	}
+
 	/* Clear handle to known state. */
 	memset(handle, 0, sizeof(struct audio_module_handle));
 
@@ -695,7 +714,7 @@ int audio_module_close(struct audio_module_handle *handle)
 
 	/*
 	 * TODO: How to return all the data to the slab items?
-	 *       Test the semaphore and wait for it to be zero.
+	 *       Wait for all the data reference counts to be zero.
 	 */
 
 	k_thread_abort(handle->thread_id);
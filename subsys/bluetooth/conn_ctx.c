@@ -9,6 +9,21 @@
 
 LOG_MODULE_REGISTER(bt_conn_ctx, CONFIG_BT_CONN_CTX_LOG_LEVEL);
 
+/* The context of a connection is kept at the connection index, so that it is found without
+ * searching the context array.
+ */
+static struct bt_conn_ctx *ctx_slot_get(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
+{
+	uint8_t index = bt_conn_index(conn);
+
+	if (index >= ARRAY_SIZE(ctx_lib->ctx)) {
+		LOG_WRN("Connection index %u out of range", index);
+		return NULL;
+	}
+
+	return &ctx_lib->ctx[index];
+}
+
 static void bt_conn_ctx_mem_free(struct k_mem_slab *mem_slab, void **data)
 {
 	k_mem_slab_free(mem_slab, *data);
@@ -20,32 +35,28 @@ void *bt_conn_ctx_alloc(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	int err = -ENOMEM;
-	struct bt_conn_ctx *ctx;
+	int err;
+	struct bt_conn_ctx *ctx = ctx_slot_get(ctx_lib, conn);
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
-
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		ctx = &ctx_lib->ctx[i];
-
-		if (!ctx->conn && !ctx->data) {
-			err = k_mem_slab_alloc(ctx_lib->mem_slab,
-					       &ctx->data,
-					       K_NO_WAIT);
-			if (!err) {
-				ctx->conn = conn;
+	if (!ctx) {
+		return NULL;
+	}
 
-				LOG_DBG("The memory for the connection context "
-					"has been allocated, conn %p, index: %u",
-					(void *)conn, i);
+	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
-				return ctx->data;
+	if (!ctx->conn && !ctx->data) {
+		err = k_mem_slab_alloc(ctx_lib->mem_slab, &ctx->data, K_NO_WAIT);
+		if (!err) {
+			ctx->conn = conn;
 
-			} else {
-				break;
-			}
+			LOG_DBG("The memory for the connection context "
+				"has been allocated, conn %p, index: %u",
+				(void *)conn, bt_conn_index(conn));
 
+			return ctx->data;
 		}
+
+		ctx->data = NULL;
 	}
 
 	LOG_WRN("Memory can not be allocated");
@@ -59,24 +70,26 @@ int bt_conn_ctx_free(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
+	struct bt_conn_ctx *ctx = ctx_slot_get(ctx_lib, conn);
 
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
+	if (!ctx) {
+		return -EINVAL;
+	}
 
-		if (ctx->conn == conn) {
-			bt_conn_ctx_mem_free(ctx_lib->mem_slab, &ctx->data);
-			ctx->conn = NULL;
-			ctx->data = NULL;
+	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
-			LOG_DBG("The context memory for the connection "
-				"has been released, conn %p index %u",
-				(void *)conn, i);
+	if (ctx->conn == conn) {
+		bt_conn_ctx_mem_free(ctx_lib->mem_slab, &ctx->data);
+		ctx->conn = NULL;
+		ctx->data = NULL;
 
-			k_mutex_unlock(ctx_lib->mutex);
+		LOG_DBG("The context memory for the connection "
+			"has been released, conn %p index %u",
+			(void *)conn, bt_conn_index(conn));
 
-			return 0;
-		}
+		k_mutex_unlock(ctx_lib->mutex);
+
+		return 0;
 	}
 
 	LOG_WRN("There is no allocated memory for this connection");
@@ -111,16 +124,23 @@ void *bt_conn_ctx_get(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
+	struct bt_conn_ctx *ctx = ctx_slot_get(ctx_lib, conn);
 
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
+	/* The connection is only written with the mutex locked, so a connection without
+	 * a context is reported without locking it. The result is confirmed once locked,
+	 * as the context might have been freed in the meantime.
+	 */
+	if (!ctx || (ctx->conn != conn)) {
+		LOG_WRN("No memory block for connection");
+		return NULL;
+	}
 
-		if (ctx->conn == conn) {
-			LOG_DBG("Memory block found for the connection");
+	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
 
-			return ctx->data;
-		}
+	if (ctx->conn == conn) {
+		LOG_DBG("Memory block found for the connection");
+
+		return ctx->data;
 	}
 
 	LOG_WRN("No memory block for connection");
@@ -153,15 +173,21 @@ void bt_conn_ctx_release(struct bt_conn_ctx_lib *ctx_lib, void *ctx_data)
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 	__ASSERT_NO_MSG(ctx_data != NULL);
 
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
-
-		if (ctx->data == ctx_data) {
-			k_mutex_unlock(ctx_lib->mutex);
+#if defined(CONFIG_ASSERT)
+	/* The context data is always held by one of the contexts, which are only modified
+	 * with the mutex locked. The check scans the contexts, so it is only done with asserts.
+	 */
+	bool found = false;
 
-			return;
+	for (size_t i = 0; i < ARRAY_SIZE(ctx_lib->ctx); i++) {
+		if (ctx_lib->ctx[i].data == ctx_data) {
+			found = true;
+			break;
 		}
 	}
 
-	__ASSERT_NO_MSG(false);
+	__ASSERT(found, "Context data not held by the library instance");
+#endif
+
+	k_mutex_unlock(ctx_lib->mutex);
 }
@@ -8,6 +8,12 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/settings/settings.h>
+#endif
+
 #include <bluetooth/gatt_dm.h>
 
 LOG_MODULE_REGISTER(bt_gatt_dm, CONFIG_BT_GATT_DM_LOG_LEVEL);
@@ -40,6 +46,40 @@ static int gatt_dm_wq_init(void)
 SYS_INIT(gatt_dm_wq_init, POST_KERNEL, CONFIG_BT_GATT_DM_WORKQ_INIT_PRIO);
 #endif
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+#define CACHE_SETTINGS_KEY "bt_dm"
+#define CACHE_VERSION 1
+#define CACHE_DB_HASH_SIZE 16
+#define CACHE_HEADER_SIZE (1 + CACHE_DB_HASH_SIZE)
+/* Length prefixed UUID */
+#define CACHE_UUID_SIZE (1 + BT_UUID_SIZE_128)
+/* Handle, permissions and UUID of the attribute, followed by the value handle, properties
+ * and UUID of a characteristic or the end handle and UUID of a service.
+ */
+#define CACHE_ATTR_SIZE_MAX (2 + 1 + CACHE_UUID_SIZE + 2 + 1 + CACHE_UUID_SIZE)
+#define CACHE_DATA_SIZE (CACHE_HEADER_SIZE + CONFIG_BT_GATT_DM_MAX_ATTRS * CACHE_ATTR_SIZE_MAX)
+
+/* Discovery cache of a bonded peer */
+struct dm_cache {
+	/* Parameters of the Database Hash characteristic read */
+	struct bt_gatt_read_params read_params;
+	/* Work item used to store the cache in the settings. */
+	struct k_work store_work;
+	/* Settings key of the peer and service */
+	char key[SETTINGS_MAX_NAME_LEN + 1];
+	/* Database Hash read from the peer */
+	uint8_t hash[CACHE_DB_HASH_SIZE];
+	/* The Database Hash was read successfully. */
+	bool hash_valid;
+	/* Store the result of the ongoing discovery. */
+	bool store;
+	/* Length of the serialized attributes */
+	size_t data_len;
+	/* Serialized attributes, preceded by the Database Hash */
+	uint8_t data[CACHE_DATA_SIZE];
+};
+#endif
+
 /* Flags for parsed attribute array state */
 enum {
 	STATE_ATTRS_LOCKED,
@@ -92,11 +132,25 @@ struct bt_gatt_dm {
 
 	/* Work item used for discovery callbacks. */
 	struct k_work discover_work;
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	/* Discovery cache of the bonded peer */
+	struct dm_cache cache;
+#endif
 };
 
 /* Currently only one instance is supported */
 static struct bt_gatt_dm bt_gatt_dm_inst;
 
+static void discover_work_submit(struct bt_gatt_dm *dm)
+{
+#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
+	k_work_submit_to_queue(&bt_gatt_dm_wq, &dm->discover_work);
+#else
+	k_work_submit(&dm->discover_work);
+#endif
+}
+
 /* Returns pointer to newly allocated space in a dm->data_chunk */
 static void *user_data_alloc(struct bt_gatt_dm *dm,
 			     size_t len)
@@ -268,10 +322,230 @@ static struct bt_gatt_dm_attr *attr_find_by_handle(
 	return NULL;
 }
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+static void uuid_push(struct net_buf_simple *buf, const struct bt_uuid *uuid)
+{
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		net_buf_simple_add_u8(buf, BT_UUID_SIZE_16);
+		net_buf_simple_add_le16(buf, BT_UUID_16(uuid)->val);
+		break;
+	case BT_UUID_TYPE_32:
+		net_buf_simple_add_u8(buf, BT_UUID_SIZE_32);
+		net_buf_simple_add_le32(buf, BT_UUID_32(uuid)->val);
+		break;
+	case BT_UUID_TYPE_128:
+		net_buf_simple_add_u8(buf, BT_UUID_SIZE_128);
+		net_buf_simple_add_mem(buf, BT_UUID_128(uuid)->val, BT_UUID_SIZE_128);
+		break;
+	default:
+		__ASSERT(false, "Unsupported UUID type.");
+		break;
+	}
+}
+
+static int uuid_pull(struct net_buf_simple *buf, struct bt_uuid *uuid)
+{
+	uint8_t len;
+
+	if (buf->len < 1) {
+		return -EINVAL;
+	}
+
+	len = net_buf_simple_pull_u8(buf);
+	if ((buf->len < len) ||
+	    !bt_uuid_create(uuid, net_buf_simple_pull_mem(buf, len), len)) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Serializes the discovered attributes and stores them in the settings. */
+static void cache_save(struct bt_gatt_dm *dm)
+{
+	struct dm_cache *cache = &dm->cache;
+	struct net_buf_simple buf;
+
+	net_buf_simple_init_with_data(&buf, cache->data, sizeof(cache->data));
+	net_buf_simple_reset(&buf);
+
+	net_buf_simple_add_u8(&buf, CACHE_VERSION);
+	net_buf_simple_add_mem(&buf, cache->hash, sizeof(cache->hash));
+
+	for (size_t i = 0; i < dm->cur_attr_id; i++) {
+		const struct bt_gatt_dm_attr *attr = &dm->attrs[i];
+		const struct bt_gatt_service_val *service_val;
+		const struct bt_gatt_chrc *chrc;
+
+		uuid_push(&buf, attr->uuid);
+		net_buf_simple_add_le16(&buf, attr->handle);
+		net_buf_simple_add_u8(&buf, attr->perm);
+
+		service_val = bt_gatt_dm_attr_service_val(attr);
+		chrc = bt_gatt_dm_attr_chrc_val(attr);
+
+		if (service_val) {
+			net_buf_simple_add_le16(&buf, service_val->end_handle);
+			uuid_push(&buf, service_val->uuid);
+		} else if (chrc) {
+			net_buf_simple_add_le16(&buf, chrc->value_handle);
+			net_buf_simple_add_u8(&buf, chrc->properties);
+			uuid_push(&buf, chrc->uuid);
+		}
+	}
+
+	cache->data_len = buf.len;
+	k_work_submit(&cache->store_work);
+}
+
+/* Recreates the discovered attributes from the serialized ones. */
+static int cache_restore(struct bt_gatt_dm *dm)
+{
+	struct dm_cache *cache = &dm->cache;
+	struct net_buf_simple buf;
+	struct bt_gatt_dm_attr *cur_attr;
+	struct bt_gatt_service_val *service_val;
+	struct bt_gatt_chrc *chrc;
+	struct bt_uuid_128 attr_uuid;
+	struct bt_uuid_128 val_uuid;
+	struct bt_gatt_attr attr = {
+		.uuid = &attr_uuid.uuid,
+	};
+
+	net_buf_simple_init_with_data(&buf, cache->data, cache->data_len);
+	net_buf_simple_pull(&buf, CACHE_HEADER_SIZE);
+
+	while (buf.len) {
+		if (uuid_pull(&buf, &attr_uuid.uuid) || (buf.len < 3)) {
+			return -EINVAL;
+		}
+
+		attr.handle = net_buf_simple_pull_le16(&buf);
+		attr.perm = net_buf_simple_pull_u8(&buf);
+
+		if (!bt_uuid_cmp(attr.uuid, BT_UUID_GATT_PRIMARY) ||
+		    !bt_uuid_cmp(attr.uuid, BT_UUID_GATT_SECONDARY)) {
+			cur_attr = attr_store(dm, &attr, sizeof(*service_val));
+			if (!cur_attr || (buf.len < 2)) {
+				return -EINVAL;
+			}
+
+			service_val = bt_gatt_dm_attr_service_val(cur_attr);
+			service_val->end_handle = net_buf_simple_pull_le16(&buf);
+			if (uuid_pull(&buf, &val_uuid.uuid)) {
+				return -EINVAL;
+			}
+
+			service_val->uuid = uuid_store(dm, &val_uuid.uuid);
+			if (!service_val->uuid) {
+				return -ENOMEM;
+			}
+
+			dm->discover_params.end_handle = service_val->end_handle;
+		} else if (!bt_uuid_cmp(attr.uuid, BT_UUID_GATT_CHRC)) {
+			cur_attr = attr_store(dm, &attr, sizeof(*chrc));
+			if (!cur_attr || (buf.len < 3)) {
+				return -EINVAL;
+			}
+
+			chrc = bt_gatt_dm_attr_chrc_val(cur_attr);
+			chrc->value_handle = net_buf_simple_pull_le16(&buf);
+			chrc->properties = net_buf_simple_pull_u8(&buf);
+			if (uuid_pull(&buf, &val_uuid.uuid)) {
+				return -EINVAL;
+			}
+
+			chrc->uuid = uuid_store(dm, &val_uuid.uuid);
+			if (!chrc->uuid) {
+				return -ENOMEM;
+			}
+		} else if (!attr_store(dm, &attr, 0)) {
+			return -ENOMEM;
+		}
+	}
+
+	/* The first attribute must be the service. */
+	if (!dm->cur_attr_id || !bt_gatt_dm_attr_service_val(&dm->attrs[0])) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static bool cache_hash_match(const struct dm_cache *cache)
+{
+	return cache->hash_valid &&
+	       (cache->data_len >= CACHE_HEADER_SIZE) &&
+	       (cache->data[0] == CACHE_VERSION) &&
+	       !memcmp(&cache->data[1], cache->hash, sizeof(cache->hash));
+}
+
+static void cache_store_work(struct k_work *work)
+{
+	struct dm_cache *cache = CONTAINER_OF(work, struct dm_cache, store_work);
+	int err;
+
+	err = settings_save_one(cache->key, cache->data, cache->data_len);
+	if (err) {
+		LOG_WRN("Failed to store discovery cache, error: %d.", err);
+	} else {
+		LOG_DBG("Discovery cache stored: %s", cache->key);
+	}
+}
+
+static int cache_load_cb(const char *key, size_t len, settings_read_cb read_cb,
+			 void *cb_arg, void *param)
+{
+	struct dm_cache *cache = param;
+	ssize_t read_len;
+
+	/* Only the exact key is of interest. */
+	if (key || (len < CACHE_HEADER_SIZE) || (len > sizeof(cache->data))) {
+		return 0;
+	}
+
+	read_len = read_cb(cb_arg, cache->data, len);
+	cache->data_len = (read_len > 0) ? read_len : 0;
+
+	return 0;
+}
+
+static int cache_peer_key_get(char *key, size_t size, uint8_t id, const bt_addr_le_t *addr)
+{
+	char addr_str[2 * sizeof(addr->a.val) + 1];
+
+	bin2hex(addr->a.val, sizeof(addr->a.val), addr_str, sizeof(addr_str));
+
+	return snprintk(key, size, CACHE_SETTINGS_KEY "/%u/%s%u", id, addr_str, addr->type);
+}
+
+static int cache_key_get(char *key, size_t size, uint8_t id, const bt_addr_le_t *addr,
+			 const struct bt_uuid *svc_uuid)
+{
+	char uuid_str[BT_UUID_STR_LEN];
+	int len;
+
+	bt_uuid_to_str(svc_uuid, uuid_str, sizeof(uuid_str));
+	len = cache_peer_key_get(key, size, id, addr);
+	len += snprintk(&key[len], size - len, "/%s", uuid_str);
+
+	return (len < size) ? 0 : -ENAMETOOLONG;
+}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 static void discovery_complete(struct bt_gatt_dm *dm)
 {
 	LOG_DBG("Discovery complete.");
 	atomic_set_bit(dm->state_flags, STATE_ATTRS_RELEASE_PENDING);
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	if (dm->cache.store) {
+		dm->cache.store = false;
+		cache_save(dm);
+	}
+#endif
+
 	if (dm->callback->completed) {
 		dm->callback->completed(dm, dm->context);
 	}
@@ -315,6 +589,143 @@ static void gatt_discover_work(struct k_work *work)
 	}
 }
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+static uint8_t db_hash_read_cb(struct bt_conn *conn, uint8_t err,
+			       struct bt_gatt_read_params *params,
+			       const void *data, uint16_t length)
+{
+	struct bt_gatt_dm *dm = &bt_gatt_dm_inst;
+	struct dm_cache *cache = &dm->cache;
+
+	if (!err && data && (length == sizeof(cache->hash))) {
+		memcpy(cache->hash, data, length);
+		cache->hash_valid = true;
+	} else {
+		LOG_DBG("Database Hash not available, error: %u.", err);
+	}
+
+	if (cache_hash_match(cache)) {
+		if (!cache_restore(dm)) {
+			LOG_DBG("Discovery data restored from cache.");
+			discovery_complete(dm);
+			return BT_GATT_ITER_STOP;
+		}
+
+		LOG_WRN("Invalid discovery cache, starting full discovery.");
+		svc_attr_memory_release(dm);
+	}
+
+	/* Without the Database Hash the result could not be validated later. */
+	cache->store = cache->hash_valid;
+	discover_work_submit(dm);
+
+	return BT_GATT_ITER_STOP;
+}
+
+/* Loads the cached discovery data of a bonded peer and reads its Database Hash to validate it.
+ * Returns 0 if the read was started.
+ */
+static int cache_lookup(struct bt_gatt_dm *dm)
+{
+	struct dm_cache *cache = &dm->cache;
+	struct bt_conn_info info;
+	int err;
+
+	/* The buffer is still in use by the result of the previous discovery. */
+	if (k_work_busy_get(&cache->store_work)) {
+		return -EBUSY;
+	}
+
+	cache->store = false;
+	cache->hash_valid = false;
+	cache->data_len = 0;
+
+	err = bt_conn_get_info(dm->conn, &info);
+	if (err) {
+		return err;
+	}
+
+	if ((info.type != BT_CONN_TYPE_LE) || !bt_addr_le_is_bonded(info.id, info.le.dst)) {
+		return -ENOENT;
+	}
+
+	err = cache_key_get(cache->key, sizeof(cache->key), info.id, info.le.dst,
+			    &dm->svc_uuid.uuid);
+	if (err) {
+		return err;
+	}
+
+	err = settings_load_subtree_direct(cache->key, cache_load_cb, cache);
+	if (err) {
+		LOG_WRN("Failed to load discovery cache, error: %d.", err);
+		cache->data_len = 0;
+	}
+
+	cache->read_params.func = db_hash_read_cb;
+	cache->read_params.handle_count = 0;
+	cache->read_params.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+	cache->read_params.by_uuid.start_handle = BT_ATT_FIRST_ATTRIBUTE_HANDLE;
+	cache->read_params.by_uuid.end_handle = BT_ATT_LAST_ATTRIBUTE_HANDLE;
+
+	return bt_gatt_read(dm->conn, &cache->read_params);
+}
+
+static int cache_find_cb(const char *key, size_t len, settings_read_cb read_cb,
+			 void *cb_arg, void *param)
+{
+	char *name = param;
+
+	/* Skip the deleted entries. */
+	if (!key || !len) {
+		return 0;
+	}
+
+	snprintk(name, SETTINGS_MAX_NAME_LEN + 1, "%s", key);
+
+	/* Stop at the first entry found. */
+	return 1;
+}
+
+static void cache_bond_deleted(uint8_t id, const bt_addr_le_t *peer)
+{
+	char peer_key[SETTINGS_MAX_NAME_LEN + 1];
+	char key[SETTINGS_MAX_NAME_LEN + 1];
+	char name[SETTINGS_MAX_NAME_LEN + 1];
+	int err;
+
+	cache_peer_key_get(peer_key, sizeof(peer_key), id, peer);
+
+	do {
+		name[0] = '\0';
+
+		err = settings_load_subtree_direct(peer_key, cache_find_cb, name);
+		if (err || !name[0]) {
+			break;
+		}
+
+		snprintk(key, sizeof(key), "%s/%s", peer_key, name);
+		err = settings_delete(key);
+	} while (!err);
+
+	if (err) {
+		LOG_WRN("Failed to delete discovery cache, error: %d.", err);
+	}
+}
+
+static struct bt_conn_auth_info_cb cache_auth_info_cb = {
+	.bond_deleted = cache_bond_deleted,
+};
+
+static int gatt_dm_cache_init(void)
+{
+	k_work_init(&bt_gatt_dm_inst.cache.store_work, cache_store_work);
+
+	return bt_conn_auth_info_cb_register(&cache_auth_info_cb);
+}
+
+SYS_INIT(gatt_dm_cache_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 static uint8_t discovery_process_service(struct bt_gatt_dm *dm,
 				      const struct bt_gatt_attr *attr,
 				      struct bt_gatt_discover_params *params)
@@ -373,11 +784,7 @@ static uint8_t discovery_process_service(struct bt_gatt_dm *dm,
 	dm->discover_params.start_handle = cur_attr->handle + 1;
 	LOG_DBG("Starting descriptors discovery");
 
-#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
-	k_work_submit_to_queue(&bt_gatt_dm_wq, &dm->discover_work);
-#else
-	k_work_submit(&dm->discover_work);
-#endif
+	discover_work_submit(dm);
 
 	return BT_GATT_ITER_STOP;
 }
@@ -396,11 +803,7 @@ static uint8_t discovery_process_attribute(struct bt_gatt_dm *dm,
 			dm->discover_params.type =
 				BT_GATT_DISCOVER_CHARACTERISTIC;
 
-#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
-			k_work_submit_to_queue(&bt_gatt_dm_wq, &dm->discover_work);
-#else
-			k_work_submit(&dm->discover_work);
-#endif
+			discover_work_submit(dm);
 		} else {
 			discovery_complete(dm);
 		}
@@ -679,6 +1082,13 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 	k_work_init(&dm->discover_work, gatt_discover_work);
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	/* The discovery continues once the Database Hash is read. */
+	if (svc_uuid && !cache_lookup(dm)) {
+		return 0;
+	}
+#endif
+
 	err = bt_gatt_discover(conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
@@ -20,11 +20,33 @@ LOG_MODULE_REGISTER(bt_mesh_rpl);
 
 static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
 
-EMDS_STATIC_ENTRY_DEFINE(rpl_store, CONFIG_BT_MESH_RPL_INDEX, replay_list, sizeof(replay_list));
+EMDS_STATIC_ENTRY_TRACKED_DEFINE(rpl_store, CONFIG_BT_MESH_RPL_INDEX, replay_list,
+				 sizeof(replay_list));
+
+/* With incremental snapshots, a change and its report must not be split by the emergency data
+ * store, which only stores the reported changes.
+ */
+static unsigned int rpl_lock(void)
+{
+	if (IS_ENABLED(CONFIG_EMDS_INCREMENTAL)) {
+		return irq_lock();
+	}
+
+	return 0;
+}
+
+static void rpl_unlock(unsigned int key)
+{
+	if (IS_ENABLED(CONFIG_EMDS_INCREMENTAL)) {
+		irq_unlock(key);
+	}
+}
 
 void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		struct bt_mesh_net_rx *rx)
 {
+	unsigned int key = rpl_lock();
+
 	/* If this is the first message on the new IV index, we should reset it
 	 * to zero to avoid invalid combinations of IV index and seg.
 	 */
@@ -35,6 +57,11 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 	rpl->src = rx->ctx.addr;
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
+
+	emds_entry_dirty_mark(&emds_rpl_store, (uint8_t *)rpl - (uint8_t *)replay_list,
+			      sizeof(*rpl));
+
+	rpl_unlock(key);
 }
 
 /* Check the Replay Protection List for a replay attempt. If non-NULL match
@@ -98,13 +125,20 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 
 void bt_mesh_rpl_clear(void)
 {
+	unsigned int key = rpl_lock();
+
 	(void)memset(replay_list, 0, sizeof(replay_list));
+
+	emds_entry_dirty_mark(&emds_rpl_store, 0, sizeof(replay_list));
+
+	rpl_unlock(key);
 }
 
 void bt_mesh_rpl_reset(void)
 {
 	int shift = 0;
 	int last = 0;
+	unsigned int key = rpl_lock();
 
 	/* Discard "old" IV Index entries from RPL and flag
 	 * any other ones (which are valid) as old.
@@ -130,6 +164,10 @@ void bt_mesh_rpl_reset(void)
 	}
 
 	(void) memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+
+	emds_entry_dirty_mark(&emds_rpl_store, 0, sizeof(replay_list));
+
+	rpl_unlock(key);
 }
 
 void bt_mesh_rpl_pending_store(uint16_t addr)
@@ -18,6 +18,20 @@ LOG_MODULE_REGISTER(nrf_bt_scan, CONFIG_BT_SCAN_LOG_LEVEL);
 	BT_SCAN_SHORT_NAME_FILTER | BT_SCAN_APPEARANCE_FILTER | \
 	BT_SCAN_UUID_FILTER | BT_SCAN_MANUFACTURER_DATA_FILTER)
 
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+/* Hash tables hold the filter index incremented by one, 0 marks an empty slot.
+ * They are at least twice as big as the filter arrays to keep the probe sequences short.
+ */
+#define ADDR_HASH_SIZE NHPOT(2 * CONFIG_BT_SCAN_ADDRESS_CNT)
+#define UUID_HASH_SIZE NHPOT(2 * CONFIG_BT_SCAN_UUID_CNT)
+
+/* Number of words in the bitmap of matched UUID filters. */
+#define UUID_FOUND_WORDS MAX(DIV_ROUND_UP(CONFIG_BT_SCAN_UUID_CNT, 32), 1)
+
+/* Number of words in the bitmap of advertising data types. */
+#define AD_TYPE_WORDS (256 / 32)
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
 /* Scan filter mutex. */
 K_MUTEX_DEFINE(scan_mutex);
 
@@ -89,6 +103,11 @@ struct bt_scan_addr_filter {
 	/* Addresses advertised by the peripherals. */
 	bt_addr_le_t target_addr[CONFIG_BT_SCAN_ADDRESS_CNT];
 
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	/* Hash table of the addresses. */
+	uint8_t hash[ADDR_HASH_SIZE];
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
 	/* Address filter counter. */
 	uint8_t cnt;
 
@@ -120,6 +139,11 @@ struct bt_scan_uuid_filter {
 	 */
 	struct bt_scan_uuid uuid[CONFIG_BT_SCAN_UUID_CNT];
 
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	/* Hash table of the UUIDs. */
+	uint8_t hash[UUID_HASH_SIZE];
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
 	/* UUID filter counter. */
 	uint8_t cnt;
 
@@ -194,9 +218,69 @@ struct bt_scan_filters {
 	 * matched to generate an event.
 	 */
 	bool all_mode;
+
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	/* Number of enabled filters. */
+	uint8_t enabled_cnt;
+
+	/* Bitmap of the advertising data types checked by the enabled filters. */
+	uint32_t ad_types[AD_TYPE_WORDS];
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
 };
 
-#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
+#if CONFIG_BT_SCAN_DEVICE_HASH
+/* Address table entry. */
+struct addr_table_entry {
+	/* Device address. */
+	bt_addr_le_t addr;
+
+	/* Set when the device is seen, cleared by the eviction sweep. */
+	uint8_t referenced;
+
+	/* Value kept for the device, the number of the connection attempts. */
+	uint16_t value;
+};
+
+/* Open-addressing hash table of device addresses. When the table is full, adding a device
+ * evicts one not seen recently. Lookups are lock-free: writers hold scan_mutex and make
+ * the sequence counter odd while they modify the table, and readers retry if it changed.
+ */
+struct addr_table {
+	/* Table entries. */
+	struct addr_table_entry *entries;
+
+	/* Hash slots holding the entry index incremented by one, 0 marks an empty slot. */
+	uint16_t *slots;
+
+	/* Number of entries. */
+	uint16_t capacity;
+
+	/* Number of slots decremented by one. */
+	uint16_t slot_mask;
+
+	/* Number of used entries. */
+	uint16_t count;
+
+	/* Next entry checked by the eviction sweep. */
+	uint16_t hand;
+
+	/* Sequence counter, odd while the table is modified. */
+	atomic_t seq;
+};
+
+/* There are at least twice as many slots as entries to keep the probe sequences short. */
+#define ADDR_TABLE_DEFINE(_name, _capacity)					\
+	static struct addr_table_entry _name##_entries[_capacity];		\
+	static uint16_t _name##_slots[NHPOT(2 * (_capacity))];			\
+	static struct addr_table _name = {					\
+		.entries = _name##_entries,					\
+		.slots = _name##_slots,						\
+		.capacity = (_capacity),					\
+		.slot_mask = NHPOT(2 * (_capacity)) - 1,			\
+	}
+#endif /* CONFIG_BT_SCAN_DEVICE_HASH */
+
+#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER && !CONFIG_BT_SCAN_DEVICE_HASH
 /* Connection attempts filter device */
 struct conn_attempts_device {
 	/* Filtered device address. */
@@ -217,9 +301,9 @@ struct conn_attempts_filter {
 	/* Count of the filtered devices. */
 	size_t count;
 };
-#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
+#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER && !CONFIG_BT_SCAN_DEVICE_HASH */
 
-#if CONFIG_BT_SCAN_BLOCKLIST
+#if CONFIG_BT_SCAN_BLOCKLIST && !CONFIG_BT_SCAN_DEVICE_HASH
 /* Connection blocklist */
 struct conn_blocklist {
 	/* Array of the blocklist devices. */
@@ -228,7 +312,27 @@ struct conn_blocklist {
 	/* Blocklist device count. */
 	uint32_t count;
 };
-#endif /* CONFIG_BT_SCAN_BLOCKLIST */
+#endif /* CONFIG_BT_SCAN_BLOCKLIST && !CONFIG_BT_SCAN_DEVICE_HASH */
+
+#if CONFIG_BT_SCAN_STATS
+/* Filter statistics. */
+struct scan_stats {
+	/* Protects the statistics. */
+	struct k_spinlock lock;
+
+	/* Statistics reported to the application. */
+	struct bt_scan_stats stats;
+
+	/* Start of the current rate measurement window, in milliseconds. */
+	uint32_t window_start;
+
+	/* Reports processed in the current window. */
+	uint32_t window_reports;
+
+	/* Reports matched in the current window. */
+	uint32_t window_matched;
+};
+#endif /* CONFIG_BT_SCAN_STATS */
 
 /* Scanning module instance. Options for the different scanning modes.
  * This structure stores all module settings. It is used to enable
@@ -256,15 +360,20 @@ static struct bt_scan {
 	 */
 	struct bt_le_conn_param conn_param;
 
-#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
+#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER && !CONFIG_BT_SCAN_DEVICE_HASH
 	/* Scan Connection attempts filter. */
 	struct conn_attempts_filter attempts_filter;
-#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
+#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER && !CONFIG_BT_SCAN_DEVICE_HASH */
 
-#if CONFIG_BT_SCAN_BLOCKLIST
+#if CONFIG_BT_SCAN_BLOCKLIST && !CONFIG_BT_SCAN_DEVICE_HASH
 	/* Scan device blocklist. */
 	struct conn_blocklist blocklist;
-#endif /* CONFIG_BT_SCAN_BLOCKLIST */
+#endif /* CONFIG_BT_SCAN_BLOCKLIST && !CONFIG_BT_SCAN_DEVICE_HASH */
+
+#if CONFIG_BT_SCAN_STATS
+	/* Filter statistics. */
+	struct scan_stats stats;
+#endif /* CONFIG_BT_SCAN_STATS */
 
 } bt_scan;
 
@@ -330,7 +439,208 @@ static void notify_connecting_error(struct bt_scan_device_info *device_info)
 }
 #endif /* CONFIG_BT_CENTRAL */
 
-#if CONFIG_BT_SCAN_BLOCKLIST
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED || CONFIG_BT_SCAN_DEVICE_HASH
+static uint32_t hash_mix(uint32_t key)
+{
+	/* Multiplicative hashing, the middle bits of the product are the best mixed. */
+	return (key * 2654435761U) >> 16;
+}
+
+static uint32_t addr_hash(const bt_addr_le_t *addr)
+{
+	return hash_mix(sys_get_le32(addr->a.val) ^
+			(sys_get_le16(&addr->a.val[4]) << 8) ^ addr->type);
+}
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED || CONFIG_BT_SCAN_DEVICE_HASH */
+
+#if CONFIG_BT_SCAN_DEVICE_HASH
+/* Returns the slot holding the address, or the empty slot ending its probe sequence.
+ * The table is never full, so the probe sequence always ends.
+ */
+static uint32_t addr_table_slot_find(const struct addr_table *table,
+				     const bt_addr_le_t *addr)
+{
+	uint32_t i = addr_hash(addr) & table->slot_mask;
+	uint16_t idx;
+
+	for (;; i = (i + 1) & table->slot_mask) {
+		idx = table->slots[i];
+		if (!idx || (bt_addr_le_cmp(&table->entries[idx - 1].addr, addr) == 0)) {
+			return i;
+		}
+	}
+}
+
+static void addr_table_write_begin(struct addr_table *table)
+{
+	/* Readers in other threads cannot preempt the writer and spin on an odd counter. */
+	k_sched_lock();
+	atomic_inc(&table->seq);
+}
+
+static void addr_table_write_end(struct addr_table *table)
+{
+	atomic_inc(&table->seq);
+	k_sched_unlock();
+}
+
+static bool addr_table_find(struct addr_table *table, const bt_addr_le_t *addr,
+			    uint16_t *value)
+{
+	struct addr_table_entry *entry = NULL;
+	atomic_val_t seq;
+	uint16_t val = 0;
+	uint16_t idx;
+
+	do {
+		seq = atomic_get(&table->seq);
+
+		idx = table->slots[addr_table_slot_find(table, addr)];
+		if (idx) {
+			entry = &table->entries[idx - 1];
+			val = entry->value;
+		}
+	} while ((seq & 1) || (seq != atomic_get(&table->seq)));
+
+	if (!idx) {
+		return false;
+	}
+
+	/* A racing eviction can make this mark another entry, which only delays its eviction. */
+	entry->referenced = 1;
+
+	if (value) {
+		*value = val;
+	}
+
+	return true;
+}
+
+/* Backward shift deletion, which keeps the probe sequences of the other entries intact. */
+static void addr_table_slot_remove(struct addr_table *table, uint32_t i)
+{
+	uint32_t j = i;
+	uint32_t home;
+
+	for (;;) {
+		j = (j + 1) & table->slot_mask;
+		if (!table->slots[j]) {
+			break;
+		}
+
+		/* Move the entry back unless its home slot is cyclically in (i, j]. */
+		home = addr_hash(&table->entries[table->slots[j] - 1].addr) & table->slot_mask;
+		if (((j - home) & table->slot_mask) >= ((j - i) & table->slot_mask)) {
+			table->slots[i] = table->slots[j];
+			i = j;
+		}
+	}
+
+	table->slots[i] = 0;
+}
+
+/* Second chance approximation of LRU: entries seen since the previous sweep are skipped. */
+static uint16_t addr_table_evict(struct addr_table *table)
+{
+	struct addr_table_entry *entry;
+
+	for (;;) {
+		entry = &table->entries[table->hand];
+		table->hand = (table->hand + 1) % table->capacity;
+
+		if (!entry->referenced) {
+			break;
+		}
+
+		entry->referenced = 0;
+	}
+
+	addr_table_slot_remove(table, addr_table_slot_find(table, &entry->addr));
+
+	return entry - table->entries;
+}
+
+/* Must be called with scan_mutex held. */
+static int addr_table_add(struct addr_table *table, const bt_addr_le_t *addr)
+{
+	uint32_t slot = addr_table_slot_find(table, addr);
+	bt_addr_le_t evicted_addr;
+	bool evicted = false;
+	uint16_t idx;
+
+	if (table->slots[slot]) {
+		table->entries[table->slots[slot] - 1].referenced = 1;
+
+		return -EALREADY;
+	}
+
+	addr_table_write_begin(table);
+
+	if (table->count < table->capacity) {
+		idx = table->count++;
+	} else {
+		idx = addr_table_evict(table);
+		bt_addr_le_copy(&evicted_addr, &table->entries[idx].addr);
+		evicted = true;
+
+		/* The eviction could move the end of the probe sequence. */
+		slot = addr_table_slot_find(table, addr);
+	}
+
+	bt_addr_le_copy(&table->entries[idx].addr, addr);
+	table->entries[idx].value = 0;
+	table->entries[idx].referenced = 1;
+	table->slots[slot] = idx + 1;
+
+	addr_table_write_end(table);
+
+	/* Logged after the write, as the scheduler is locked while the table is written. */
+	if (IS_ENABLED(CONFIG_BT_SCAN_LOG_LEVEL_DBG) && evicted) {
+		char addr_str[BT_ADDR_LE_STR_LEN];
+
+		bt_addr_le_to_str(&evicted_addr, addr_str, sizeof(addr_str));
+		LOG_DBG("Device %s evicted", addr_str);
+	}
+
+	return 0;
+}
+
+/* Must be called with scan_mutex held. */
+static void addr_table_value_inc(struct addr_table *table, const bt_addr_le_t *addr,
+				 uint16_t max)
+{
+	uint16_t idx = table->slots[addr_table_slot_find(table, addr)];
+
+	if (!idx || (table->entries[idx - 1].value >= max)) {
+		return;
+	}
+
+	addr_table_write_begin(table);
+	table->entries[idx - 1].value++;
+	addr_table_write_end(table);
+}
+
+/* Must be called with scan_mutex held. */
+static void addr_table_clear(struct addr_table *table)
+{
+	addr_table_write_begin(table);
+
+	memset(table->slots, 0, (table->slot_mask + 1) * sizeof(table->slots[0]));
+	table->count = 0;
+	table->hand = 0;
+
+	addr_table_write_end(table);
+}
+#endif /* CONFIG_BT_SCAN_DEVICE_HASH */
+
+#if CONFIG_BT_SCAN_BLOCKLIST && CONFIG_BT_SCAN_DEVICE_HASH
+ADDR_TABLE_DEFINE(blocklist_table, CONFIG_BT_SCAN_BLOCKLIST_LEN);
+
+static bool blocklist_device_check(const bt_addr_le_t *addr)
+{
+	return addr_table_find(&blocklist_table, addr, NULL);
+}
+#elif CONFIG_BT_SCAN_BLOCKLIST
 static bool blocklist_device_check(const bt_addr_le_t *addr)
 {
 	bool blocklist_device = false;
@@ -351,7 +661,35 @@ static bool blocklist_device_check(const bt_addr_le_t *addr)
 }
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
-#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
+#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER && CONFIG_BT_SCAN_DEVICE_HASH
+ADDR_TABLE_DEFINE(attempts_table, CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER_LEN);
+
+static void scan_attempts_filter_device_add(const bt_addr_le_t *addr)
+{
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+	(void)addr_table_add(&attempts_table, addr);
+	k_mutex_unlock(&scan_mutex);
+}
+
+static void device_conn_attempts_count(struct bt_conn *conn)
+{
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+	addr_table_value_inc(&attempts_table, bt_conn_get_dst(conn),
+			     CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT);
+	k_mutex_unlock(&scan_mutex);
+}
+
+static bool conn_attempts_exceeded(const bt_addr_le_t *addr)
+{
+	uint16_t attempts;
+
+	if (!addr_table_find(&attempts_table, addr, &attempts)) {
+		return false;
+	}
+
+	return attempts >= CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT;
+}
+#elif CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
 static void attempts_filter_force_add(struct conn_attempts_filter *filter,
 				      const bt_addr_le_t *addr)
 {
@@ -506,9 +844,51 @@ static void scan_connect_with_target(struct bt_scan_control *control,
 }
 #endif /* CONFIG_BT_CENTRAL */
 
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+static const bt_addr_le_t *addr_filter_find(const bt_addr_le_t *target_addr)
+{
+	const struct bt_scan_addr_filter *addr_filter = &bt_scan.scan_filters.addr;
+	uint32_t i = addr_hash(target_addr);
+	uint8_t slot;
+
+	/* The table is never full, so the probe sequence ends with an empty slot. */
+	for (;; i++) {
+		slot = addr_filter->hash[i & (ADDR_HASH_SIZE - 1)];
+		if (!slot) {
+			return NULL;
+		}
+
+		if (bt_addr_le_cmp(target_addr, &addr_filter->target_addr[slot - 1]) == 0) {
+			return &addr_filter->target_addr[slot - 1];
+		}
+	}
+}
+
+static void addr_filter_hash_add(uint8_t idx)
+{
+	uint8_t *hash = bt_scan.scan_filters.addr.hash;
+	uint32_t i = addr_hash(&bt_scan.scan_filters.addr.target_addr[idx]);
+
+	while (hash[i & (ADDR_HASH_SIZE - 1)]) {
+		i++;
+	}
+
+	hash[i & (ADDR_HASH_SIZE - 1)] = idx + 1;
+}
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
 static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 			     struct bt_scan_control *control)
 {
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	const bt_addr_le_t *addr = addr_filter_find(target_addr);
+
+	if (addr) {
+		control->filter_status.addr.addr = addr;
+
+		return true;
+	}
+#else
 	const bt_addr_le_t *addr =
 			bt_scan.scan_filters.addr.target_addr;
 	uint8_t counter = bt_scan.scan_filters.addr.cnt;
@@ -520,6 +900,7 @@ static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 			return true;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
 
 	return false;
 }
@@ -556,15 +937,25 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	}
 
 	/* Check for duplicated filter. */
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	if (addr_filter_find(target_addr)) {
+		return 0;
+	}
+#else
 	for (size_t i = 0; i < counter; i++) {
 		if (bt_addr_le_cmp(target_addr, &addr_filter[i]) == 0) {
 			return 0;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
 
 	/* Add target address to filter. */
 	bt_addr_le_copy(&addr_filter[counter], target_addr);
 
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	addr_filter_hash_add(counter);
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
 	LOG_DBG("Filter set on address type %i",
 		addr_filter[counter].type);
 
@@ -764,27 +1155,119 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 	return 0;
 }
 
-static bool find_uuid(const uint8_t *data,
-		      uint8_t data_len,
-		      uint8_t uuid_type,
-		      const struct bt_scan_uuid *target_uuid)
+static uint8_t uuid_len_get(uint8_t uuid_type)
 {
-	uint8_t uuid_len;
-
 	switch (uuid_type) {
 	case BT_UUID_TYPE_16:
-		uuid_len = sizeof(uint16_t);
-		break;
+		return sizeof(uint16_t);
 
 	case BT_UUID_TYPE_32:
-		uuid_len = sizeof(uint32_t);
-		break;
+		return sizeof(uint32_t);
 
 	case BT_UUID_TYPE_128:
-		uuid_len = BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
-		break;
+		return BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
 
 	default:
+		return 0;
+	}
+}
+
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+static uint32_t uuid_hash(const struct bt_uuid *uuid)
+{
+	static const struct bt_uuid_128 base_uuid = BT_UUID_INIT_128(
+		BT_UUID_128_ENCODE(0x00000000, 0x0000, 0x1000, 0x8000, 0x00805F9B34FB));
+	const uint8_t *val;
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		return hash_mix(BT_UUID_16(uuid)->val);
+
+	case BT_UUID_TYPE_32:
+		return hash_mix(BT_UUID_32(uuid)->val);
+
+	default:
+		break;
+	}
+
+	/* A 128-bit UUID built on the Bluetooth Base UUID is equal to its 16-bit or 32-bit
+	 * form, so it is hashed by the same value.
+	 */
+	val = BT_UUID_128(uuid)->val;
+	if (memcmp(val, base_uuid.val, BT_SCAN_UUID_128_SIZE - sizeof(uint32_t)) == 0) {
+		return hash_mix(sys_get_le32(&val[12]));
+	}
+
+	return hash_mix(sys_get_le32(&val[0]) ^ sys_get_le32(&val[4]) ^
+			sys_get_le32(&val[8]) ^ sys_get_le32(&val[12]));
+}
+
+static int uuid_filter_find(const struct bt_uuid *uuid)
+{
+	const struct bt_scan_uuid_filter *uuid_filter = &bt_scan.scan_filters.uuid;
+	uint32_t i = uuid_hash(uuid);
+	uint8_t slot;
+
+	/* The table is never full, so the probe sequence ends with an empty slot. */
+	for (;; i++) {
+		slot = uuid_filter->hash[i & (UUID_HASH_SIZE - 1)];
+		if (!slot) {
+			return -ENOENT;
+		}
+
+		if (bt_uuid_cmp(uuid, uuid_filter->uuid[slot - 1].uuid) == 0) {
+			return slot - 1;
+		}
+	}
+}
+
+static void uuid_filter_hash_add(uint8_t idx)
+{
+	uint8_t *hash = bt_scan.scan_filters.uuid.hash;
+	uint32_t i = uuid_hash(bt_scan.scan_filters.uuid.uuid[idx].uuid);
+
+	while (hash[i & (UUID_HASH_SIZE - 1)]) {
+		i++;
+	}
+
+	hash[i & (UUID_HASH_SIZE - 1)] = idx + 1;
+}
+
+/* Marks the UUID filters found in the advertising data in the found bitmap. */
+static void uuid_filters_find(const uint8_t *data,
+			      uint8_t data_len,
+			      uint8_t uuid_type,
+			      uint32_t *found)
+{
+	uint8_t uuid_len = uuid_len_get(uuid_type);
+	int idx;
+
+	if (!uuid_len) {
+		return;
+	}
+
+	for (size_t i = 0; i + uuid_len <= data_len; i += uuid_len) {
+		struct bt_uuid_128 uuid;
+
+		if (!bt_uuid_create(&uuid.uuid, &data[i], uuid_len)) {
+			return;
+		}
+
+		idx = uuid_filter_find(&uuid.uuid);
+		if (idx >= 0) {
+			found[idx / 32] |= BIT(idx % 32);
+		}
+	}
+}
+#else
+static bool find_uuid(const uint8_t *data,
+		      uint8_t data_len,
+		      uint8_t uuid_type,
+		      const struct bt_scan_uuid *target_uuid)
+{
+	uint8_t uuid_len = uuid_len_get(uuid_type);
+
+	if (!uuid_len) {
 		return false;
 	}
 
@@ -802,6 +1285,7 @@ static bool find_uuid(const uint8_t *data,
 
 	return false;
 }
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
 
 static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 			     struct bt_scan_control *control)
@@ -812,11 +1296,23 @@ static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 	const uint8_t counter = bt_scan.scan_filters.uuid.cnt;
 	uint8_t data_len = data->data_len;
 	uint8_t uuid_match_cnt = 0;
+	bool found;
 
-	for (size_t i = 0; i < counter; i++) {
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	uint32_t found_map[UUID_FOUND_WORDS] = {0};
+
+	uuid_filters_find(data->data, data_len, uuid_type, found_map);
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
 
-		if (find_uuid(data->data, data_len, uuid_type,
-			      &uuid_filter->uuid[i])) {
+	for (size_t i = 0; i < counter; i++) {
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+		found = (found_map[i / 32] & BIT(i % 32)) != 0;
+#else
+		found = find_uuid(data->data, data_len, uuid_type,
+				  &uuid_filter->uuid[i]);
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
+		if (found) {
 			control->filter_status.uuid.uuid[uuid_match_cnt] =
 				uuid_filter->uuid[i].uuid;
 
@@ -881,11 +1377,17 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 	}
 
 	/* Check for duplicated filter. */
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	if (uuid_filter_find(uuid) >= 0) {
+		return 0;
+	}
+#else
 	for (size_t i = 0; i < counter; i++) {
 		if (bt_uuid_cmp(uuid_filter[i].uuid, uuid) == 0) {
 			return 0;
 		}
 	}
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
 
 	/* Add UUID to the filter. */
 	switch (uuid->type) {
@@ -917,6 +1419,10 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		return -EINVAL;
 	}
 
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	uuid_filter_hash_add(counter);
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
 	bt_scan.scan_filters.uuid.cnt++;
 	LOG_DBG("Added filter on UUID type %x", uuid->type);
 
@@ -1156,6 +1662,86 @@ static void scan_default_conn_param_set(void)
 	bt_scan.conn_param = *conn_param;
 }
 
+static uint8_t enabled_filter_cnt(void)
+{
+	uint8_t filter_cnt = 0;
+
+	if (is_addr_filter_enabled()) {
+		filter_cnt++;
+	}
+
+	if (is_name_filter_enabled()) {
+		filter_cnt++;
+	}
+
+	if (is_short_name_filter_enabled()) {
+		filter_cnt++;
+	}
+
+	if (is_uuid_filter_enabled()) {
+		filter_cnt++;
+	}
+
+	if (is_appearance_filter_enabled()) {
+		filter_cnt++;
+	}
+
+	if (is_manufacturer_data_filter_enabled()) {
+		filter_cnt++;
+	}
+
+	return filter_cnt;
+}
+
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+static void ad_type_set(uint8_t type)
+{
+	bt_scan.scan_filters.ad_types[type / 32] |= BIT(type % 32);
+}
+
+static bool ad_type_check(uint8_t type)
+{
+	return (bt_scan.scan_filters.ad_types[type / 32] & BIT(type % 32)) != 0;
+}
+
+/* Precompute what the advertising report processing needs to know about the enabled
+ * filters. The address and UUID hash tables are kept up to date when filters are added.
+ */
+static void filters_compile(void)
+{
+	struct bt_scan_filters *filters = &bt_scan.scan_filters;
+
+	filters->enabled_cnt = enabled_filter_cnt();
+
+	memset(filters->ad_types, 0, sizeof(filters->ad_types));
+
+	if (is_name_filter_enabled()) {
+		ad_type_set(BT_DATA_NAME_COMPLETE);
+	}
+
+	if (is_short_name_filter_enabled()) {
+		ad_type_set(BT_DATA_NAME_SHORTENED);
+	}
+
+	if (is_appearance_filter_enabled()) {
+		ad_type_set(BT_DATA_GAP_APPEARANCE);
+	}
+
+	if (is_uuid_filter_enabled()) {
+		ad_type_set(BT_DATA_UUID16_SOME);
+		ad_type_set(BT_DATA_UUID16_ALL);
+		ad_type_set(BT_DATA_UUID32_SOME);
+		ad_type_set(BT_DATA_UUID32_ALL);
+		ad_type_set(BT_DATA_UUID128_SOME);
+		ad_type_set(BT_DATA_UUID128_ALL);
+	}
+
+	if (is_manufacturer_data_filter_enabled()) {
+		ad_type_set(BT_DATA_MANUFACTURER_DATA);
+	}
+}
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
 int bt_scan_filter_add(enum bt_scan_filter_type type,
 		       const void *data)
 {
@@ -1234,6 +1820,11 @@ void bt_scan_filter_remove_all(void)
 			&bt_scan.scan_filters.uuid;
 	uuid_filter->cnt = 0;
 
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	memset(addr_filter->hash, 0, sizeof(addr_filter->hash));
+	memset(uuid_filter->hash, 0, sizeof(uuid_filter->hash));
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
 	struct bt_scan_appearance_filter *appearance_filter =
 			&bt_scan.scan_filters.appearance;
 	appearance_filter->cnt = 0;
@@ -1254,6 +1845,10 @@ void bt_scan_filter_disable(void)
 	bt_scan.scan_filters.uuid.enabled = false;
 	bt_scan.scan_filters.appearance.enabled = false;
 	bt_scan.scan_filters.manufacturer_data.enabled = false;
+
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	filters_compile();
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
 }
 
 int bt_scan_filter_enable(uint8_t mode, bool match_all)
@@ -1296,6 +1891,10 @@ int bt_scan_filter_enable(uint8_t mode, bool match_all)
 	/* Select the filter mode. */
 	filters->all_mode = match_all;
 
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	filters_compile();
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
 	return 0;
 }
 
@@ -1379,35 +1978,6 @@ void bt_scan_update_init_conn_params(struct bt_le_conn_param *new_conn_param)
 	bt_scan.conn_param = *new_conn_param;
 }
 
-static void check_enabled_filters(struct bt_scan_control *control)
-{
-	control->filter_cnt = 0;
-
-	if (is_addr_filter_enabled()) {
-		control->filter_cnt++;
-	}
-
-	if (is_name_filter_enabled()) {
-		control->filter_cnt++;
-	}
-
-	if (is_short_name_filter_enabled()) {
-		control->filter_cnt++;
-	}
-
-	if (is_uuid_filter_enabled()) {
-		control->filter_cnt++;
-	}
-
-	if (is_appearance_filter_enabled()) {
-		control->filter_cnt++;
-	}
-
-	if (is_manufacturer_data_filter_enabled()) {
-		control->filter_cnt++;
-	}
-}
-
 static bool adv_data_found(struct bt_data *data, void *user_data)
 {
 	struct bt_scan_control *scan_control =
@@ -1458,11 +2028,11 @@ static bool adv_data_found(struct bt_data *data, void *user_data)
 	return true;
 }
 
-static void filter_state_check(struct bt_scan_control *control,
+static bool filter_state_check(struct bt_scan_control *control,
 			       const bt_addr_le_t *addr)
 {
 	if (!scan_device_filter_check(addr)) {
-		return;
+		return false;
 	}
 
 	if (control->all_mode &&
@@ -1473,35 +2043,118 @@ static void filter_state_check(struct bt_scan_control *control,
 #if CONFIG_BT_CENTRAL
 		scan_connect_with_target(control, addr);
 #endif /* CONFIG_BT_CENTRAL */
+
+		return true;
 	}
 
 	/* In the normal filter mode, only one filter match is
 	 * needed to generate the notification to the main application.
 	 */
-	else if ((!control->all_mode) && control->filter_match) {
+	if ((!control->all_mode) && control->filter_match) {
 		notify_filter_matched(&control->device_info,
 				      &control->filter_status,
 				      control->connectable);
 #if CONFIG_BT_CENTRAL
 		scan_connect_with_target(control, addr);
 #endif /* CONFIG_BT_CENTRAL */
-	} else {
-		notify_filter_no_match(&control->device_info,
-				       control->connectable);
+
+		return true;
+	}
+
+	notify_filter_no_match(&control->device_info,
+			       control->connectable);
+
+	return false;
+}
+
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+/* Check if the advertising data holds any of the types checked by the enabled filters.
+ * The data is walked the same way as in bt_data_parse().
+ */
+static bool ad_prescreen(const struct net_buf_simple *ad)
+{
+	const uint8_t *data = ad->data;
+	size_t len = ad->len;
+	uint8_t field_len;
+
+	while (len > 1) {
+		field_len = data[0];
+		if ((field_len == 0) || (field_len > (len - 1))) {
+			return false;
+		}
+
+		if (ad_type_check(data[1])) {
+			return true;
+		}
+
+		data += field_len + 1;
+		len -= field_len + 1;
+	}
+
+	return false;
+}
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
+#if CONFIG_BT_SCAN_STATS
+static void stats_window_update(uint32_t now)
+{
+	struct scan_stats *stats = &bt_scan.stats;
+	uint32_t elapsed = now - stats->window_start;
+
+	if (elapsed < MSEC_PER_SEC) {
+		return;
+	}
+
+	stats->stats.reports_per_sec = (uint32_t)(((uint64_t)stats->window_reports *
+						   MSEC_PER_SEC) / elapsed);
+	stats->stats.matched_per_sec = (uint32_t)(((uint64_t)stats->window_matched *
+						   MSEC_PER_SEC) / elapsed);
+
+	stats->window_start = now;
+	stats->window_reports = 0;
+	stats->window_matched = 0;
+}
+
+static void stats_update(bool prescreened, bool matched)
+{
+	struct scan_stats *stats = &bt_scan.stats;
+	k_spinlock_key_t key = k_spin_lock(&stats->lock);
+
+	stats_window_update(k_uptime_get_32());
+
+	stats->stats.reports++;
+	stats->window_reports++;
+
+	if (prescreened) {
+		stats->stats.prescreened++;
+	}
+
+	if (matched) {
+		stats->stats.matched++;
+		stats->window_matched++;
 	}
+
+	k_spin_unlock(&stats->lock, key);
 }
+#endif /* CONFIG_BT_SCAN_STATS */
 
 static void scan_recv(const struct bt_le_scan_recv_info *info,
 		      struct net_buf_simple *ad)
 {
 	struct bt_scan_control scan_control;
 	struct net_buf_simple_state state;
+	bool prescreened = false;
+	bool matched;
 
 	memset(&scan_control, 0, sizeof(scan_control));
 
 	scan_control.all_mode = bt_scan.scan_filters.all_mode;
 
-	check_enabled_filters(&scan_control);
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	scan_control.filter_cnt = bt_scan.scan_filters.enabled_cnt;
+#else
+	scan_control.filter_cnt = enabled_filter_cnt();
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
 
 	/* Check id device is connectable. */
 	scan_control.connectable =
@@ -1510,12 +2163,19 @@ static void scan_recv(const struct bt_le_scan_recv_info *info,
 	/* Check the address filter. */
 	check_addr(&scan_control, info->addr);
 
-	/* Save advertising buffer state to transfer it
-	 * data to application if futher processing is needed.
-	 */
-	net_buf_simple_save(ad, &state);
-	bt_data_parse(ad, adv_data_found, (void *)&scan_control);
-	net_buf_simple_restore(ad, &state);
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	/* Skip parsing if no enabled filter checks the advertising data. */
+	prescreened = !ad_prescreen(ad);
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
+	if (!prescreened) {
+		/* Save advertising buffer state to transfer it
+		 * data to application if futher processing is needed.
+		 */
+		net_buf_simple_save(ad, &state);
+		bt_data_parse(ad, adv_data_found, (void *)&scan_control);
+		net_buf_simple_restore(ad, &state);
+	}
 
 	scan_control.device_info.recv_info = info;
 	scan_control.device_info.conn_param = &bt_scan.conn_param;
@@ -1525,7 +2185,13 @@ static void scan_recv(const struct bt_le_scan_recv_info *info,
 	 * the number of the filters matched to generate the notification.
 	 * If the event handler is not NULL, notify the main application.
 	 */
-	filter_state_check(&scan_control, info->addr);
+	matched = filter_state_check(&scan_control, info->addr);
+
+#if CONFIG_BT_SCAN_STATS
+	stats_update(prescreened, matched);
+#else
+	ARG_UNUSED(matched);
+#endif /* CONFIG_BT_SCAN_STATS */
 }
 
 static struct bt_le_scan_cb scan_cb = {
@@ -1574,7 +2240,38 @@ int bt_scan_params_set(struct bt_le_scan_param *scan_param)
 	return 0;
 }
 
-#if CONFIG_BT_SCAN_BLOCKLIST
+#if CONFIG_BT_SCAN_BLOCKLIST && CONFIG_BT_SCAN_DEVICE_HASH
+int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
+{
+	char addr_str[BT_ADDR_LE_STR_LEN];
+	int err;
+
+	if (!addr) {
+		return -EINVAL;
+	}
+
+	bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
+
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+	err = addr_table_add(&blocklist_table, addr);
+	k_mutex_unlock(&scan_mutex);
+
+	if (err) {
+		LOG_DBG("Device %s is already on the blocklist", addr_str);
+	} else {
+		LOG_INF("Device %s added to the scanning blocklist", addr_str);
+	}
+
+	return 0;
+}
+
+void bt_scan_blocklist_clear(void)
+{
+	k_mutex_lock(&scan_mutex, K_FOREVER);
+	addr_table_clear(&blocklist_table);
+	k_mutex_unlock(&scan_mutex);
+}
+#elif CONFIG_BT_SCAN_BLOCKLIST
 int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 {
 	int err = 0;
@@ -1626,11 +2323,48 @@ void bt_scan_blocklist_clear(void)
 void bt_scan_conn_attempts_filter_clear(void)
 {
 	k_mutex_lock(&scan_mutex, K_FOREVER);
+#if CONFIG_BT_SCAN_DEVICE_HASH
+	addr_table_clear(&attempts_table);
+#else
 	memset(&bt_scan.attempts_filter, 0, sizeof(bt_scan.attempts_filter));
+#endif /* CONFIG_BT_SCAN_DEVICE_HASH */
 	k_mutex_unlock(&scan_mutex);
 }
 #endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
 
+#if CONFIG_BT_SCAN_STATS
+int bt_scan_stats_get(struct bt_scan_stats *stats)
+{
+	k_spinlock_key_t key;
+
+	if (!stats) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&bt_scan.stats.lock);
+
+	/* Close an elapsed window, so that the rates follow a drop of the report rate. */
+	stats_window_update(k_uptime_get_32());
+	*stats = bt_scan.stats.stats;
+
+	k_spin_unlock(&bt_scan.stats.lock, key);
+
+	return 0;
+}
+
+void bt_scan_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&bt_scan.stats.lock);
+
+	memset(&bt_scan.stats.stats, 0, sizeof(bt_scan.stats.stats));
+	bt_scan.stats.window_start = k_uptime_get_32();
+	bt_scan.stats.window_reports = 0;
+	bt_scan.stats.window_matched = 0;
+
+	k_spin_unlock(&bt_scan.stats.lock, key);
+}
+#endif /* CONFIG_BT_SCAN_STATS */
+
 #if CONFIG_BT_CENTRAL
 void bt_scan_update_connect_if_match(bool connect_if_match)
 {
@@ -3,6 +3,7 @@
  *
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
+#include <string.h>
 #include <debug/cpu_load.h>
 #include <zephyr/shell/shell.h>
 #include <helpers/nrfx_gppi.h>
@@ -29,6 +30,13 @@ LOG_MODULE_REGISTER(cpu_load, CONFIG_NRF_CPU_LOAD_LOG_LEVEL);
 #define CPU_LOAD_LOG_INTERVAL 0
 #endif
 
+/* Define to please compiler when thread names are disabled. */
+#ifdef CONFIG_THREAD_MAX_NAME_LEN
+#define THREAD_NAME_LEN CONFIG_THREAD_MAX_NAME_LEN
+#else
+#define THREAD_NAME_LEN 1
+#endif
+
 static nrfx_timer_t timer =
 	NRFX_TIMER_INSTANCE(NRF_TIMER_INST_GET(CONFIG_NRF_CPU_LOAD_TIMER_INSTANCE));
 static bool ready;
@@ -225,6 +233,69 @@ static int cmd_cpu_load_reset(const struct shell *shell,
 {
 	cpu_load_reset();
 
+	if (IS_ENABLED(CONFIG_NRF_CPU_LOAD_THREADS)) {
+		cpu_load_stats_reset();
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_NRF_CPU_LOAD_THREADS
+struct thread_name_lookup {
+	const struct k_thread *thread;
+	char name[THREAD_NAME_LEN];
+	bool found;
+};
+
+static void thread_name_lookup_cb(const struct k_thread *thread, void *user_data)
+{
+	struct thread_name_lookup *lookup = user_data;
+	const char *name;
+
+	if (thread != lookup->thread) {
+		return;
+	}
+
+	/* Copied while the thread list is locked, so the thread cannot exit meanwhile */
+	name = k_thread_name_get((k_tid_t)thread);
+	strncpy(lookup->name, name ? name : "", sizeof(lookup->name) - 1);
+	lookup->found = true;
+}
+#endif
+
+static int cmd_cpu_load_threads(const struct shell *shell, size_t argc, char **argv)
+{
+#ifdef CONFIG_NRF_CPU_LOAD_THREADS
+	static struct cpu_load_thread_stat stats[CONFIG_NRF_CPU_LOAD_THREADS_MAX];
+	int cnt = cpu_load_thread_stats_get(stats, ARRAY_SIZE(stats));
+	struct thread_name_lookup lookup;
+
+	for (int i = 0; i < cnt; i++) {
+		/* The thread may have exited since it was measured */
+		lookup = (struct thread_name_lookup){.thread = stats[i].thread};
+		k_thread_foreach(thread_name_lookup_cb, &lookup);
+
+		shell_print(shell, "%p %-20s %3u,%03u%%", stats[i].thread,
+			    lookup.found ? lookup.name : "<exited>", stats[i].load / 1000,
+			    stats[i].load % 1000);
+	}
+#endif
+
+	return 0;
+}
+
+static int cmd_cpu_load_irqs(const struct shell *shell, size_t argc, char **argv)
+{
+#ifdef CONFIG_NRF_CPU_LOAD_THREADS
+	static struct cpu_load_irq_stat stats[CONFIG_NUM_IRQS];
+	int cnt = cpu_load_irq_stats_get(stats, ARRAY_SIZE(stats));
+
+	for (int i = 0; i < cnt; i++) {
+		shell_print(shell, "IRQ %3u %3u,%03u%%", stats[i].irq, stats[i].load / 1000,
+			    stats[i].load % 1000);
+	}
+#endif
+
 	return 0;
 }
 
@@ -236,6 +307,10 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_cmd_cpu_load,
 			cmd_cpu_load_reset, 1, 0),
 	SHELL_CMD_ARG(init, NULL, "Init",
 			cmd_cpu_load_reset, 1, 0),
+	SHELL_COND_CMD_ARG(CONFIG_NRF_CPU_LOAD_THREADS, threads, NULL,
+			"Get load of the threads", cmd_cpu_load_threads, 1, 0),
+	SHELL_COND_CMD_ARG(CONFIG_NRF_CPU_LOAD_THREADS, irqs, NULL,
+			"Get load of the interrupts", cmd_cpu_load_irqs, 1, 0),
 	SHELL_SUBCMD_SET_END
 );
 
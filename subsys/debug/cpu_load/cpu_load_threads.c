@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <string.h>
+#include <debug/cpu_load.h>
+#include <zephyr/kernel.h>
+#include <cmsis_core.h>
+
+/* Maximum number of nested interrupts. Each priority level can preempt the one below it. */
+#define ISR_NEST_MAX (1 << NVIC_PRIO_BITS)
+
+/* Exceptions which are not peripheral interrupts are only accounted in the total. */
+#define IRQ_NONE -1
+
+struct thread_entry {
+	const struct k_thread *thread;
+	uint64_t cycles;
+};
+
+static struct thread_entry threads[CONFIG_NRF_CPU_LOAD_THREADS_MAX];
+static uint64_t irq_cycles[CONFIG_NUM_IRQS];
+static uint64_t total_cycles;
+
+/* Start of the period which is not accounted yet. */
+static uint32_t cycle_last;
+/* Interrupts being handled, the innermost one is on top. */
+static int isr_stack[ISR_NEST_MAX];
+static int isr_nested;
+
+static struct thread_entry *thread_entry_get(const struct k_thread *thread)
+{
+	struct thread_entry *free_entry = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(threads); i++) {
+		if (threads[i].thread == thread) {
+			return &threads[i];
+		}
+
+		if (!free_entry && !threads[i].thread) {
+			free_entry = &threads[i];
+		}
+	}
+
+	if (free_entry) {
+		free_entry->thread = thread;
+	}
+
+	return free_entry;
+}
+
+/* Accounts the time since the previous call to the context that was running in between.
+ * Must be called with interrupts locked.
+ */
+static void cycles_account(const struct k_thread *thread)
+{
+	uint32_t now = k_cycle_get_32();
+	uint32_t cycles = now - cycle_last;
+	struct thread_entry *entry;
+	int irq;
+
+	cycle_last = now;
+	total_cycles += cycles;
+
+	/* Time of threads which do not fit in the table is only accounted in the total. */
+	if (isr_nested > 0) {
+		irq = isr_stack[MIN(isr_nested, ISR_NEST_MAX) - 1];
+
+		if (irq != IRQ_NONE) {
+			irq_cycles[irq] += cycles;
+		}
+	} else {
+		entry = thread_entry_get(thread);
+
+		if (entry) {
+			entry->cycles += cycles;
+		}
+	}
+}
+
+static int irq_current(void)
+{
+	int irq = (int)__get_IPSR() - 16;
+
+	return (irq >= 0 && irq < CONFIG_NUM_IRQS) ? irq : IRQ_NONE;
+}
+
+void sys_trace_thread_switched_out_user(struct k_thread *thread)
+{
+	cycles_account(thread);
+}
+
+void sys_trace_thread_switched_in_user(struct k_thread *thread)
+{
+	/* The switch itself is accounted to the incoming thread. */
+	cycles_account(thread);
+}
+
+/* The nesting level passed by the kernel is not maintained on Cortex-M, so it is counted here.
+ * The interrupt hooks can be preempted by higher priority interrupts, unlike the thread switch
+ * hooks.
+ */
+void sys_trace_isr_enter_user(int nested_interrupts)
+{
+	unsigned int key = irq_lock();
+
+	ARG_UNUSED(nested_interrupts);
+
+	cycles_account(k_current_get());
+
+	if (isr_nested < ISR_NEST_MAX) {
+		isr_stack[isr_nested] = irq_current();
+	}
+
+	isr_nested++;
+
+	irq_unlock(key);
+}
+
+void sys_trace_isr_exit_user(int nested_interrupts)
+{
+	unsigned int key = irq_lock();
+
+	ARG_UNUSED(nested_interrupts);
+
+	cycles_account(k_current_get());
+
+	if (isr_nested > 0) {
+		isr_nested--;
+	}
+
+	irq_unlock(key);
+}
+
+static uint32_t load_get(uint64_t cycles, uint64_t total)
+{
+	return total ? (uint32_t)((cycles * 100000) / total) : 0;
+}
+
+int cpu_load_thread_stats_get(struct cpu_load_thread_stat *stats, size_t count)
+{
+	unsigned int key;
+	uint64_t total;
+	int cnt = 0;
+
+	key = irq_lock();
+
+	cycles_account(k_current_get());
+	total = total_cycles;
+
+	for (size_t i = 0; i < ARRAY_SIZE(threads) && cnt < count; i++) {
+		if (!threads[i].thread) {
+			continue;
+		}
+
+		stats[cnt].thread = threads[i].thread;
+		stats[cnt].cycles = threads[i].cycles;
+		stats[cnt].load = load_get(threads[i].cycles, total);
+		cnt++;
+	}
+
+	irq_unlock(key);
+
+	return cnt;
+}
+
+int cpu_load_irq_stats_get(struct cpu_load_irq_stat *stats, size_t count)
+{
+	unsigned int key;
+	uint64_t total;
+	int cnt = 0;
+
+	key = irq_lock();
+
+	cycles_account(k_current_get());
+	total = total_cycles;
+
+	for (size_t i = 0; i < ARRAY_SIZE(irq_cycles) && cnt < count; i++) {
+		if (!irq_cycles[i]) {
+			continue;
+		}
+
+		stats[cnt].irq = i;
+		stats[cnt].cycles = irq_cycles[i];
+		stats[cnt].load = load_get(irq_cycles[i], total);
+		cnt++;
+	}
+
+	irq_unlock(key);
+
+	return cnt;
+}
+
+uint64_t cpu_load_stats_cycles_get(void)
+{
+	unsigned int key;
+	uint64_t total;
+
+	key = irq_lock();
+	cycles_account(k_current_get());
+	total = total_cycles;
+	irq_unlock(key);
+
+	return total;
+}
+
+void cpu_load_stats_reset(void)
+{
+	unsigned int key;
+
+	key = irq_lock();
+
+	memset(threads, 0, sizeof(threads));
+	memset(irq_cycles, 0, sizeof(irq_cycles));
+	total_cycles = 0;
+	cycle_last = k_cycle_get_32();
+
+	irq_unlock(key);
+}
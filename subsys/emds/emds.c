@@ -7,8 +7,13 @@
 #include <emds/emds.h>
 
 #include "emds_flash.h"
+#if defined(CONFIG_EMDS_CRC_CACHE)
+#include "emds_crc.h"
+#endif
 
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/flash.h>
+#include <zephyr/spinlock.h>
 #include <zephyr/sys/crc.h>
 
 #include <zephyr/logging/log.h>
@@ -86,6 +91,20 @@ static sys_slist_t emds_dynamic_entries;
 static struct emds_partition partition[PARTITIONS_NUM_MAX];
 static emds_store_cb_t app_store_cb;
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+static struct k_spinlock dirty_lock;
+/* The RAM data matches the freshest snapshot, so a delta snapshot can be built on it. */
+static bool data_loaded;
+/* The allocated snapshot is a delta snapshot. */
+static bool delta_snapshot;
+#endif
+
+#if defined(CONFIG_EMDS_CRC_CACHE)
+static void crc_work_handler(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(crc_work, crc_work_handler);
+#endif
+
 static void emds_print_init_info(void)
 {
 	LOG_DBG("EMDS initialized with the following partitions:");
@@ -239,6 +258,12 @@ int emds_store_time_get(uint32_t *store_time)
 		return rc;
 	}
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	if (emds_state == EMDS_STATE_READY && delta_snapshot) {
+		store_size = emds_delta_size();
+	}
+#endif
+
 	words = DIV_ROUND_UP(store_size, 4);
 	words += DIV_ROUND_UP(sizeof(struct emds_snapshot_metadata), 4);
 	chunk_handling = DIV_ROUND_UP(store_size, CHUNK_SIZE);
@@ -249,65 +274,331 @@ int emds_store_time_get(uint32_t *store_time)
 	return 0;
 }
 
-static uint8_t *emds_entry_memory_get(struct emds_data_entry *entry)
+static struct emds_entry *emds_entry_get(uint16_t id)
 {
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
-		if (ch->id == entry->id) {
-			entry->length = MIN(ch->len, entry->length);
-			return ch->data;
+		if (ch->id == id) {
+			return ch;
 		}
 	}
 
 	struct emds_dynamic_entry *ch;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
-		if (ch->entry.id == entry->id) {
-			entry->length = MIN(ch->entry.len, entry->length);
-			return ch->entry.data;
+		if (ch->entry.id == id) {
+			return &ch->entry;
 		}
 	}
 
-	LOG_WRN("Entry with ID %u not found", entry->id);
+	LOG_WRN("Entry with ID %u not found", id);
 	return NULL;
 }
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+void emds_entry_dirty_mark(const struct emds_entry *entry, size_t offset, size_t len)
+{
+	struct emds_dirty_region *dirty = entry->dirty;
+	k_spinlock_key_t key;
+
+	if (dirty == NULL || len == 0 || offset >= entry->len) {
+		return;
+	}
+
+	len = MIN(len, entry->len - offset);
+
+	key = k_spin_lock(&dirty_lock);
+
+	if (dirty->end == 0) {
+		dirty->start = offset;
+		dirty->end = offset + len;
+	} else {
+		dirty->start = MIN(dirty->start, offset);
+		dirty->end = MAX(dirty->end, offset + len);
+	}
+
+#if defined(CONFIG_EMDS_CRC_CACHE)
+	dirty->crc_seq++;
+#endif
+
+	k_spin_unlock(&dirty_lock, key);
+
+#if defined(CONFIG_EMDS_CRC_CACHE)
+	/* Changes reported before the work runs are covered by the same recalculation */
+	(void)k_work_schedule(&crc_work, K_MSEC(CONFIG_EMDS_CRC_CACHE_DELAY_MS));
+#endif
+}
+
+static void entry_dirty_reset(const struct emds_entry *entry, bool changed)
+{
+	if (entry->dirty) {
+		entry->dirty->start = 0;
+		entry->dirty->end = changed ? entry->len : 0;
+#if defined(CONFIG_EMDS_CRC_CACHE)
+		/* The data is changed without a report, so the cached CRC is outdated */
+		if (changed) {
+			entry->dirty->crc_valid_seq = entry->dirty->crc_seq - 1;
+		}
+#endif
+	}
+}
+
+static void entries_dirty_reset(bool changed)
+{
+	STRUCT_SECTION_FOREACH(emds_entry, ch) {
+		entry_dirty_reset(ch, changed);
+	}
+
+	struct emds_dynamic_entry *ch;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		entry_dirty_reset(&ch->entry, changed);
+	}
+}
+
+static size_t entry_delta_size(const struct emds_entry *entry)
+{
+	if (entry->dirty == NULL) {
+		return entry->len + sizeof(struct emds_delta_entry);
+	}
+
+	if (entry->dirty->end == 0) {
+		return 0;
+	}
+
+	return entry->dirty->end - entry->dirty->start + sizeof(struct emds_delta_entry);
+}
+
+static size_t emds_delta_size(void)
+{
+	size_t size = 0;
+
+	STRUCT_SECTION_FOREACH(emds_entry, ch) {
+		size += entry_delta_size(ch);
+	}
+
+	struct emds_dynamic_entry *ch;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		size += entry_delta_size(&ch->entry);
+	}
+
+	return size;
+}
+#endif /* CONFIG_EMDS_INCREMENTAL */
+
+#if defined(CONFIG_EMDS_CRC_CACHE)
+/* The CRC is calculated without the lock, and is only cached if no change was reported in the
+ * meantime. A reported change schedules the work again, so the CRC is calculated once more.
+ */
+static void entry_crc_refresh(const struct emds_entry *entry)
+{
+	struct emds_dirty_region *dirty = entry->dirty;
+	k_spinlock_key_t key;
+	uint32_t seq;
+	uint32_t crc;
+	bool valid;
+
+	if (dirty == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&dirty_lock);
+	seq = dirty->crc_seq;
+	valid = dirty->crc_valid_seq == seq;
+	k_spin_unlock(&dirty_lock, key);
+
+	if (valid) {
+		return;
+	}
+
+	crc = crc32_k_4_2_update(0, entry->data, entry->len);
+
+	key = k_spin_lock(&dirty_lock);
+	if (dirty->crc_seq == seq) {
+		dirty->crc = crc;
+		dirty->crc_valid_seq = seq;
+	}
+	k_spin_unlock(&dirty_lock, key);
+}
+
+static void crc_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	STRUCT_SECTION_FOREACH(emds_entry, ch) {
+		entry_crc_refresh(ch);
+	}
+
+	struct emds_dynamic_entry *ch;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		entry_crc_refresh(&ch->entry);
+	}
+}
+
+static void entry_crc_prepare(const struct emds_entry *entry)
+{
+	k_spinlock_key_t key;
+
+	if (entry->dirty == NULL) {
+		return;
+	}
+
+	emds_crc_shift_init(entry->dirty->crc_shift, entry->len);
+
+	key = k_spin_lock(&dirty_lock);
+	entry->dirty->crc_valid_seq = entry->dirty->crc_seq - 1;
+	k_spin_unlock(&dirty_lock, key);
+
+	entry_crc_refresh(entry);
+}
+
+/* Prepare the CRC operators of the entries, and calculate the CRCs of the loaded data */
+static void entries_crc_prepare(void)
+{
+	STRUCT_SECTION_FOREACH(emds_entry, ch) {
+		entry_crc_prepare(ch);
+	}
+
+	struct emds_dynamic_entry *ch;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		entry_crc_prepare(&ch->entry);
+	}
+}
+#endif /* CONFIG_EMDS_CRC_CACHE */
+
+/* A tracked entry is unchanged once all of its data has been restored from the snapshots. */
+static void entry_restored(const struct emds_entry *entry, size_t offset, size_t len)
+{
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	if (offset == 0 && len >= entry->len) {
+		entry_dirty_reset(entry, false);
+	}
+#else
+	ARG_UNUSED(entry);
+	ARG_UNUSED(offset);
+	ARG_UNUSED(len);
+#endif
+}
+
 static int emds_read_data(const struct flash_area *fa, struct emds_snapshot_metadata *metadata)
 {
-	struct emds_data_entry entry;
+	struct emds_data_entry data_entry;
+	struct emds_entry *entry;
 	off_t data_off = metadata->data_instance_off;
 	int32_t data_len = metadata->data_instance_len;
-	int32_t flash_entry_data_len;
-	uint8_t *data_buf;
 	int rc;
 
 	while (data_len > 0) {
-		rc = flash_area_read(fa, data_off, &entry, sizeof(entry));
+		rc = flash_area_read(fa, data_off, &data_entry, sizeof(data_entry));
 		if (rc) {
 			LOG_ERR("Failed to read data entry: %d", rc);
 			return -EIO;
 		}
 
-		data_off += sizeof(entry);
-		data_len -= sizeof(entry);
-		flash_entry_data_len = entry.length;
+		data_off += sizeof(data_entry);
+		data_len -= sizeof(data_entry);
 
-		data_buf = emds_entry_memory_get(&entry);
+		entry = emds_entry_get(data_entry.id);
 
-		if (data_buf) {
-			rc = flash_area_read(fa, data_off, data_buf, entry.length);
+		if (entry) {
+			rc = flash_area_read(fa, data_off, entry->data,
+					     MIN(entry->len, data_entry.length));
 			if (rc) {
-				LOG_ERR("Failed to read data for entry ID %u: %d", entry.id, rc);
+				LOG_ERR("Failed to read data for entry ID %u: %d", data_entry.id,
+					rc);
 				return -EIO;
 			}
+
+			entry_restored(entry, 0, data_entry.length);
 		}
 
-		data_off += flash_entry_data_len;
-		data_len -= flash_entry_data_len;
+		data_off += data_entry.length;
+		data_len -= data_entry.length;
 	}
 
 	return 0;
 }
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+static int emds_read_delta(const struct flash_area *fa, struct emds_snapshot_metadata *metadata)
+{
+	struct emds_delta_entry delta_entry;
+	struct emds_entry *entry;
+	off_t data_off = metadata->data_instance_off;
+	int32_t data_len = metadata->data_instance_len;
+	int rc;
+
+	while (data_len > 0) {
+		rc = flash_area_read(fa, data_off, &delta_entry, sizeof(delta_entry));
+		if (rc) {
+			LOG_ERR("Failed to read delta entry: %d", rc);
+			return -EIO;
+		}
+
+		data_off += sizeof(delta_entry);
+		data_len -= sizeof(delta_entry);
+
+		entry = emds_entry_get(delta_entry.id);
+
+		if (entry && delta_entry.offset < entry->len) {
+			rc = flash_area_read(fa, data_off, entry->data + delta_entry.offset,
+					     MIN(entry->len - delta_entry.offset,
+						 delta_entry.length));
+			if (rc) {
+				LOG_ERR("Failed to read data for entry ID %u: %d", delta_entry.id,
+					rc);
+				return -EIO;
+			}
+
+			entry_restored(entry, delta_entry.offset, delta_entry.length);
+		}
+
+		data_off += delta_entry.length;
+		data_len -= delta_entry.length;
+	}
+
+	return 0;
+}
+
+/* Replay the full snapshot and then every delta snapshot built on it, oldest first. The snapshots
+ * of the chain have consecutive metadata slots, the oldest one at the highest offset.
+ */
+static int emds_read_chain(const struct emds_snapshot_candidate *snapshot)
+{
+	const struct flash_area *fa = partition[snapshot->partition_index].fa;
+	struct emds_snapshot_metadata link;
+	int rc;
+
+	/* Entries that are not restored in full are stored in full in the next snapshot */
+	entries_dirty_reset(true);
+
+	for (int i = snapshot->chain_len; i >= 0; i--) {
+		rc = flash_area_read(fa, snapshot->metadata_off + i * sizeof(link), &link,
+				     sizeof(link));
+		if (rc) {
+			LOG_ERR("Failed to read snapshot metadata: %d", rc);
+			return -EIO;
+		}
+
+		if (emds_flash_snapshot_is_delta(&link)) {
+			rc = emds_read_delta(fa, &link);
+		} else {
+			rc = emds_read_data(fa, &link);
+		}
+
+		if (rc) {
+			return rc;
+		}
+	}
+
+	data_loaded = true;
+
+	return 0;
+}
+#endif /* CONFIG_EMDS_INCREMENTAL */
+
 int emds_load(void)
 {
 	struct emds_snapshot_candidate candidate = {0};
@@ -338,13 +629,18 @@ int emds_load(void)
 	LOG_DBG("Found freshest snapshot in partition %d with fresh_cnt %u",
 		freshest_snapshot.partition_index, freshest_snapshot.metadata.fresh_cnt);
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	return emds_read_chain(&freshest_snapshot);
+#else
 	return emds_read_data(partition[freshest_snapshot.partition_index].fa,
 			      &freshest_snapshot.metadata);
+#endif
 }
 
 int emds_prepare(void)
 {
 	size_t data_size;
+	int entries;
 	bool erase_enabled = false;
 	int idx = 0;
 	int freshest_partition_idx = -1;
@@ -354,8 +650,21 @@ int emds_prepare(void)
 		return -ECANCELED;
 	}
 
-	/* Returned status is not checked since initialization state is checked above */
-	(void)emds_store_size_get(&data_size);
+	entries = emds_entries_size(&data_size);
+
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	/* Delta entry headers are larger, so a delta snapshot of all entries is the largest
+	 * snapshot that can be stored. The actual size is set when the snapshot is stored.
+	 */
+	data_size += entries * (sizeof(struct emds_delta_entry) - sizeof(struct emds_data_entry));
+	delta_snapshot = false;
+#else
+	ARG_UNUSED(entries);
+#endif
+
+#if defined(CONFIG_EMDS_CRC_CACHE)
+	entries_crc_prepare();
+#endif
 
 	allocated_snapshot.metadata.fresh_cnt = freshest_snapshot.metadata.fresh_cnt + 1;
 
@@ -367,6 +676,10 @@ int emds_prepare(void)
 						  data_size);
 		if (rc == 0) {
 			allocated_snapshot.partition_index = freshest_partition_idx;
+#if defined(CONFIG_EMDS_INCREMENTAL)
+			delta_snapshot = data_loaded && freshest_snapshot.chain_len <
+							       CONFIG_EMDS_INCREMENTAL_CHAIN_MAX;
+#endif
 			emds_state = EMDS_STATE_READY;
 			return 0;
 		}
@@ -421,8 +734,6 @@ static void data_to_stream(const struct emds_partition *partition, off_t *data_o
 	while (rp != len) {
 		data_stream_pack(in, out, wp, &rp, len);
 		if (*wp == CHUNK_SIZE) {
-			allocated_snapshot.metadata.snapshot_crc = crc32_k_4_2_update(
-				allocated_snapshot.metadata.snapshot_crc, out, *wp);
 			emds_flash_write_data(partition, *data_off, out, *wp);
 			*data_off += *wp;
 			*wp = 0;
@@ -430,6 +741,28 @@ static void data_to_stream(const struct emds_partition *partition, off_t *data_o
 	}
 }
 
+static void snapshot_crc_update(const uint8_t *data, size_t len)
+{
+	allocated_snapshot.metadata.snapshot_crc =
+		crc32_k_4_2_update(allocated_snapshot.metadata.snapshot_crc, data, len);
+}
+
+/* Use the cached CRC of the entry data if no change was reported after it was calculated */
+static void entry_data_crc_update(const struct emds_entry *entry)
+{
+#if defined(CONFIG_EMDS_CRC_CACHE)
+	const struct emds_dirty_region *dirty = entry->dirty;
+
+	if (dirty && dirty->crc_valid_seq == dirty->crc_seq) {
+		allocated_snapshot.metadata.snapshot_crc = emds_crc_combine(
+			allocated_snapshot.metadata.snapshot_crc, dirty->crc, dirty->crc_shift);
+		return;
+	}
+#endif
+
+	snapshot_crc_update(entry->data, entry->len);
+}
+
 static void entry_to_stream(const struct emds_partition *partition, off_t *data_off, uint8_t *out,
 			    size_t *wp, struct emds_entry *entry)
 {
@@ -439,16 +772,59 @@ static void entry_to_stream(const struct emds_partition *partition, off_t *data_
 	};
 
 	LOG_DBG("Storing entry ID %u, length %u", entry->id, entry->len);
+	snapshot_crc_update((uint8_t *)&data_entry, sizeof(data_entry));
+	entry_data_crc_update(entry);
 	data_to_stream(partition, data_off, (uint8_t *)&data_entry, out, wp, sizeof(data_entry));
 	data_to_stream(partition, data_off, entry->data, out, wp, entry->len);
 }
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+static void entry_delta_to_stream(const struct emds_partition *partition, off_t *data_off,
+				  uint8_t *out, size_t *wp, struct emds_entry *entry)
+{
+	struct emds_delta_entry delta_entry = {
+		.id = entry->id,
+		.offset = 0,
+		.length = entry->len,
+	};
+
+	if (entry->dirty) {
+		if (entry->dirty->end == 0) {
+			return;
+		}
+
+		delta_entry.offset = entry->dirty->start;
+		delta_entry.length = entry->dirty->end - entry->dirty->start;
+	}
+
+	LOG_DBG("Storing entry ID %u, offset %u, length %u", entry->id, delta_entry.offset,
+		delta_entry.length);
+	snapshot_crc_update((uint8_t *)&delta_entry, sizeof(delta_entry));
+	snapshot_crc_update(entry->data + delta_entry.offset, delta_entry.length);
+	data_to_stream(partition, data_off, (uint8_t *)&delta_entry, out, wp,
+		       sizeof(delta_entry));
+	data_to_stream(partition, data_off, entry->data + delta_entry.offset, out, wp,
+		       delta_entry.length);
+}
+#endif /* CONFIG_EMDS_INCREMENTAL */
+
+static void snapshot_entry_to_stream(const struct emds_partition *partition, off_t *data_off,
+				     uint8_t *out, size_t *wp, struct emds_entry *entry)
+{
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	if (delta_snapshot) {
+		entry_delta_to_stream(partition, data_off, out, wp, entry);
+		return;
+	}
+#endif
+
+	entry_to_stream(partition, data_off, out, wp, entry);
+}
+
 static void stream_fflush(const struct emds_partition *partition, off_t *data_off, uint8_t *out,
 			  size_t *wp)
 {
 	if (*wp > 0) {
-		allocated_snapshot.metadata.snapshot_crc =
-			crc32_k_4_2_update(allocated_snapshot.metadata.snapshot_crc, out, *wp);
 		emds_flash_write_data(partition, *data_off, out, *wp);
 		*data_off += *wp;
 		*wp = 0;
@@ -459,6 +835,9 @@ int emds_store(void)
 {
 	uint32_t store_key;
 	uint8_t data_chunk[CHUNK_SIZE];
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	size_t data_size;
+#endif
 	size_t wp = 0;
 	off_t data_off = allocated_snapshot.metadata.data_instance_off;
 	int idx = allocated_snapshot.partition_index;
@@ -471,6 +850,20 @@ int emds_store(void)
 	/* Lock all interrupts */
 	store_key = irq_lock();
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	if (delta_snapshot) {
+		data_size = emds_delta_size();
+		if (data_size == 0) {
+			LOG_DBG("No changes since the freshest snapshot");
+			goto unlock_and_exit;
+		}
+	} else {
+		(void)emds_entries_size(&data_size);
+	}
+
+	emds_flash_snapshot_update(&allocated_snapshot, delta_snapshot, data_size);
+#endif
+
 	if (SUSPEND_POFWARN()) {
 		rc = -ECANCELED;
 		goto unlock_and_exit;
@@ -486,13 +879,13 @@ int emds_store(void)
 	}
 
 	STRUCT_SECTION_FOREACH(emds_entry, ch) {
-		entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, ch);
+		snapshot_entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, ch);
 	}
 
 	struct emds_dynamic_entry *ch;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
-		entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, &ch->entry);
+		snapshot_entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, &ch->entry);
 	}
 
 	stream_fflush(&partition[idx], &data_off, data_chunk, &wp);
@@ -516,6 +909,10 @@ int emds_store(void)
 				      offsetof(struct emds_snapshot_metadata, reserved));
 	}
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	entries_dirty_reset(false);
+#endif
+
 unlock_and_exit:
 	emds_state = EMDS_STATE_INITIALIZED;
 	RESUME_POFWARN();
@@ -541,6 +938,10 @@ int emds_clear(void)
 	emds_state = EMDS_STATE_INITIALIZED;
 	memset(&freshest_snapshot, 0, sizeof(freshest_snapshot));
 	memset(&allocated_snapshot, 0, sizeof(allocated_snapshot));
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	data_loaded = false;
+	delta_snapshot = false;
+#endif
 	for (int i = 0; i < PARTITIONS_NUM_MAX; i++) {
 		rc = emds_flash_erase_partition(&partition[i]);
 		if (rc) {
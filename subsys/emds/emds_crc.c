@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "emds_crc.h"
+
+#include <string.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/util.h>
+
+/* The CRC of data continued over more data is affine in the starting CRC, and its linear part
+ * only depends on the length of the added data. That part is the operator for one byte raised
+ * to the power of the length, so two CRCs can be combined without the data in between.
+ */
+
+static uint32_t shift_apply(const uint32_t *shift, uint32_t crc)
+{
+	uint32_t res = 0;
+
+	for (int i = 0; crc; i++, crc >>= 1) {
+		if (crc & 1) {
+			res ^= shift[i];
+		}
+	}
+
+	return res;
+}
+
+/* res = a * b, res must not be one of the operands */
+static void shift_mul(uint32_t *res, const uint32_t *a, const uint32_t *b)
+{
+	for (int i = 0; i < EMDS_CRC_SHIFT_WORDS; i++) {
+		res[i] = shift_apply(a, b[i]);
+	}
+}
+
+void emds_crc_shift_init(uint32_t *shift, size_t len)
+{
+	uint32_t base[EMDS_CRC_SHIFT_WORDS];
+	uint32_t tmp[EMDS_CRC_SHIFT_WORDS];
+	const uint8_t zero = 0;
+	uint32_t offset = crc32_k_4_2_update(0, &zero, 1);
+
+	for (int i = 0; i < EMDS_CRC_SHIFT_WORDS; i++) {
+		base[i] = crc32_k_4_2_update(BIT(i), &zero, 1) ^ offset;
+		shift[i] = BIT(i);
+	}
+
+	while (len) {
+		if (len & 1) {
+			shift_mul(tmp, base, shift);
+			memcpy(shift, tmp, sizeof(tmp));
+		}
+
+		len >>= 1;
+
+		if (len) {
+			shift_mul(tmp, base, base);
+			memcpy(base, tmp, sizeof(tmp));
+		}
+	}
+}
+
+uint32_t emds_crc_combine(uint32_t crc, uint32_t crc_next, const uint32_t *shift)
+{
+	return shift_apply(shift, crc) ^ crc_next;
+}
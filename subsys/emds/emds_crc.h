@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef EMDS_CRC_H__
+#define EMDS_CRC_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of words in a CRC shift operator. */
+#define EMDS_CRC_SHIFT_WORDS 32
+
+/**
+ * @brief Prepare the operator that moves a CRC over the given number of bytes.
+ *
+ * The operator is a 32x32 bit matrix over GF(2), stored column by column. It is derived from
+ * crc32_k_4_2_update(), so it matches the CRC used for the snapshots. Building it takes
+ * O(log(len)) matrix products, so it should be done before the CRC is needed.
+ *
+ * @param shift Operator to prepare, @ref EMDS_CRC_SHIFT_WORDS words.
+ * @param len Number of bytes the operator moves a CRC over.
+ */
+void emds_crc_shift_init(uint32_t *shift, size_t len);
+
+/**
+ * @brief Combine the CRC of two consecutive blocks of data.
+ *
+ * Gives the same result as continuing the calculation of @p crc over the second block, without
+ * reading the data of the second block.
+ *
+ * @param crc CRC of the first block, or the running CRC of all the data before the second block.
+ * @param crc_next CRC of the second block, started from 0.
+ * @param shift Operator prepared by @ref emds_crc_shift_init for the length of the second block.
+ *
+ * @return CRC of both blocks.
+ */
+uint32_t emds_crc_combine(uint32_t crc, uint32_t crc_next, const uint32_t *shift);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EMDS_CRC_H__ */
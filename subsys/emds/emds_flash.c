@@ -22,6 +22,8 @@ LOG_MODULE_REGISTER(emds_flash, CONFIG_EMDS_LOG_LEVEL);
 #define SOC_NV_FLASH_NODE             DT_INST(0, soc_nv_flash)
 /* "EMDS" in ASCII */
 #define EMDS_SNAPSHOT_METADATA_MARKER 0x4D444553
+/* "EMDD" in ASCII */
+#define EMDS_SNAPSHOT_DELTA_MARKER    0x4D444544
 
 static void cand_list_init(sys_slist_t *cand_list, struct emds_snapshot_candidate *cand_buf)
 {
@@ -95,6 +97,60 @@ static bool cand_snapshot_crc_check(const struct emds_partition *partition,
 	return crc == metadata->snapshot_crc;
 }
 
+static bool marker_check(uint32_t marker)
+{
+	return marker == EMDS_SNAPSHOT_METADATA_MARKER ||
+	       (IS_ENABLED(CONFIG_EMDS_INCREMENTAL) && marker == EMDS_SNAPSHOT_DELTA_MARKER);
+}
+
+static uint32_t metadata_crc_get(const struct emds_snapshot_metadata *metadata)
+{
+	return crc32_k_4_2_update(0, (const unsigned char *)metadata,
+				  offsetof(struct emds_snapshot_metadata, metadata_crc));
+}
+
+/* Delta snapshots are only allocated right after the freshest snapshot of the partition, so the
+ * snapshot a delta is built on is in the previous metadata slot. Every snapshot down to the full
+ * one must be valid for the delta to be replayed.
+ */
+static bool cand_chain_check(const struct emds_partition *partition,
+			     struct emds_snapshot_candidate *cand)
+{
+	const struct flash_area *fa = partition->fa;
+	struct emds_snapshot_metadata link = cand->metadata;
+	off_t link_off = cand->metadata_off;
+	uint32_t fresh_cnt;
+	int rc;
+
+	cand->chain_len = 0;
+
+	while (link.marker == EMDS_SNAPSHOT_DELTA_MARKER) {
+		fresh_cnt = link.fresh_cnt;
+		link_off += sizeof(link);
+		cand->chain_len++;
+
+		if (link_off + sizeof(link) > fa->fa_size) {
+			LOG_DBG("Delta snapshot without full snapshot");
+			return false;
+		}
+
+		rc = flash_area_read(fa, link_off, &link, sizeof(link));
+		if (rc) {
+			LOG_ERR("Failed to read snapshot metadata: %d", rc);
+			return false;
+		}
+
+		if (!marker_check(link.marker) || metadata_crc_get(&link) != link.metadata_crc ||
+		    link.fresh_cnt != fresh_cnt - 1 || !cand_snapshot_crc_check(partition, &link)) {
+			LOG_DBG("Broken delta snapshot chain at address 0x%04lx",
+				fa->fa_off + link_off);
+			return false;
+		}
+	}
+
+	return true;
+}
+
 static bool metadata_iterator(off_t *read_off, int cur_failures)
 {
 	*read_off -= sizeof(struct emds_snapshot_metadata);
@@ -155,7 +211,6 @@ int emds_flash_scan_partition(const struct emds_partition *partition,
 	const struct flash_area *fa = partition->fa;
 	off_t read_off = fa->fa_size - sizeof(cache);
 	int failures = 0;
-	uint32_t crc;
 	int rc;
 
 	cand_list_init(&cand_list, cand_buf);
@@ -167,16 +222,14 @@ int emds_flash_scan_partition(const struct emds_partition *partition,
 			return rc;
 		}
 
-		if (cache.marker != EMDS_SNAPSHOT_METADATA_MARKER) {
+		if (!marker_check(cache.marker)) {
 			failures++;
 			LOG_DBG("Snapshot metadata marker mismatch at address 0x%04lx",
 				fa->fa_off + read_off);
 			continue;
 		}
 
-		crc = crc32_k_4_2_update(0, (const unsigned char *)&cache,
-					 offsetof(struct emds_snapshot_metadata, metadata_crc));
-		if (crc != cache.metadata_crc) {
+		if (metadata_crc_get(&cache) != cache.metadata_crc) {
 			failures++;
 			LOG_DBG("Snapshot metadata CRC mismatch at address 0x%04lx",
 				fa->fa_off + read_off);
@@ -197,7 +250,8 @@ int emds_flash_scan_partition(const struct emds_partition *partition,
 			break;
 		}
 
-		if (cand_snapshot_crc_check(partition, &cand->metadata)) {
+		if (cand_snapshot_crc_check(partition, &cand->metadata) &&
+		    cand_chain_check(partition, cand)) {
 			*candidate = *cand;
 			LOG_DBG("Found valid snapshot at address 0x%04lx with length %u with "
 				"fresh_cnt %u",
@@ -284,9 +338,7 @@ int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 	allocated_snapshot->metadata.marker = EMDS_SNAPSHOT_METADATA_MARKER;
 	allocated_snapshot->metadata.data_instance_off = data_off;
 	allocated_snapshot->metadata.data_instance_len = data_size;
-	allocated_snapshot->metadata.metadata_crc =
-		crc32_k_4_2_update(0, (const unsigned char *)&allocated_snapshot->metadata,
-				   offsetof(struct emds_snapshot_metadata, metadata_crc));
+	allocated_snapshot->metadata.metadata_crc = metadata_crc_get(&allocated_snapshot->metadata);
 	allocated_snapshot->metadata.snapshot_crc = 0;
 
 	LOG_DBG("Allocating snapshot at address 0x%04lx with length %u and fresh_cnt %u",
@@ -297,6 +349,20 @@ int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 	return 0;
 }
 
+void emds_flash_snapshot_update(struct emds_snapshot_candidate *snapshot, bool delta,
+				size_t data_size)
+{
+	snapshot->metadata.marker = delta ? EMDS_SNAPSHOT_DELTA_MARKER
+					  : EMDS_SNAPSHOT_METADATA_MARKER;
+	snapshot->metadata.data_instance_len = data_size;
+	snapshot->metadata.metadata_crc = metadata_crc_get(&snapshot->metadata);
+}
+
+bool emds_flash_snapshot_is_delta(const struct emds_snapshot_metadata *metadata)
+{
+	return metadata->marker == EMDS_SNAPSHOT_DELTA_MARKER;
+}
+
 static void nvmc_wait_ready(void)
 {
 #if defined CONFIG_SOC_FLASH_NRF_RRAM
@@ -55,6 +55,23 @@ struct emds_data_entry {
 	uint8_t data[];
 } __packed;
 
+/**
+ * @brief Emergency data storage delta entry structure
+ *
+ * Entry of a delta snapshot, holding the changed part of the entry data.
+ *
+ * @param id Unique data identifier.
+ * @param offset Offset of the changed data within the entry.
+ * @param length Changed data length.
+ * @param data Zero length array for data reference.
+ */
+struct emds_delta_entry {
+	uint16_t id;
+	uint16_t offset;
+	uint16_t length;
+	uint8_t data[];
+} __packed;
+
 /**
  * @brief Emergency data storage metadata structure
  *
@@ -94,12 +111,15 @@ struct emds_snapshot_metadata {
  * @param partition_index Belonged partition index.
  * @param metadata_off Offset of the metadata within the partition.
  * @param metadata The snapshot metadata.
+ * @param chain_len Number of delta snapshots from the full snapshot the candidate is built on,
+ *                  including the candidate itself. 0 for a full snapshot.
  */
 struct emds_snapshot_candidate {
 	sys_snode_t node;
 	int partition_index;
 	off_t metadata_off;
 	struct emds_snapshot_metadata metadata;
+	uint32_t chain_len;
 };
 
 /**
@@ -118,7 +138,9 @@ int emds_flash_init(struct emds_partition *partition);
  *
  * This function scans the specified partition for valid snapshots and populates
  * the candidate structure with the found snapshot metadata with the biggest
- * fresh_cnt value and valid metadata and snapshot crc values.
+ * fresh_cnt value and valid metadata and snapshot crc values. A delta snapshot
+ * is only valid if all the snapshots back to the full snapshot it is built on
+ * are valid.
  *
  * @param partition Pointer to the emergency data storage partition structure.
  * @param candidate Pointer to the emergency data storage snapshot candidate structure
@@ -163,6 +185,30 @@ int emds_flash_allocate_snapshot(const struct emds_partition *partition,
 void emds_flash_write_data(const struct emds_partition *partition, off_t data_off, void *data_chunk,
 			   size_t data_size);
 
+/**
+ * @brief Set the final type and length of an allocated snapshot.
+ *
+ * The snapshot is allocated for the largest possible data size. This function
+ * updates the metadata, including its crc, with the type and data size of the
+ * snapshot that is about to be written.
+ *
+ * @param snapshot Pointer to the allocated snapshot candidate structure.
+ * @param delta True if the snapshot is a delta snapshot.
+ * @param data_size The size of the data to be written.
+ */
+void emds_flash_snapshot_update(struct emds_snapshot_candidate *snapshot, bool delta,
+				size_t data_size);
+
+/**
+ * @brief Check if a snapshot is a delta snapshot.
+ *
+ * @param metadata Pointer to the snapshot metadata.
+ *
+ * @retval true if the snapshot holds delta entries.
+ * @retval false if the snapshot holds full entries.
+ */
+bool emds_flash_snapshot_is_delta(const struct emds_snapshot_metadata *metadata);
+
 /**
  * @brief Erase the specified emergency data storage partition.
  *
@@ -51,6 +51,32 @@ struct emp_cmd_subscribe {
 	char name[];
 };
 
+/**
+ * @brief The header of an event in a batch.
+ *
+ * The event data follows the header and is padded to a multiple of 4 bytes.
+ */
+struct emp_batch_record {
+	uint32_t size;
+	uint32_t data[];
+};
+
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+/** @brief Batch of events collected for one remote. */
+struct emp_batch {
+	struct k_mutex lock;
+	struct k_work_delayable flush_work;
+	/* Buffer of the batch, NULL if no event is pending. */
+	uint8_t *buf;
+	uint32_t buf_size;
+	size_t len;
+	/* True if the buffer was obtained from the IPC service. */
+	bool nocopy;
+	/* Buffer used if the IPC service backend does not provide TX buffers. */
+	uint32_t local_buf[CONFIG_EVENT_MANAGER_PROXY_BATCH_SIZE / sizeof(uint32_t)];
+};
+#endif
+
 /** @brief Inter-core communication data. */
 struct emp_ipc_data {
 	struct ipc_ept ept;
@@ -59,6 +85,9 @@ struct emp_ipc_data {
 	bool started;
 	struct k_event bound;
 	const struct event_type **event_type_map;
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+	struct emp_batch batch;
+#endif
 };
 
 
@@ -153,12 +182,43 @@ static void handle_ipc_endpoint_bound(void *priv)
 
 static void handle_remote_event(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
-	void *event = app_event_manager_alloc(len);
+	const struct app_event_header *aeh = data;
+	void *event;
+
+	/* The sender sets the type of the event to the local one. */
+	if (app_event_get_type_flag(aeh->type_id, APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) {
+		event = _app_event_manager_alloc_dyndata(len);
+	} else {
+		event = app_event_manager_alloc(len);
+	}
 
 	memcpy(event, data, len);
 	_event_submit(event);
 }
 
+static void handle_remote_batch(struct emp_ipc_data *ipc, const void *data, size_t len)
+{
+	const uint8_t *pos = data;
+	const uint8_t *end = pos + len;
+
+	while (pos < end) {
+		const struct emp_batch_record *rec = (const struct emp_batch_record *)pos;
+		size_t left = end - pos;
+
+		if ((left < sizeof(*rec)) ||
+		    ((left - sizeof(*rec)) < rec->size) ||
+		    (rec->size < sizeof(struct app_event_header))) {
+			LOG_ERR("Malformed event batch");
+			__ASSERT_NO_MSG(false);
+			return;
+		}
+
+		handle_remote_event(ipc, rec->data, rec->size);
+
+		pos += sizeof(*rec) + ROUND_UP(rec->size, sizeof(uint32_t));
+	}
+}
+
 static void handle_remote_command_subscribe(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
 	if (ipc->started) {
@@ -256,7 +316,11 @@ static void handle_ipc_data_receive(const void *data, size_t len, void *priv)
 	__ASSERT_NO_MSG(!k_is_in_isr());
 
 	if (ipc->started && emp_started) {
-		handle_remote_event(ipc, data, len);
+		if (IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)) {
+			handle_remote_batch(ipc, data, len);
+		} else {
+			handle_remote_event(ipc, data, len);
+		}
 	} else {
 		handle_remote_command(ipc, data, len);
 	}
@@ -274,15 +338,152 @@ static void handle_ipc_endpoint_error(const char *message, void *priv)
 	__ASSERT_NO_MSG(false);
 }
 
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+static int batch_flush(struct emp_ipc_data *ipc)
+{
+	struct emp_batch *batch = &ipc->batch;
+	int ret = 0;
+
+	if (!batch->buf) {
+		return 0;
+	}
+
+	for (size_t cnt = CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES + 1; cnt > 0; --cnt) {
+		if (batch->nocopy) {
+			ret = ipc_service_send_nocopy(&ipc->ept, batch->buf, batch->len);
+		} else {
+			ret = ipc_service_send(&ipc->ept, batch->buf, batch->len);
+		}
+		if (ret >= 0) {
+			break;
+		}
+		k_usleep(1);
+	}
+
+	if (ret < 0) {
+		LOG_ERR("Cannot send event batch to remote %p, err: %d", ipc, ret);
+		__ASSERT_NO_MSG(false);
+		if (batch->nocopy) {
+			(void)ipc_service_drop_tx_buffer(&ipc->ept, batch->buf);
+		}
+	}
+
+	batch->buf = NULL;
+	batch->len = 0;
+
+	/* The next batch schedules its own flush when its first event is added. */
+	(void)k_work_cancel_delayable(&batch->flush_work);
+
+	return ret;
+}
+
+static void batch_flush_work_fn(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct emp_batch *batch = CONTAINER_OF(dwork, struct emp_batch, flush_work);
+	struct emp_ipc_data *ipc = CONTAINER_OF(batch, struct emp_ipc_data, batch);
+
+	k_mutex_lock(&batch->lock, K_FOREVER);
+	(void)batch_flush(ipc);
+	k_mutex_unlock(&batch->lock);
+}
+
+static void batch_buf_get(struct emp_ipc_data *ipc)
+{
+	struct emp_batch *batch = &ipc->batch;
+	void *data;
+	uint32_t size = CONFIG_EVENT_MANAGER_PROXY_BATCH_SIZE;
+	int ret;
+
+	/* Write the events directly to the shared memory if the backend allows it. */
+	ret = ipc_service_get_tx_buffer(&ipc->ept, &data, &size, K_NO_WAIT);
+	if (ret == -ENOMEM) {
+		/* The size is set to the maximum TX buffer size. */
+		ret = ipc_service_get_tx_buffer(&ipc->ept, &data, &size, K_NO_WAIT);
+	}
+
+	if (ret >= 0) {
+		batch->buf = data;
+		batch->buf_size = MIN(size, CONFIG_EVENT_MANAGER_PROXY_BATCH_SIZE);
+		batch->nocopy = true;
+	} else {
+		batch->buf = (uint8_t *)batch->local_buf;
+		batch->buf_size = sizeof(batch->local_buf);
+		batch->nocopy = false;
+	}
+
+	batch->len = 0;
+}
+
+static int send_event_to_remote_batched(struct emp_ipc_data *ipc,
+					const struct app_event_header *eh,
+					const struct event_type *remote_ev)
+{
+	struct emp_batch *batch = &ipc->batch;
+	size_t size = app_event_manager_event_size(eh);
+	size_t rec_size = sizeof(struct emp_batch_record) + ROUND_UP(size, sizeof(uint32_t));
+	int ret = 0;
+
+	k_mutex_lock(&batch->lock, K_FOREVER);
+
+	if (batch->buf && ((batch->len + rec_size) > batch->buf_size)) {
+		ret = batch_flush(ipc);
+	}
+
+	if (!batch->buf) {
+		batch_buf_get(ipc);
+	}
+
+	if (rec_size > batch->buf_size) {
+		LOG_ERR("Event %s does not fit the batch buffer", eh->type_id->name);
+		__ASSERT_NO_MSG(false);
+		if (batch->len == 0) {
+			if (batch->nocopy) {
+				(void)ipc_service_drop_tx_buffer(&ipc->ept, batch->buf);
+			}
+			batch->buf = NULL;
+		}
+		k_mutex_unlock(&batch->lock);
+		return -ENOMEM;
+	}
+
+	struct emp_batch_record *rec = (struct emp_batch_record *)&batch->buf[batch->len];
+	struct app_event_header *remote_eh = (struct app_event_header *)rec->data;
+
+	rec->size = size;
+	memcpy(rec->data, eh, size);
+	remote_eh->type_id = remote_ev;
+	batch->len += rec_size;
+
+	if (batch->len == rec_size) {
+		/* First event in the batch. */
+		(void)k_work_schedule(&batch->flush_work,
+				      K_MSEC(CONFIG_EVENT_MANAGER_PROXY_BATCH_FLUSH_INTERVAL_MS));
+	}
+
+	if ((batch->buf_size - batch->len) < sizeof(struct emp_batch_record)) {
+		ret = batch_flush(ipc);
+	}
+
+	k_mutex_unlock(&batch->lock);
+
+	return ret;
+}
+#endif /* CONFIG_EVENT_MANAGER_PROXY_BATCHING */
+
 static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
 {
 	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
-	int ret;
 
 	if (remote_ev == NULL) {
 		return 0;
 	}
 
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+	return send_event_to_remote_batched(ipc, eh, remote_ev);
+#else
+	int ret;
+
 	size_t size = app_event_manager_event_size(eh);
 	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
 	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
@@ -304,6 +505,7 @@ static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event
 	}
 
 	return ret;
+#endif
 }
 
 static void event_manager_proxy_on_event_process(const struct app_event_header *eh)
@@ -356,6 +558,12 @@ static int add_ipc_instace(struct emp_ipc_data *ipc, const struct device *instan
 
 	k_event_init(&ipc->bound);
 
+#if IS_ENABLED(CONFIG_EVENT_MANAGER_PROXY_BATCHING)
+	k_mutex_init(&ipc->batch.lock);
+	k_work_init_delayable(&ipc->batch.flush_work, batch_flush_work_fn);
+	ipc->batch.buf = NULL;
+#endif
+
 	ret = ipc_service_register_endpoint(instance, &ipc->ept, &ipc->ept_cfg);
 	if (ret) {
 		LOG_ERR("Error registering endpoint in ipc service (%d)", ret);
@@ -432,7 +432,10 @@ static int downloader_start(struct downloader *dl, const struct downloader_host_
 			k_mutex_unlock(&dl->mutex);
 			return -EINVAL;
 		}
-		if (strncmp(hostname, dl->hostname, sizeof(hostname)) == 0) {
+		/* A download which was stopped may have left responses in flight,
+		 * so the connection is only reused once the previous download completed.
+		 */
+		if (strncmp(hostname, dl->hostname, sizeof(hostname)) == 0 && dl->complete) {
 			host_connected = true;
 		}
 	}
@@ -502,8 +505,8 @@ static int downloader_start(struct downloader *dl, const struct downloader_host_
 			state_set(dl, DOWNLOADER_CONNECTED, DOWNLOADER_DOWNLOADING);
 			goto out;
 		} else if (transport_connected) {
-			/* We are connected to the wrong host */
-			LOG_DBG("Closing connection to connect different host or protocol");
+			/* We are connected to the wrong host, or the connection can't be reused */
+			LOG_DBG("Closing connection to connect again");
 			transport_connected->close(dl);
 			transport_connected->deinit(dl);
 			state_set(dl, DOWNLOADER_CONNECTED, DOWNLOADER_IDLE);
@@ -80,6 +80,10 @@ struct transport_params_http {
 	bool ranged;
 	/** Ranged progress */
 	size_t ranged_progress;
+	/** Offset of the next byte to request */
+	size_t req_offset;
+	/** Range requests sent and not yet fully received */
+	uint8_t reqs_pending;
 	/** HTTP header */
 	struct {
 		/** Header length */
@@ -180,6 +184,8 @@ static int http_get_request_send(struct downloader *dl)
 			       dl->hostname, dl->progress, off);
 		http->ranged = true;
 		http->ranged_progress = 0;
+		http->req_offset = off + 1;
+		http->reqs_pending = 1;
 		LOG_DBG("Range request up to %d bytes", dl->host_cfg.range_override);
 		goto send;
 	} else if (dl->progress) {
@@ -213,6 +219,64 @@ send:
 	return 0;
 }
 
+/* Keep up to the configured number of range requests in flight on the connection.
+ * The requests are written to the unused end of the buffer, and are postponed if they
+ * do not fit.
+ */
+static int http_pipeline_fill(struct downloader *dl)
+{
+	int err;
+	int len;
+	size_t off;
+	char *req;
+	size_t req_size;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	/* The ranges are only known once the file size is */
+	while (http->ranged && dl->file_size && !http->connection_close &&
+	       http->reqs_pending < http->cfg.pipeline_depth && http->req_offset < dl->file_size) {
+		req = dl->cfg.buf + dl->buf_offset;
+		req_size = dl->cfg.buf_size - dl->buf_offset;
+		off = MIN(http->req_offset + dl->host_cfg.range_override, dl->file_size) - 1;
+
+		len = snprintf(req, req_size, HTTP_GET_RANGE, dl->file, dl->hostname,
+			       http->req_offset, off);
+		if (len < 0 || len >= req_size) {
+			/* Send it when more of the buffer is free */
+			break;
+		}
+
+		LOG_DBG("Pipelined range request %u-%u", http->req_offset, off);
+
+		err = dl_socket_send(http->sock.fd, req, len);
+		if (err) {
+			LOG_ERR("Failed to send HTTP request, errno %d", errno);
+			return err;
+		}
+
+		http->req_offset = off + 1;
+		http->reqs_pending++;
+	}
+
+	return 0;
+}
+
+/* Number of payload bytes left in the response being received. */
+static size_t http_resp_left(struct downloader *dl)
+{
+	size_t resp_len;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	resp_len = MIN(dl->host_cfg.range_override,
+		       dl->file_size - (dl->progress - http->ranged_progress));
+
+	return resp_len - http->ranged_progress;
+}
+
 /* Returns:
  * Number of bytes parsed on success.
  * Negative errno on error.
@@ -389,16 +453,16 @@ static int http_header_parse(struct downloader *dl, size_t buf_len)
 		return parse_len;
 	}
 
-	q = dl->cfg.buf + buf_len;
+	q = dl->cfg.buf + buf_len - 1;
 	/* We are still missing part of the header.
-	 * Return the lines (in number of bytes) that we have parsed.
+	 * Return the complete lines (in number of bytes) that we have parsed.
 	 */
-	while (q > dl->cfg.buf && (*q != '\r') && (*q != '\n')) {
+	while (q > dl->cfg.buf && *q != '\n') {
 		q--;
 	}
 
 	/* Keep \r and \n in the buffer in case it is part of the header ending. */
-	while (*(q - 1) == '\r' || *(q - 1) == '\n') {
+	while (q > dl->cfg.buf && (*(q - 1) == '\r' || *(q - 1) == '\n')) {
 		q--;
 	}
 
@@ -440,6 +504,9 @@ static int http_parse(struct downloader *dl, size_t len)
 			len = len - parsed_len;
 			memmove(dl->cfg.buf, dl->cfg.buf + parsed_len, len);
 			dl->buf_offset = len;
+		} else {
+			/* Keep the partial line */
+			dl->buf_offset = len;
 		}
 
 		if (!http->header.has_end) {
@@ -577,6 +644,7 @@ static int dl_http_connect(struct downloader *dl)
 
 	http->connection_close = false;
 	http->new_data_req = true;
+	http->reqs_pending = 0;
 
 	return err;
 }
@@ -601,6 +669,7 @@ static int dl_http_close(struct downloader *dl)
 static int dl_http_download(struct downloader *dl)
 {
 	int ret, recv_len, data_len, expected_len;
+	size_t len, resp_left, next_len;
 	struct transport_params_http *http;
 
 	http = (struct transport_params_http *)dl->transport_internal;
@@ -618,6 +687,12 @@ static int dl_http_download(struct downloader *dl)
 		http->new_data_req = false;
 	}
 
+	ret = http_pipeline_fill(dl);
+	if (ret) {
+		LOG_DBG("Pipelined request failed, err %d", ret);
+		return -ECONNRESET;
+	}
+
 	__ASSERT(dl->buf_offset < dl->cfg.buf_size, "Buffer overflow");
 
 	LOG_DBG("Receiving up to %d bytes at %p...", (dl->cfg.buf_size - dl->buf_offset),
@@ -647,40 +722,74 @@ static int dl_http_download(struct downloader *dl)
 		return recv_len;
 	}
 
-	data_len = http_parse(dl, recv_len + dl->buf_offset);
-	if (data_len < 0) {
-		return data_len;
-	}
+	len = recv_len + dl->buf_offset;
 
-	expected_len = MIN(MIN_SIZE_IDENTIFY_BUF, dl->file_size - dl->progress);
+	do {
+		data_len = http_parse(dl, len);
+		if (data_len < 0) {
+			return data_len;
+		}
 
-	if (data_len < expected_len) {
-		/* Wait for more data after the HTTP headers,
-		 * so we don't end up forwarding too small chunks to FOTA library.
-		 */
-		return recv_len > 0 ? 0 : -ECONNRESET; /* Fail if closed while expecting more */
-	}
+		if (!http->header.has_end) {
+			/* Wait for the rest of the header */
+			return recv_len > 0 ? 0 : -ECONNRESET;
+		}
 
-	/* Accumulate progress */
-	dl->progress += data_len;
-	if (data_len) {
-		dl_transport_evt_data(dl, dl->cfg.buf, data_len);
-	}
-	if (http->ranged) {
-		http->ranged_progress += data_len;
-		if (http->ranged_progress < dl->host_cfg.range_override) {
-			/* Ranged query: read until a full fragment is received */
-		} else {
-			/* Ranged query: request next fragment */
+		expected_len = MIN(MIN_SIZE_IDENTIFY_BUF, dl->file_size - dl->progress);
+		next_len = 0;
+
+		if (http->ranged && dl->file_size) {
+			/* Don't wait for more than the rest of the response */
+			resp_left = http_resp_left(dl);
+			expected_len = MIN(expected_len, resp_left);
+
+			if (http->reqs_pending > 1 && data_len > resp_left) {
+				/* Pipelined responses: anything past the end of this response
+				 * is the beginning of the next one.
+				 */
+				next_len = data_len - resp_left;
+				data_len = resp_left;
+			}
+		}
+
+		if (data_len < expected_len) {
+			/* Wait for more data after the HTTP headers,
+			 * so we don't end up forwarding too small chunks to FOTA library.
+			 * Fail if closed while expecting more.
+			 */
+			return recv_len > 0 ? 0 : -ECONNRESET;
+		}
+
+		/* Accumulate progress */
+		dl->progress += data_len;
+		if (data_len) {
+			dl_transport_evt_data(dl, dl->cfg.buf, data_len);
+		}
+		if (http->ranged) {
+			http->ranged_progress += data_len;
+			if (http->ranged_progress < dl->host_cfg.range_override) {
+				/* Ranged query: read until a full fragment is received */
+			} else if (--http->reqs_pending) {
+				/* Ranged query: the next fragment is already requested */
+				http->header.has_end = false;
+				http->ranged_progress = 0;
+			} else {
+				/* Ranged query: request next fragment */
+				http->new_data_req = true;
+			}
+		}
+		if (dl->progress == dl->file_size) {
+			/* A full file has been received */
+			dl->complete = true;
 			http->new_data_req = true;
+			http->reqs_pending = 0;
 		}
-	}
-	if (dl->progress == dl->file_size) {
-		/* A full file has been received */
-		dl->complete = true;
-		http->new_data_req = true;
-	}
-	dl->buf_offset = 0;
+
+		/* Keep the beginning of the next response */
+		memmove(dl->cfg.buf, dl->cfg.buf + data_len, next_len);
+		dl->buf_offset = next_len;
+		len = next_len;
+	} while (len && !dl->complete);
 
 	if (dl->complete) {
 		return 0;
@@ -245,6 +245,64 @@ int nrf_cloud_coap_patch(const char *resource, const char *query,
 			 enum coap_content_format fmt, bool reliable,
 			 coap_client_response_cb_t cb, void *user);
 
+/**@brief Completion callback of an asynchronous CoAP request.
+ *
+ * Called once the request has ended, from the CoAP client thread, or from the thread closing
+ * the connection when the request is cancelled. It must not block.
+ * The request counts no longer against @kconfig{CONFIG_NRF_CLOUD_COAP_ASYNC_REQUESTS_MAX},
+ * but its request slot of the CoAP client is released only after the callback returns.
+ * A new asynchronous request can be started from the callback, because the CoAP client has
+ * at least one more request slot than there can be asynchronous requests.
+ *
+ * @param result 0 if the request succeeded, a positive value indicating a CoAP result code,
+ * or a negative error number. -ECANCELED if the connection was closed before the response.
+ * @param user Pointer to user-specific data of the request.
+ */
+typedef void (*nrf_cloud_coap_async_cb_t)(int result, void *user);
+
+/** @brief Asynchronous CoAP request. */
+struct nrf_cloud_coap_async_req {
+	/** CoAP method of the request. */
+	enum coap_method method;
+	/** String containing the specific CoAP endpoint to access. */
+	const char *resource;
+	/** Optional string containing REST-style query parameters. */
+	const char *query;
+	/** Optional payload. Must stay valid until the completion callback is called. */
+	const uint8_t *buf;
+	/** Length of payload or 0 if none. */
+	size_t len;
+	/** CoAP content format for the Content-Format message option of the payload. */
+	enum coap_content_format fmt_out;
+	/** CoAP content format for the Accept message option of the returned payload. */
+	enum coap_content_format fmt_in;
+	/** True to add the Accept message option to the request. */
+	bool response_expected;
+	/** Optional callback to receive the response data. */
+	coap_client_response_cb_t cb;
+	/** Callback called once the request has ended. */
+	nrf_cloud_coap_async_cb_t done_cb;
+	/** Pointer to user-specific data to be passed back to the callbacks. */
+	void *user;
+};
+
+/**@brief Start a confirmable CoAP request without waiting for the response.
+ *
+ * Up to @kconfig{CONFIG_NRF_CLOUD_COAP_ASYNC_REQUESTS_MAX} requests can wait for their
+ * responses at the same time, so that their round trips overlap. The synchronous request
+ * functions can be used while asynchronous requests are in progress.
+ * The request structure itself is not needed after the function returns.
+ *
+ * @param req Request to send.
+ * @retval 0 The request was sent and the completion callback will be called.
+ * @retval -EINVAL Invalid request.
+ * @retval -EACCES Not connected to nRF Cloud.
+ * @retval -EBUSY The maximum number of asynchronous requests is in progress.
+ * @return A negative error number if the request could not be sent,
+ *         the completion callback is not called in that case.
+ */
+int nrf_cloud_coap_async_request(const struct nrf_cloud_coap_async_req *req);
+
 /**
  * @brief Send binary log data to nRF Cloud on the /msg/d2c/bin topic. The data sent should
  * come from the nrf_cloud_log_backend. It will be assembled in sequential order and made
@@ -97,22 +97,20 @@ static int encode_message(struct nrf_cloud_obj_coap_cbor *msg, uint8_t *buf, siz
 			*len = out_len;
 		}
 	} else if (fmt == COAP_CONTENT_FORMAT_APP_JSON) {
-		struct nrf_cloud_data out;
-
-		err = nrf_cloud_encode_message(msg->app_id, msg->double_val, msg->str_val, NULL,
-					       msg->ts, &out);
+		struct nrf_cloud_json_stream stream;
+		bool is_str = (msg->type == NRF_CLOUD_DATA_TYPE_STR);
+
+		/* Write the JSON text directly into the buffer, without building a cJSON tree.
+		 * Only the union member selected by the type is valid.
+		 */
+		nrf_cloud_json_stream_init(&stream, (char *)buf, *len);
+		err = nrf_cloud_encode_message_stream(msg->app_id, is_str ? 0 : msg->double_val,
+						      is_str ? msg->str_val : NULL,
+						      NULL, msg->ts, &stream);
 		if (err) {
-			*len = 0;
-		} else if (*len <= out.len) {
-			*len = 0;
-			cJSON_free((void *)out.ptr);
-			err = -E2BIG;
-		} else {
-			*len = out.len;
-			memcpy(buf, out.ptr, *len);
-			buf[*len - 1] = '\0';
-			cJSON_free((void *)out.ptr);
+			LOG_ERR("Error %d encoding message", err);
 		}
+		(void)nrf_cloud_json_stream_finish(&stream, len);
 	} else {
 		err = -EINVAL;
 	}
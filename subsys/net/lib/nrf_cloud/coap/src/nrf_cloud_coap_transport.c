@@ -58,9 +58,12 @@ LOG_MODULE_REGISTER(nrf_cloud_coap_transport, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
 struct cc_xfer_data {
 	struct nrf_cloud_coap_client *nrfc_cc;
 	coap_client_response_cb_t cb;
+	/* Completion callback, set only for asynchronous transfers */
+	nrf_cloud_coap_async_cb_t done_cb;
 	void *user_data;
 	int result_code;
 	struct k_sem *sem;
+	struct coap_client_request request;
 	atomic_t used;
 };
 
@@ -70,6 +73,15 @@ static K_SEM_DEFINE(cb_sem, 0, 1);
 static K_SEM_DEFINE(ext_cc_sem, 0, 1);
 /* Mutex to be used when using the internal coap_client */
 static K_MUTEX_DEFINE(internal_transfer_mut);
+/* A completing request keeps its slot in coap_client until its completion callback returns,
+ * one more slot is needed for the request started from the callback.
+ */
+BUILD_ASSERT(CONFIG_NRF_CLOUD_COAP_ASYNC_REQUESTS_MAX < CONFIG_COAP_CLIENT_MAX_REQUESTS,
+	     "CONFIG_NRF_CLOUD_COAP_ASYNC_REQUESTS_MAX must be lower than "
+	     "CONFIG_COAP_CLIENT_MAX_REQUESTS");
+/* Semaphore to limit the number of asynchronous requests waiting for a response */
+static K_SEM_DEFINE(async_sem, CONFIG_NRF_CLOUD_COAP_ASYNC_REQUESTS_MAX,
+		    CONFIG_NRF_CLOUD_COAP_ASYNC_REQUESTS_MAX);
 
 static struct nrf_cloud_coap_client internal_cc = {0};
 
@@ -155,6 +167,7 @@ static struct cc_xfer_data *xfer_data_init(struct nrf_cloud_coap_client *cc,
 	}
 	xfer->nrfc_cc = cc;
 	xfer->cb = cb;
+	xfer->done_cb = NULL;
 	xfer->user_data = user;
 	xfer->result_code = -ECANCELED;
 	xfer->sem = sem;
@@ -221,6 +234,38 @@ exit:
 	return err;
 }
 
+#if defined(CONFIG_NRF_CLOUD_SEND_SHADOW_INFO_BUF_SIZE) && \
+	(CONFIG_NRF_CLOUD_SEND_SHADOW_INFO_BUF_SIZE > 0)
+/* Write the info sections directly into a static buffer and send them */
+static int info_sections_stream_send(const char * const app_ver)
+{
+	static char buf[CONFIG_NRF_CLOUD_SEND_SHADOW_INFO_BUF_SIZE];
+	struct nrf_cloud_json_stream stream;
+	int err;
+
+	nrf_cloud_json_stream_init(&stream, buf, sizeof(buf));
+	err = nrf_cloud_enabled_info_sections_json_stream_encode(&stream, app_ver);
+	if (err) {
+		return err;
+	}
+
+	err = nrf_cloud_coap_shadow_state_update(buf);
+	if (err) {
+		LOG_ERR("Failed to update info sections in shadow, error: %d", err);
+		return -EIO;
+	}
+
+	return 0;
+}
+#else
+static int info_sections_stream_send(const char * const app_ver)
+{
+	ARG_UNUSED(app_ver);
+
+	return -E2BIG;
+}
+#endif
+
 static int update_configured_info_sections(const char * const app_ver)
 {
 	static bool updated;
@@ -229,9 +274,20 @@ static int update_configured_info_sections(const char * const app_ver)
 		return -EALREADY;
 	}
 
-	/* Create a JSON object to contain shadow info sections */
+	int err = info_sections_stream_send(app_ver);
+
+	if (err == -ENODEV) {
+		/* No info sections are enabled */
+		return 0;
+	} else if (err != -E2BIG) {
+		updated = !err;
+		return err;
+	}
+
+	/* Buffer too small, create a JSON object to contain shadow info sections */
 	NRF_CLOUD_OBJ_JSON_DEFINE(info_obj);
-	int err = nrf_cloud_obj_init(&info_obj);
+
+	err = nrf_cloud_obj_init(&info_obj);
 
 	if (err) {
 		LOG_ERR("Failed to initialize object: %d", err);
@@ -369,6 +425,24 @@ int nrf_cloud_coap_resume(void)
 	return err;
 }
 
+/* End an asynchronous transfer and free its transfer data before reporting the result */
+static void async_complete(struct cc_xfer_data *xfer, int result_code)
+{
+	nrf_cloud_coap_async_cb_t done_cb = xfer->done_cb;
+	void *user = xfer->user_data;
+
+	if (!atomic_test_and_clear_bit(&xfer->used, 0)) {
+		return;
+	}
+	k_sem_give(&async_sem);
+
+	if ((result_code > 0) && (result_code < COAP_RESPONSE_CODE_BAD_REQUEST)) {
+		result_code = 0;
+	}
+	LOG_DBG("End of async transfer: %d", result_code);
+	done_cb(result_code, user);
+}
+
 static void client_callback(const struct coap_client_response_data *data, void *user_data)
 {
 	__ASSERT_NO_MSG(user_data != NULL);
@@ -406,26 +480,25 @@ static void client_callback(const struct coap_client_response_data *data, void *
 			k_sem_give(xfer->sem);
 		}
 	}
+	if (xfer->done_cb && (data->last_block || (data->result_code < 0) ||
+			      (data->result_code >= COAP_RESPONSE_CODE_BAD_REQUEST))) {
+		async_complete(xfer, data->result_code);
+	}
 }
 
 
-static int client_transfer(enum coap_method method,
-			   const char *resource, const char *query,
-			   const uint8_t *buf, size_t buf_len,
-			   enum coap_content_format fmt_out,
-			   enum coap_content_format fmt_in,
-			   bool response_expected,
-			   bool reliable,
-			   struct cc_xfer_data *xfer)
+static int request_init(struct coap_client_request *request, enum coap_method method,
+			const char *resource, const char *query,
+			const uint8_t *buf, size_t buf_len,
+			enum coap_content_format fmt_out,
+			enum coap_content_format fmt_in,
+			bool response_expected,
+			bool reliable,
+			struct cc_xfer_data *xfer)
 {
-	if (xfer == NULL) {
-		return -ENOBUFS;
-	}
-	__ASSERT_NO_MSG(resource != NULL);
+	int err;
 
-	int err = 0;
-	int retry;
-	struct coap_client_request request = {
+	*request = (struct coap_client_request) {
 		.method = method,
 		.confirmable = reliable,
 		.fmt = fmt_out,
@@ -434,39 +507,65 @@ static int client_transfer(enum coap_method method,
 		.cb = client_callback,
 		.user_data = xfer
 	};
-	struct coap_client *const cc = &xfer->nrfc_cc->cc;
 
 	if (response_expected) {
-		request.options[0].code = COAP_OPTION_ACCEPT;
-		request.options[0].len = 1;
-		request.options[0].value[0] = fmt_in;
-		request.num_options = 1;
+		request->options[0].code = COAP_OPTION_ACCEPT;
+		request->options[0].len = 1;
+		request->options[0].value[0] = fmt_in;
+		request->num_options = 1;
 	} else {
-		request.num_options = 0;
+		request->num_options = 0;
 	}
 
 	if (!query) {
-		strncpy(request.path, resource, MAX_PATH_SIZE);
-		request.path[MAX_PATH_SIZE - 1] = '\0';
+		strncpy(request->path, resource, MAX_PATH_SIZE);
+		request->path[MAX_PATH_SIZE - 1] = '\0';
 	} else {
-		err = snprintk(request.path, sizeof(request.path), "%s?%s", resource, query);
-		if ((err <= 0) || (err >= sizeof(request.path))) {
+		err = snprintk(request->path, sizeof(request->path), "%s?%s", resource, query);
+		if ((err <= 0) || (err >= sizeof(request->path))) {
 			LOG_ERR("Could not format string");
-			err = -ETXTBSY;
-			goto transfer_end;
+			return -ETXTBSY;
 		}
 	}
 
 #if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
 	LOG_DBG("%s %s %s Content-Format:%s, %zd bytes out, Accept:%s", reliable ? "CON" : "NON",
-		METHOD_NAME(method), request.path, fmt_name(fmt_out), buf_len,
+		METHOD_NAME(method), request->path, fmt_name(fmt_out), buf_len,
 		response_expected ? fmt_name(fmt_in) : "none");
 #endif /* CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG */
 
+	return 0;
+}
+
+static int client_transfer(enum coap_method method,
+			   const char *resource, const char *query,
+			   const uint8_t *buf, size_t buf_len,
+			   enum coap_content_format fmt_out,
+			   enum coap_content_format fmt_in,
+			   bool response_expected,
+			   bool reliable,
+			   struct cc_xfer_data *xfer)
+{
+	if (xfer == NULL) {
+		return -ENOBUFS;
+	}
+	__ASSERT_NO_MSG(resource != NULL);
+
+	int err;
+	int retry;
+	struct coap_client_request *const request = &xfer->request;
+	struct coap_client *const cc = &xfer->nrfc_cc->cc;
+
+	err = request_init(request, method, resource, query, buf, buf_len, fmt_out, fmt_in,
+			   response_expected, reliable, xfer);
+	if (err) {
+		goto transfer_end;
+	}
+
 	retry = 0;
 	k_sem_reset(xfer->sem);
 	while ((xfer->nrfc_cc->sock >= 0) &&
-	       (err = coap_client_req(cc, xfer->nrfc_cc->sock, NULL, &request, NULL)) == -EAGAIN) {
+	       (err = coap_client_req(cc, xfer->nrfc_cc->sock, NULL, request, NULL)) == -EAGAIN) {
 		if (!nrf_cloud_coap_is_connected()) {
 			err = -EACCES;
 			break;
@@ -517,47 +616,52 @@ static int client_transfer(enum coap_method method,
 	}
 
 transfer_end:
+	/* Cancel before the release, the request is part of the transfer data */
+	coap_client_cancel_request(cc, request);
 	xfer_ctx_release(xfer);
-	coap_client_cancel_request(cc, &request);
 	if (err == -ETIMEDOUT && IS_ENABLED(CONFIG_NRF_CLOUD_COAP_DISCONNECT_ON_FAILED_REQUEST)) {
 		nrf_cloud_coap_disconnect();
 	}
 	return err;
 }
 
-int nrf_cloud_coap_get(const char *resource, const char *query,
-		       const uint8_t *buf, size_t len,
-		       enum coap_content_format fmt_out,
-		       enum coap_content_format fmt_in, bool reliable,
-		       coap_client_response_cb_t cb, void *user)
+static int sync_transfer(enum coap_method method,
+			 const char *resource, const char *query,
+			 const uint8_t *buf, size_t len,
+			 enum coap_content_format fmt_out,
+			 enum coap_content_format fmt_in,
+			 bool response_expected, bool reliable,
+			 coap_client_response_cb_t cb, void *user)
 {
 	int err = 0;
 
 	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
 	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
 
-	err = client_transfer(COAP_METHOD_GET, resource, query,
-			      buf, len, fmt_out, fmt_in, true, reliable, xfer);
+	err = client_transfer(method, resource, query,
+			      buf, len, fmt_out, fmt_in, response_expected, reliable, xfer);
 	k_mutex_unlock(&internal_transfer_mut);
 
 	return err;
 }
 
+int nrf_cloud_coap_get(const char *resource, const char *query,
+		       const uint8_t *buf, size_t len,
+		       enum coap_content_format fmt_out,
+		       enum coap_content_format fmt_in, bool reliable,
+		       coap_client_response_cb_t cb, void *user)
+{
+	return sync_transfer(COAP_METHOD_GET, resource, query, buf, len, fmt_out, fmt_in,
+			     true, reliable, cb, user);
+}
+
 int nrf_cloud_coap_post(const char *resource, const char *query,
 			const uint8_t *buf, size_t len,
 			enum coap_content_format fmt, bool reliable,
 			coap_client_response_cb_t cb, void *user)
 {
-	int err = 0;
-
-	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
-	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
-
-	err = client_transfer(COAP_METHOD_POST, resource, query,
-			      buf, len, fmt, fmt, false, reliable, xfer);
-	k_mutex_unlock(&internal_transfer_mut);
-
-	return err;
+	return sync_transfer(COAP_METHOD_POST, resource, query, buf, len, fmt, fmt,
+			     false, reliable, cb, user);
 }
 
 int nrf_cloud_coap_put(const char *resource, const char *query,
@@ -565,16 +669,8 @@ int nrf_cloud_coap_put(const char *resource, const char *query,
 		       enum coap_content_format fmt, bool reliable,
 		       coap_client_response_cb_t cb, void *user)
 {
-	int err = 0;
-
-	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
-	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
-
-	err = client_transfer(COAP_METHOD_PUT, resource, query,
-			      buf, len, fmt, fmt, false, reliable, xfer);
-	k_mutex_unlock(&internal_transfer_mut);
-
-	return err;
+	return sync_transfer(COAP_METHOD_PUT, resource, query, buf, len, fmt, fmt,
+			     false, reliable, cb, user);
 }
 
 int nrf_cloud_coap_delete(const char *resource, const char *query,
@@ -582,16 +678,8 @@ int nrf_cloud_coap_delete(const char *resource, const char *query,
 			  enum coap_content_format fmt, bool reliable,
 			  coap_client_response_cb_t cb, void *user)
 {
-	int err = 0;
-
-	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
-	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
-
-	err = client_transfer(COAP_METHOD_DELETE, resource, query,
-			      buf, len, fmt, fmt, false, reliable, xfer);
-	k_mutex_unlock(&internal_transfer_mut);
-
-	return err;
+	return sync_transfer(COAP_METHOD_DELETE, resource, query, buf, len, fmt, fmt,
+			     false, reliable, cb, user);
 }
 
 int nrf_cloud_coap_fetch(const char *resource, const char *query,
@@ -600,16 +688,8 @@ int nrf_cloud_coap_fetch(const char *resource, const char *query,
 			 enum coap_content_format fmt_in, bool reliable,
 			 coap_client_response_cb_t cb, void *user)
 {
-	int err = 0;
-
-	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
-	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
-
-	err = client_transfer(COAP_METHOD_FETCH, resource, query,
-			      buf, len, fmt_out, fmt_in, true, reliable, xfer);
-	k_mutex_unlock(&internal_transfer_mut);
-
-	return err;
+	return sync_transfer(COAP_METHOD_FETCH, resource, query, buf, len, fmt_out, fmt_in,
+			     true, reliable, cb, user);
 }
 
 int nrf_cloud_coap_patch(const char *resource, const char *query,
@@ -617,16 +697,60 @@ int nrf_cloud_coap_patch(const char *resource, const char *query,
 			 enum coap_content_format fmt, bool reliable,
 			 coap_client_response_cb_t cb, void *user)
 {
-	int err = 0;
+	return sync_transfer(COAP_METHOD_PATCH, resource, query, buf, len, fmt, fmt,
+			     false, reliable, cb, user);
+}
 
-	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
-	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
+int nrf_cloud_coap_async_request(const struct nrf_cloud_coap_async_req *req)
+{
+	struct cc_xfer_data *xfer;
+	int err;
 
-	err = client_transfer(COAP_METHOD_PATCH, resource, query,
-			      buf, len, fmt, fmt, false, reliable, xfer);
-	k_mutex_unlock(&internal_transfer_mut);
+	if (!req || !req->resource || !req->done_cb) {
+		return -EINVAL;
+	}
 
-	return err;
+	if (!nrf_cloud_coap_is_connected()) {
+		return -EACCES;
+	}
+
+	/* The request is not queued, the caller retries when a slot is free */
+	if (k_sem_take(&async_sem, K_NO_WAIT)) {
+		return -EBUSY;
+	}
+
+	xfer = xfer_data_init(&internal_cc, req->cb, req->user, NULL);
+	if (!xfer) {
+		k_sem_give(&async_sem);
+		return -ENOBUFS;
+	}
+	xfer->done_cb = req->done_cb;
+
+	err = request_init(&xfer->request, req->method, req->resource, req->query,
+			   req->buf, req->len, req->fmt_out, req->fmt_in,
+			   req->response_expected, true, xfer);
+	if (!err) {
+		/* Not serialized with internal_transfer_mut, coap_client handles
+		 * concurrent requests as long as it has a free request slot.
+		 */
+		err = (internal_cc.sock < 0) ? -ENOTCONN :
+		      coap_client_req(&internal_cc.cc, internal_cc.sock, NULL,
+				      &xfer->request, NULL);
+	}
+
+	if (err < 0) {
+		LOG_ERR("Error sending async CoAP request: %d", err);
+		xfer_ctx_release(xfer);
+		k_sem_give(&async_sem);
+		return err;
+	}
+
+	if (req->len) {
+		LOG_HEXDUMP_DBG(req->buf, MIN(64, req->len), "Sent");
+	}
+
+	/* The transfer data belongs to client_callback() from now on */
+	return 0;
 }
 
 static void auth_cb(const struct coap_client_response_data *data, void *user_data)
@@ -29,6 +29,7 @@
 #include "cJSON.h"
 #include "nrf_cloud_agnss_schema_v1.h"
 #include "nrf_cloud_log_internal.h"
+#include "nrf_cloud_json_stream.h"
 #include "nrf_cloud_fota.h"
 #include "nrf_cloud_transport.h"
 
@@ -51,6 +52,9 @@ enum nrf_cloud_rcv_topic {
 /** Format identifier for remainder of this binary blob */
 #define NRF_CLOUD_DICT_LOG_FMT 0x0001
 
+/** Format identifier of a batch of dictionary logs compressed by nrf_cloud_log_lz_frame() */
+#define NRF_CLOUD_DICT_LOG_LZ_FMT 0x0002
+
 /** @brief Header preceding binary blobs so nRF Cloud can
  *  process them in correct order using ts_ms and sequence fields.
  */
@@ -97,6 +101,13 @@ int nrf_cloud_sensor_data_encode(const struct nrf_cloud_sensor_data *input,
 int nrf_cloud_encode_message(const char *app_id, double value, const char *str_val,
 			     const char *topic, int64_t ts, struct nrf_cloud_data *output);
 
+/** @brief Write the same message as @ref nrf_cloud_encode_message directly into
+ *  the stream's buffer, without allocating memory.
+ */
+int nrf_cloud_encode_message_stream(const char *app_id, double value, const char *str_val,
+				    const char *topic, int64_t ts,
+				    struct nrf_cloud_json_stream *const stream);
+
 /** @brief Encode the sensor data to be sent to the device shadow. */
 int nrf_cloud_shadow_data_encode(const struct nrf_cloud_sensor_data *sensor,
 				 struct nrf_cloud_data *output);
@@ -179,6 +190,19 @@ int nrf_cloud_coap_shadow_default_process(struct nrf_cloud_obj_shadow_data *cons
  */
 int nrf_cloud_enabled_info_sections_json_encode(cJSON *const obj, const char *const app_ver);
 
+/** @brief Write the info sections that are enabled to be sent to the device's shadow
+ * directly into the stream's buffer, without allocating memory.
+ * The output is the same as the JSON object encoded by
+ * @ref nrf_cloud_enabled_info_sections_json_encode.
+ *
+ * @retval 0		Success.
+ * @retval -ENODEV	No info sections are enabled, no data written.
+ * @retval -E2BIG	The stream's buffer is too small.
+ * @return Any other negative value indicates an error.
+ */
+int nrf_cloud_enabled_info_sections_json_stream_encode(struct nrf_cloud_json_stream *const stream,
+						       const char *const app_ver);
+
 /** @brief Encode the device status data into a JSON formatted buffer to be saved to
  * the device shadow.
  * The include_state flag controls if the "state" JSON key is included in the output.
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_JSON_STREAM_H_
+#define NRF_CLOUD_JSON_STREAM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief JSON text written directly into a caller-supplied buffer.
+ *
+ * The output is the same as the unformatted output of cJSON for the same items, without
+ * building an intermediate tree or allocating memory.
+ * The add functions do nothing once an error has occurred, so the error is only checked
+ * when calling @ref nrf_cloud_json_stream_finish.
+ */
+struct nrf_cloud_json_stream {
+	char *buf;
+	size_t size;
+	size_t len;
+	/* A separator is needed before the next item */
+	bool comma;
+	int err;
+};
+
+/** @brief Start writing JSON text into the provided buffer. */
+void nrf_cloud_json_stream_init(struct nrf_cloud_json_stream *const stream, char *const buf,
+				size_t size);
+
+/** @brief Start an object. The key is NULL for the root object and for array elements. */
+void nrf_cloud_json_stream_obj_start(struct nrf_cloud_json_stream *const stream,
+				     const char *const key);
+
+/** @brief End the current object. */
+void nrf_cloud_json_stream_obj_end(struct nrf_cloud_json_stream *const stream);
+
+/** @brief Start an array. The key is NULL for array elements. */
+void nrf_cloud_json_stream_array_start(struct nrf_cloud_json_stream *const stream,
+				       const char *const key);
+
+/** @brief End the current array. */
+void nrf_cloud_json_stream_array_end(struct nrf_cloud_json_stream *const stream);
+
+/** @brief Add a string item. The key is NULL for array elements. */
+void nrf_cloud_json_stream_str_add(struct nrf_cloud_json_stream *const stream,
+				   const char *const key, const char *const val);
+
+/** @brief Add a number item, formatted like cJSON does. */
+void nrf_cloud_json_stream_num_add(struct nrf_cloud_json_stream *const stream,
+				   const char *const key, double val);
+
+/** @brief Add an integer item, for values that do not fit in a double without loss. */
+void nrf_cloud_json_stream_int_add(struct nrf_cloud_json_stream *const stream,
+				   const char *const key, int64_t val);
+
+/** @brief Add a boolean item. */
+void nrf_cloud_json_stream_bool_add(struct nrf_cloud_json_stream *const stream,
+				    const char *const key, bool val);
+
+/** @brief Add a null item. */
+void nrf_cloud_json_stream_null_add(struct nrf_cloud_json_stream *const stream,
+				    const char *const key);
+
+/** @brief Terminate the JSON text.
+ *
+ * @param stream Stream to finish.
+ * @param len Length of the JSON text, without the NULL terminator. Optional.
+ * @retval 0 The JSON text was written.
+ * @retval -E2BIG The buffer is too small.
+ */
+int nrf_cloud_json_stream_finish(struct nrf_cloud_json_stream *const stream, size_t *const len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_CLOUD_JSON_STREAM_H_ */
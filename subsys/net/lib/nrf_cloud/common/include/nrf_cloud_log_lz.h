@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_LOG_LZ_H_
+#define NRF_CLOUD_LOG_LZ_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of bits of the match finder's hash */
+#define NRF_CLOUD_LOG_LZ_HASH_BITS 8
+
+/** Largest batch that can be compressed, limited by the 16-bit match offsets */
+#define NRF_CLOUD_LOG_LZ_BATCH_MAX UINT16_MAX
+
+/** @brief Header preceding a compressed batch of dictionary logs.
+ *
+ * The frame follows the @ref nrf_cloud_bin_hdr of the batch, whose format is then
+ * NRF_CLOUD_DICT_LOG_LZ_FMT.
+ */
+struct nrf_cloud_log_lz_hdr {
+	/** Length of the batch before compression */
+	uint16_t raw_len;
+	/** Number of log messages in the batch */
+	uint16_t msg_cnt;
+	/** Incremented for each batch sent, so that lost batches can be detected */
+	uint32_t batch_seq;
+} __packed;
+
+/** @brief State of the compressor, kept out of the stack of the logging thread. */
+struct nrf_cloud_log_lz_ctx {
+	/** Last position + 1 of each hashed 4-byte sequence, 0 if none */
+	uint16_t table[1 << NRF_CLOUD_LOG_LZ_HASH_BITS];
+};
+
+/** @brief Compress a batch into a frame made of a @ref nrf_cloud_log_lz_hdr and the
+ *  LZ-compressed batch.
+ *
+ * The compressed batch is a series of sequences, each one made of a token, literals, and a
+ * back reference, like the LZ4 block format.
+ *
+ * @param ctx Compressor state.
+ * @param batch Batch to compress, not including its binary header.
+ * @param batch_len Length of the batch.
+ * @param msg_cnt Number of log messages in the batch.
+ * @param batch_seq Sequence number of the batch.
+ * @param out Buffer for the frame.
+ * @param out_size Size of the buffer.
+ * @param out_len Length of the frame.
+ * @retval 0 The frame was written.
+ * @retval -E2BIG The frame does not fit in the buffer. The batch should be sent
+ *                uncompressed when the buffer is as large as the batch.
+ * @retval -EINVAL Invalid parameters, or the batch is larger than
+ *                 NRF_CLOUD_LOG_LZ_BATCH_MAX.
+ */
+int nrf_cloud_log_lz_frame(struct nrf_cloud_log_lz_ctx *const ctx, const uint8_t *const batch,
+			   size_t batch_len, uint16_t msg_cnt, uint32_t batch_seq,
+			   uint8_t *const out, size_t out_size, size_t *const out_len);
+
+#if defined(CONFIG_ZTEST)
+/** @brief Decompress a frame written by @ref nrf_cloud_log_lz_frame.
+ *
+ * The device never decompresses batches, so this is only built for the tests. It is the
+ * reference for the receivers of the batches.
+ *
+ * @param frame Frame to decompress.
+ * @param frame_len Length of the frame.
+ * @param hdr Header of the frame.
+ * @param out Buffer for the batch.
+ * @param out_size Size of the buffer.
+ * @retval 0 The batch was decompressed; its length is hdr->raw_len.
+ * @retval -E2BIG The batch does not fit in the buffer.
+ * @retval -EBADMSG The frame is malformed.
+ */
+int nrf_cloud_log_lz_unframe(const uint8_t *const frame, size_t frame_len,
+			     struct nrf_cloud_log_lz_hdr *const hdr, uint8_t *const out,
+			     size_t out_size);
+#endif /* CONFIG_ZTEST */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_CLOUD_LOG_LZ_H_ */
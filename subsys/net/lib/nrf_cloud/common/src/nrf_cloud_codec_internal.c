@@ -30,6 +30,9 @@ LOG_MODULE_REGISTER(nrf_cloud_codec_internal, CONFIG_NRF_CLOUD_LOG_LEVEL);
 
 #define SDK_VERSION NCS_VERSION_STRING "-" NCS_COMMIT_STRING
 
+/* Number of FOTA types that can be reported in the service info */
+#define NRF_CLOUD_FOTA_TYPES_MAX 5
+
 /** @brief How the control section is handled when either a trimmed shadow
  *  or a delta shadow is received.
  */
@@ -584,6 +587,60 @@ cleanup:
 	return ret;
 }
 
+int nrf_cloud_encode_message_stream(const char *app_id, double value, const char *str_val,
+				    const char *topic, int64_t ts,
+				    struct nrf_cloud_json_stream *const stream)
+{
+	__ASSERT_NO_MSG(app_id != NULL);
+	__ASSERT_NO_MSG(stream != NULL);
+
+	/* Same items, in the same order, as nrf_cloud_encode_message() */
+	nrf_cloud_json_stream_obj_start(stream, NULL);
+	if (topic != NULL) {
+		nrf_cloud_json_stream_str_add(stream, NRF_CLOUD_REST_TOPIC_KEY, topic);
+	}
+
+	nrf_cloud_json_stream_obj_start(stream, NRF_CLOUD_REST_MSG_KEY);
+	nrf_cloud_json_stream_str_add(stream, NRF_CLOUD_JSON_APPID_KEY, app_id);
+	nrf_cloud_json_stream_str_add(stream, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+				      NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	nrf_cloud_json_stream_num_add(stream, NRF_CLOUD_MSG_TIMESTAMP_KEY, ts);
+	if (str_val != NULL) {
+		nrf_cloud_json_stream_str_add(stream, NRF_CLOUD_JSON_DATA_KEY, str_val);
+	} else {
+		nrf_cloud_json_stream_num_add(stream, NRF_CLOUD_JSON_DATA_KEY, value);
+	}
+	nrf_cloud_json_stream_obj_end(stream);
+	nrf_cloud_json_stream_obj_end(stream);
+
+	return nrf_cloud_json_stream_finish(stream, NULL);
+}
+
+/* Fills the FOTA types that are enabled, in the order they are reported to the cloud */
+static int fota_types_get(const struct nrf_cloud_svc_info_fota *const fota,
+			  const char *types[NRF_CLOUD_FOTA_TYPES_MAX])
+{
+	int cnt = 0;
+
+	if (fota->bootloader) {
+		types[cnt++] = NRF_CLOUD_FOTA_TYPE_BOOT;
+	}
+	if (fota->modem) {
+		types[cnt++] = NRF_CLOUD_FOTA_TYPE_MODEM_DELTA;
+	}
+	if (fota->application) {
+		types[cnt++] = NRF_CLOUD_FOTA_TYPE_APP;
+	}
+	if (fota->modem_full) {
+		types[cnt++] = NRF_CLOUD_FOTA_TYPE_MODEM_FULL;
+	}
+	if (fota->smp) {
+		types[cnt++] = NRF_CLOUD_FOTA_TYPE_SMP;
+	}
+
+	return cnt;
+}
+
 static int nrf_cloud_encode_service_info_fota(const struct nrf_cloud_svc_info_fota *const fota,
 					      cJSON *const svc_inf_obj)
 {
@@ -597,31 +654,15 @@ static int nrf_cloud_encode_service_info_fota(const struct nrf_cloud_svc_info_fo
 	}
 
 	/* Add the FOTA array to the serviceInfo object */
-	int item_cnt = 0;
+	const char *types[NRF_CLOUD_FOTA_TYPES_MAX];
+	int item_cnt = fota_types_get(fota, types);
 	cJSON *array = cJSON_AddArrayToObjectCS(svc_inf_obj, NRF_CLOUD_JSON_KEY_SRVC_INFO_FOTA);
 
 	if (!array) {
 		return -ENOMEM;
 	}
-	if (fota->bootloader) {
-		cJSON_AddItemToArray(array, cJSON_CreateString(NRF_CLOUD_FOTA_TYPE_BOOT));
-		++item_cnt;
-	}
-	if (fota->modem) {
-		cJSON_AddItemToArray(array, cJSON_CreateString(NRF_CLOUD_FOTA_TYPE_MODEM_DELTA));
-		++item_cnt;
-	}
-	if (fota->application) {
-		cJSON_AddItemToArray(array, cJSON_CreateString(NRF_CLOUD_FOTA_TYPE_APP));
-		++item_cnt;
-	}
-	if (fota->modem_full) {
-		cJSON_AddItemToArray(array, cJSON_CreateString(NRF_CLOUD_FOTA_TYPE_MODEM_FULL));
-		++item_cnt;
-	}
-	if (fota->smp) {
-		cJSON_AddItemToArray(array, cJSON_CreateString(NRF_CLOUD_FOTA_TYPE_SMP));
-		++item_cnt;
+	for (int i = 0; i < item_cnt; i++) {
+		cJSON_AddItemToArray(array, cJSON_CreateString(types[i]));
 	}
 
 	if (cJSON_GetArraySize(array) != item_cnt) {
@@ -680,6 +721,24 @@ static int encode_info_item_cs(const enum nrf_cloud_shadow_info inf, const char
 }
 
 #ifdef CONFIG_MODEM_INFO
+/* Streaming counterpart of encode_info_item_cs(), returns true if the section is to be written */
+static bool info_section_stream_start(struct nrf_cloud_json_stream *const stream,
+				      const enum nrf_cloud_shadow_info inf,
+				      const char *const inf_name)
+{
+	switch (inf) {
+	case NRF_CLOUD_INFO_SET:
+		nrf_cloud_json_stream_obj_start(stream, inf_name);
+		return true;
+	case NRF_CLOUD_INFO_CLEAR:
+		nrf_cloud_json_stream_null_add(stream, inf_name);
+		return false;
+	case NRF_CLOUD_INFO_NO_CHANGE:
+	default:
+		return false;
+	}
+}
+
 static int init_modem_info(void)
 {
 	if (!modem_inf_initd) {
@@ -781,14 +840,41 @@ int nrf_cloud_get_single_cell_modem_info(struct lte_lc_cell *const cell_inf)
 	return 0;
 }
 
-static int add_modem_info_data(struct lte_param *param, cJSON *json_obj)
+/* Destination of the modem info items, either a cJSON object or a JSON stream */
+struct info_dst {
+	cJSON *obj;
+	struct nrf_cloud_json_stream *stream;
+};
+
+static int info_str_add(struct info_dst *const dst, const char *const key,
+			const char *const val)
+{
+	if (dst->stream) {
+		nrf_cloud_json_stream_str_add(dst->stream, key, val);
+		return dst->stream->err;
+	}
+
+	return cJSON_AddStringToObject(dst->obj, key, val) ? 0 : -ENOMEM;
+}
+
+static int info_num_add(struct info_dst *const dst, const char *const key, double val)
+{
+	if (dst->stream) {
+		nrf_cloud_json_stream_num_add(dst->stream, key, val);
+		return dst->stream->err;
+	}
+
+	return cJSON_AddNumberToObject(dst->obj, key, val) ? 0 : -ENOMEM;
+}
+
+static int add_modem_info_data(struct lte_param *param, struct info_dst *dst)
 {
 	char data_name[MODEM_INFO_MAX_RESPONSE_SIZE];
 	enum modem_info_data_type data_type;
 	int ret;
 
 	__ASSERT_NO_MSG(param != NULL);
-	__ASSERT_NO_MSG(json_obj != NULL);
+	__ASSERT_NO_MSG(dst != NULL);
 
 	memset(data_name, 0, ARRAY_SIZE(data_name));
 	ret = modem_info_name_get(param->type, data_name);
@@ -803,53 +889,47 @@ static int add_modem_info_data(struct lte_param *param, cJSON *json_obj)
 	}
 
 	if (data_type == MODEM_INFO_DATA_TYPE_STRING && param->type != MODEM_INFO_AREA_CODE) {
-		if (cJSON_AddStringToObject(json_obj, data_name, param->value_string) == NULL) {
-			return -ENOMEM;
-		}
-	} else {
-		if (cJSON_AddNumberToObject(json_obj, data_name, param->value) == NULL) {
-			return -ENOMEM;
-		}
+		return info_str_add(dst, data_name, param->value_string);
 	}
 
-	return 0;
+	return info_num_add(dst, data_name, param->value);
 }
 
-static int encode_modem_info_network(struct network_param *network, cJSON *json_obj)
+static int encode_modem_info_network(struct network_param *network, struct info_dst *dst)
 {
 	char network_mode[12] = {0};
 	char data_name[MODEM_INFO_MAX_RESPONSE_SIZE] = {0};
 	int ret;
 
 	__ASSERT_NO_MSG(network != NULL);
-	__ASSERT_NO_MSG(json_obj != NULL);
+	__ASSERT_NO_MSG(dst != NULL);
 
-	ret = add_modem_info_data(&network->current_band, json_obj);
+	ret = add_modem_info_data(&network->current_band, dst);
 	if (ret) {
 		return ret;
 	}
 
-	ret = add_modem_info_data(&network->sup_band, json_obj);
+	ret = add_modem_info_data(&network->sup_band, dst);
 	if (ret) {
 		return ret;
 	}
 
-	ret = add_modem_info_data(&network->area_code, json_obj);
+	ret = add_modem_info_data(&network->area_code, dst);
 	if (ret) {
 		return ret;
 	}
 
-	ret = add_modem_info_data(&network->current_operator, json_obj);
+	ret = add_modem_info_data(&network->current_operator, dst);
 	if (ret) {
 		return ret;
 	}
 
-	ret = add_modem_info_data(&network->ip_address, json_obj);
+	ret = add_modem_info_data(&network->ip_address, dst);
 	if (ret) {
 		return ret;
 	}
 
-	ret = add_modem_info_data(&network->ue_mode, json_obj);
+	ret = add_modem_info_data(&network->ue_mode, dst);
 	if (ret) {
 		return ret;
 	}
@@ -859,7 +939,7 @@ static int encode_modem_info_network(struct network_param *network, cJSON *json_
 		return ret;
 	}
 
-	if (cJSON_AddNumberToObject(json_obj, data_name, network->cellid_dec) == NULL) {
+	if (info_num_add(dst, data_name, network->cellid_dec)) {
 		return -EINVAL;
 	}
 
@@ -872,31 +952,31 @@ static int encode_modem_info_network(struct network_param *network, cJSON *json_
 		strcat(network_mode, " GPS");
 	}
 
-	if (cJSON_AddStringToObject(json_obj, "networkMode", network_mode) == NULL) {
+	if (info_str_add(dst, "networkMode", network_mode)) {
 		return -EINVAL;
 	}
 
 	return 0;
 }
 
-static int encode_modem_info_sim(struct sim_param *sim, cJSON *json_obj)
+static int encode_modem_info_sim(struct sim_param *sim, struct info_dst *dst)
 {
 	int ret;
 
 	__ASSERT_NO_MSG(sim != NULL);
-	__ASSERT_NO_MSG(json_obj != NULL);
+	__ASSERT_NO_MSG(dst != NULL);
 
-	ret = add_modem_info_data(&sim->uicc, json_obj);
+	ret = add_modem_info_data(&sim->uicc, dst);
 	if (ret) {
 		return ret;
 	}
 
-	ret = add_modem_info_data(&sim->iccid, json_obj);
+	ret = add_modem_info_data(&sim->iccid, dst);
 	if (ret) {
 		LOG_DBG("sim_param object does not contain an ICCID");
 	}
 
-	ret = add_modem_info_data(&sim->imsi, json_obj);
+	ret = add_modem_info_data(&sim->imsi, dst);
 	if (ret) {
 		LOG_DBG("sim_param object does not contain an IMSI");
 	}
@@ -904,10 +984,10 @@ static int encode_modem_info_sim(struct sim_param *sim, cJSON *json_obj)
 	return 0;
 }
 
-static int encode_modem_info_device(struct device_param *device, cJSON *json_obj)
+static int encode_modem_info_device(struct device_param *device, struct info_dst *dst)
 {
 	__ASSERT_NO_MSG(device != NULL);
-	__ASSERT_NO_MSG(json_obj != NULL);
+	__ASSERT_NO_MSG(dst != NULL);
 
 	int ret;
 	char hw_ver[40] = {0};
@@ -917,47 +997,71 @@ static int encode_modem_info_device(struct device_param *device, cJSON *json_obj
 	const char *const zver = "N/A"
 #endif
 
-	ret = add_modem_info_data(&device->modem_fw, json_obj);
+	ret = add_modem_info_data(&device->modem_fw, dst);
 	if (ret) {
 		return ret;
 	}
 
 	if (IS_ENABLED(CONFIG_NRF_CLOUD_DEVICE_STATUS_ENCODE_VOLTAGE)) {
-		ret = add_modem_info_data(&device->battery, json_obj);
+		ret = add_modem_info_data(&device->battery, dst);
 		if (ret) {
 			return ret;
 		}
 	}
 
-	ret = add_modem_info_data(&device->imei, json_obj);
+	ret = add_modem_info_data(&device->imei, dst);
 	if (ret) {
 		return ret;
 	}
 
-	if (!cJSON_AddStringToObjectCS(json_obj, "board", device->board)) {
+	if (info_str_add(dst, "board", device->board)) {
 		return -ENOMEM;
 	}
 
-	if (!cJSON_AddStringToObjectCS(json_obj, "sdkVer", SDK_VERSION)) {
+	if (info_str_add(dst, "sdkVer", SDK_VERSION)) {
 		return -ENOMEM;
 	}
 
-	if (!cJSON_AddStringToObjectCS(json_obj, "appName", device->app_name)) {
+	if (info_str_add(dst, "appName", device->app_name)) {
 		return -ENOMEM;
 	}
 
-	if (!cJSON_AddStringToObjectCS(json_obj, "zephyrVer", zver)) {
+	if (info_str_add(dst, "zephyrVer", zver)) {
 		return -ENOMEM;
 	}
 
 	ret = modem_info_get_hw_version(hw_ver, sizeof(hw_ver) - 1);
-	if (!cJSON_AddStringToObjectCS(json_obj, "hwVer", ((ret == 0) ? hw_ver : "N/A"))) {
+	if (info_str_add(dst, "hwVer", ((ret == 0) ? hw_ver : "N/A"))) {
 		return -ENOMEM;
 	}
 
 	return 0;
 }
 
+/* Application versions, ahead of the modem info items in the device info section */
+static int encode_app_versions(const char *const app_ver, struct info_dst *dst)
+{
+	int ret = 0;
+
+	if (app_ver) {
+		ret = info_str_add(dst, NRF_CLOUD_JSON_KEY_APP_VER, app_ver);
+	}
+
+#if defined(CONFIG_NRF_CLOUD_FOTA_SMP)
+	if (!ret) {
+		char *smp_ver = NULL;
+
+		(void)nrf_cloud_fota_smp_version_get(&smp_ver);
+
+		if (smp_ver) {
+			ret = info_str_add(dst, NRF_CLOUD_JSON_KEY_SMP_APP_VER, smp_ver);
+		}
+	}
+#endif /* CONFIG_NRF_CLOUD_FOTA_SMP */
+
+	return ret ? -ENOMEM : 0;
+}
+
 static int encode_modem_info_json_object(struct modem_param_info *modem, cJSON *root_obj,
 					 const char *const app_ver)
 {
@@ -972,7 +1076,10 @@ static int encode_modem_info_json_object(struct modem_param_info *modem, cJSON *
 		if (network_obj == NULL) {
 			return -ENOMEM;
 		}
-		ret = encode_modem_info_network(&modem->network, network_obj);
+
+		struct info_dst dst = {.obj = network_obj};
+
+		ret = encode_modem_info_network(&modem->network, &dst);
 		if (!ret) {
 			ret = !cJSON_AddItemToObjectCS(root_obj, NRF_CLOUD_DEVICE_JSON_KEY_NET_INF,
 						       network_obj);
@@ -991,7 +1098,10 @@ static int encode_modem_info_json_object(struct modem_param_info *modem, cJSON *
 		if (sim_obj == NULL) {
 			return -ENOMEM;
 		}
-		ret = encode_modem_info_sim(&modem->sim, sim_obj);
+
+		struct info_dst dst = {.obj = sim_obj};
+
+		ret = encode_modem_info_sim(&modem->sim, &dst);
 		if (!ret) {
 			ret = !cJSON_AddItemToObjectCS(root_obj, NRF_CLOUD_DEVICE_JSON_KEY_SIM_INF,
 						       sim_obj);
@@ -1011,30 +1121,14 @@ static int encode_modem_info_json_object(struct modem_param_info *modem, cJSON *
 			return -ENOMEM;
 		}
 
-		if (app_ver) {
-			ret = !cJSON_AddStringToObjectCS(device_obj, NRF_CLOUD_JSON_KEY_APP_VER,
-							 app_ver);
-		}
+		struct info_dst dst = {.obj = device_obj};
 
-#if defined(CONFIG_NRF_CLOUD_FOTA_SMP)
-		if (!ret) {
-			char *smp_ver = NULL;
-
-			(void)nrf_cloud_fota_smp_version_get(&smp_ver);
-
-			if (smp_ver) {
-				ret = !cJSON_AddStringToObjectCS(
-					device_obj, NRF_CLOUD_JSON_KEY_SMP_APP_VER, smp_ver);
-			}
-		}
-#endif /* CONFIG_NRF_CLOUD_FOTA_SMP */
-
-		if (ret) {
+		if (encode_app_versions(app_ver, &dst)) {
 			cJSON_Delete(device_obj);
 			return -ENOMEM;
 		}
 
-		ret = encode_modem_info_device(&modem->device, device_obj);
+		ret = encode_modem_info_device(&modem->device, &dst);
 		if (!ret) {
 			ret = !cJSON_AddItemToObjectCS(root_obj, NRF_CLOUD_DEVICE_JSON_KEY_DEV_INF,
 						       device_obj);
@@ -1050,13 +1144,8 @@ static int encode_modem_info_json_object(struct modem_param_info *modem, cJSON *
 	return 0;
 }
 
-int nrf_cloud_modem_info_json_encode(const struct nrf_cloud_modem_info *const mod_inf,
-				     cJSON *const mod_inf_obj)
+static int modem_info_sections_check(const struct nrf_cloud_modem_info *const mod_inf)
 {
-	if (!mod_inf_obj || !mod_inf) {
-		return -EINVAL;
-	}
-
 	if ((!IS_ENABLED(CONFIG_MODEM_INFO_ADD_DEVICE)) &&
 	    (mod_inf->device == NRF_CLOUD_INFO_SET)) {
 		LOG_ERR("CONFIG_MODEM_INFO_ADD_DEVICE is not enabled, unable to add device info");
@@ -1071,7 +1160,22 @@ int nrf_cloud_modem_info_json_encode(const struct nrf_cloud_modem_info *const mo
 		return -EACCES;
 	}
 
-	int err = 0;
+	return 0;
+}
+
+int nrf_cloud_modem_info_json_encode(const struct nrf_cloud_modem_info *const mod_inf,
+				     cJSON *const mod_inf_obj)
+{
+	if (!mod_inf_obj || !mod_inf) {
+		return -EINVAL;
+	}
+
+	int err = modem_info_sections_check(mod_inf);
+
+	if (err) {
+		return err;
+	}
+
 	bool locked = false;
 	cJSON *tmp = cJSON_CreateObject();
 
@@ -1117,6 +1221,60 @@ cleanup:
 	cJSON_Delete(tmp);
 	return err;
 }
+
+static int modem_info_json_stream_encode(const struct nrf_cloud_modem_info *const mod_inf,
+					 struct nrf_cloud_json_stream *const stream)
+{
+	struct modem_param_info *mpi = (struct modem_param_info *)mod_inf->mpi;
+	struct info_dst dst = {.stream = stream};
+	bool locked = false;
+	int err = modem_info_sections_check(mod_inf);
+
+	if (err) {
+		return err;
+	}
+
+	if (!mpi) {
+		/* No modem info provided, use local */
+		err = get_modem_info();
+		if (err < 0) {
+			LOG_ERR("get_modem_info() failed: %d", err);
+			return err;
+		}
+		locked = (k_mutex_lock(&modem_inf_mutex, K_FOREVER) == 0);
+		mpi = &modem_inf;
+	}
+
+	/* Same order of the sections as in nrf_cloud_modem_info_json_encode() */
+	if (info_section_stream_start(stream, mod_inf->device, NRF_CLOUD_DEVICE_JSON_KEY_DEV_INF)) {
+		err = encode_app_versions(mod_inf->application_version, &dst);
+		if (!err) {
+			err = encode_modem_info_device(&mpi->device, &dst);
+		}
+		nrf_cloud_json_stream_obj_end(stream);
+	}
+
+	if (!err &&
+	    info_section_stream_start(stream, mod_inf->network, NRF_CLOUD_DEVICE_JSON_KEY_NET_INF)) {
+		err = encode_modem_info_network(&mpi->network, &dst);
+		nrf_cloud_json_stream_obj_end(stream);
+	}
+
+	if (!err &&
+	    info_section_stream_start(stream, mod_inf->sim, NRF_CLOUD_DEVICE_JSON_KEY_SIM_INF)) {
+		err = encode_modem_info_sim(&mpi->sim, &dst);
+		nrf_cloud_json_stream_obj_end(stream);
+	}
+
+	if (locked) {
+		(void)k_mutex_unlock(&modem_inf_mutex);
+	}
+	if (err) {
+		LOG_ERR("Failed to encode modem info: %d", err);
+	}
+
+	return err;
+}
 #else
 int nrf_cloud_modem_info_json_encode(const struct nrf_cloud_modem_info *const mod_inf,
 				     cJSON *const mod_inf_obj)
@@ -1204,6 +1362,77 @@ int nrf_cloud_enabled_info_sections_json_encode(cJSON *const obj, const char *co
 	return ret;
 }
 
+/* Streaming counterpart of nrf_cloud_enabled_info_sections_json_encode(), with the same output */
+int nrf_cloud_enabled_info_sections_json_stream_encode(struct nrf_cloud_json_stream *const stream,
+						       const char *const app_ver)
+{
+	struct nrf_cloud_svc_info_fota fota = {0};
+	struct nrf_cloud_svc_info svc_inf = {
+		.ui = NULL,
+		.fota = IS_ENABLED(CONFIG_NRF_CLOUD_SEND_SERVICE_INFO_FOTA) ? &fota : NULL};
+	struct nrf_cloud_modem_info mdm_inf = {.application_version = app_ver};
+	struct nrf_cloud_device_status ds = {
+		.modem = &mdm_inf,
+		.svc = &svc_inf,
+	};
+	int ret;
+
+	if (!stream) {
+		return -EINVAL;
+	}
+
+	ret = enabled_info_sections_get(&ds);
+	if (ret == -ENODEV) {
+		/* No info sections enabled */
+		return ret;
+	}
+
+	nrf_cloud_json_stream_obj_start(stream, NULL);
+	nrf_cloud_json_stream_obj_start(stream, NRF_CLOUD_JSON_KEY_DEVICE);
+
+#if defined(CONFIG_MODEM_INFO)
+	if ((ds.modem->device == NRF_CLOUD_INFO_SET) || (ds.modem->network == NRF_CLOUD_INFO_SET) ||
+	    (ds.modem->sim == NRF_CLOUD_INFO_SET)) {
+		if (modem_info_json_stream_encode(ds.modem, stream)) {
+			/* Report a full buffer, so the caller can fall back to cJSON */
+			return stream->err ? stream->err : -ENOMEM;
+		}
+	}
+#endif
+
+	if (ds.conn_inf == NRF_CLOUD_INFO_SET) {
+		nrf_cloud_json_stream_obj_start(stream, NRF_CLOUD_JSON_KEY_CONN_INFO);
+		nrf_cloud_json_stream_str_add(stream, NRF_CLOUD_JSON_KEY_PROTOCOL,
+					      NRF_CLOUD_JSON_VAL_CFGD_PROTO_VAL);
+		nrf_cloud_json_stream_str_add(stream, NRF_CLOUD_JSON_KEY_METHOD,
+					      NRF_CLOUD_JSON_VAL_CFGD_METHOD_VAL);
+		nrf_cloud_json_stream_obj_end(stream);
+	}
+
+	if (ds.svc->fota) {
+		const char *types[NRF_CLOUD_FOTA_TYPES_MAX];
+		int cnt = fota_types_get(ds.svc->fota, types);
+
+		nrf_cloud_json_stream_obj_start(stream, NRF_CLOUD_JSON_KEY_SRVC_INFO);
+		nrf_cloud_json_stream_array_start(stream, NRF_CLOUD_JSON_KEY_SRVC_INFO_FOTA);
+		for (int i = 0; i < cnt; i++) {
+			nrf_cloud_json_stream_str_add(stream, NULL, types[i]);
+		}
+		nrf_cloud_json_stream_array_end(stream);
+
+		/* The UI section is no longer used by the cloud, remove it */
+		if (IS_ENABLED(CONFIG_NRF_CLOUD_SEND_SERVICE_INFO_UI)) {
+			nrf_cloud_json_stream_null_add(stream, NRF_CLOUD_JSON_KEY_SRVC_INFO_UI);
+		}
+		nrf_cloud_json_stream_obj_end(stream);
+	}
+
+	nrf_cloud_json_stream_obj_end(stream);
+	nrf_cloud_json_stream_obj_end(stream);
+
+	return nrf_cloud_json_stream_finish(stream, NULL);
+}
+
 int nrf_cloud_service_info_json_encode(const struct nrf_cloud_svc_info *const svc_inf,
 				       cJSON *const svc_inf_obj)
 {
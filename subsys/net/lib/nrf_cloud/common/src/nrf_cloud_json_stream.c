@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nrf_cloud_json_stream.h"
+
+static void raw_write(struct nrf_cloud_json_stream *const stream, const char *const str,
+		      size_t len)
+{
+	if (stream->err) {
+		return;
+	}
+
+	/* Keep room for the NULL terminator */
+	if (len >= stream->size - stream->len) {
+		stream->err = -E2BIG;
+		return;
+	}
+
+	memcpy(&stream->buf[stream->len], str, len);
+	stream->len += len;
+}
+
+static void char_write(struct nrf_cloud_json_stream *const stream, char c)
+{
+	raw_write(stream, &c, 1);
+}
+
+static void fmt_write(struct nrf_cloud_json_stream *const stream, const char *const fmt, ...)
+{
+	va_list args;
+	size_t left;
+	int len;
+
+	if (stream->err) {
+		return;
+	}
+
+	left = stream->size - stream->len;
+	va_start(args, fmt);
+	len = vsnprintf(&stream->buf[stream->len], left, fmt, args);
+	va_end(args);
+
+	if ((len < 0) || ((size_t)len >= left)) {
+		stream->err = -E2BIG;
+		return;
+	}
+
+	stream->len += len;
+}
+
+/* Escapes the same characters as cJSON */
+static void str_write(struct nrf_cloud_json_stream *const stream, const char *str)
+{
+	const char *start;
+
+	char_write(stream, '"');
+
+	while (*str) {
+		start = str;
+		while (*str && (*str != '"') && (*str != '\\') && ((unsigned char)*str >= ' ')) {
+			str++;
+		}
+		raw_write(stream, start, str - start);
+
+		if (!*str) {
+			break;
+		}
+
+		switch (*str) {
+		case '"':
+			raw_write(stream, "\\\"", 2);
+			break;
+		case '\\':
+			raw_write(stream, "\\\\", 2);
+			break;
+		case '\b':
+			raw_write(stream, "\\b", 2);
+			break;
+		case '\f':
+			raw_write(stream, "\\f", 2);
+			break;
+		case '\n':
+			raw_write(stream, "\\n", 2);
+			break;
+		case '\r':
+			raw_write(stream, "\\r", 2);
+			break;
+		case '\t':
+			raw_write(stream, "\\t", 2);
+			break;
+		default:
+			fmt_write(stream, "\\u%04x", (unsigned char)*str);
+			break;
+		}
+		str++;
+	}
+
+	char_write(stream, '"');
+}
+
+/* Writes the separator and the key of the next item */
+static void item_start(struct nrf_cloud_json_stream *const stream, const char *const key)
+{
+	if (stream->comma) {
+		char_write(stream, ',');
+	}
+
+	if (key) {
+		str_write(stream, key);
+		char_write(stream, ':');
+	}
+
+	stream->comma = true;
+}
+
+void nrf_cloud_json_stream_init(struct nrf_cloud_json_stream *const stream, char *const buf,
+				size_t size)
+{
+	stream->buf = buf;
+	stream->size = size;
+	stream->len = 0;
+	stream->comma = false;
+	stream->err = (buf && size) ? 0 : -EINVAL;
+}
+
+void nrf_cloud_json_stream_obj_start(struct nrf_cloud_json_stream *const stream,
+				     const char *const key)
+{
+	item_start(stream, key);
+	char_write(stream, '{');
+	stream->comma = false;
+}
+
+void nrf_cloud_json_stream_obj_end(struct nrf_cloud_json_stream *const stream)
+{
+	char_write(stream, '}');
+	stream->comma = true;
+}
+
+void nrf_cloud_json_stream_array_start(struct nrf_cloud_json_stream *const stream,
+				       const char *const key)
+{
+	item_start(stream, key);
+	char_write(stream, '[');
+	stream->comma = false;
+}
+
+void nrf_cloud_json_stream_array_end(struct nrf_cloud_json_stream *const stream)
+{
+	char_write(stream, ']');
+	stream->comma = true;
+}
+
+void nrf_cloud_json_stream_str_add(struct nrf_cloud_json_stream *const stream,
+				   const char *const key, const char *const val)
+{
+	item_start(stream, key);
+	str_write(stream, val ? val : "");
+}
+
+void nrf_cloud_json_stream_num_add(struct nrf_cloud_json_stream *const stream,
+				   const char *const key, double val)
+{
+	size_t start;
+	int int_val;
+	double test;
+
+	item_start(stream, key);
+
+	if (isnan(val) || isinf(val)) {
+		raw_write(stream, "null", 4);
+		return;
+	}
+
+	/* cJSON prints the number as an integer when it equals its saturated integer value */
+	if (val >= INT_MAX) {
+		int_val = INT_MAX;
+	} else if (val <= (double)INT_MIN) {
+		int_val = INT_MIN;
+	} else {
+		int_val = (int)val;
+	}
+
+	if (val == (double)int_val) {
+		fmt_write(stream, "%d", int_val);
+		return;
+	}
+
+	/* Use 15 digits when they give the same value back, like cJSON */
+	start = stream->len;
+	fmt_write(stream, "%1.15g", val);
+	if (stream->err) {
+		return;
+	}
+
+	test = strtod(&stream->buf[start], NULL);
+	if (fabs(test - val) > fmax(fabs(test), fabs(val)) * DBL_EPSILON) {
+		stream->len = start;
+		fmt_write(stream, "%1.17g", val);
+	}
+}
+
+void nrf_cloud_json_stream_int_add(struct nrf_cloud_json_stream *const stream,
+				   const char *const key, int64_t val)
+{
+	item_start(stream, key);
+	fmt_write(stream, "%lld", (long long)val);
+}
+
+void nrf_cloud_json_stream_bool_add(struct nrf_cloud_json_stream *const stream,
+				    const char *const key, bool val)
+{
+	item_start(stream, key);
+	if (val) {
+		raw_write(stream, "true", 4);
+	} else {
+		raw_write(stream, "false", 5);
+	}
+}
+
+void nrf_cloud_json_stream_null_add(struct nrf_cloud_json_stream *const stream,
+				    const char *const key)
+{
+	item_start(stream, key);
+	raw_write(stream, "null", 4);
+}
+
+int nrf_cloud_json_stream_finish(struct nrf_cloud_json_stream *const stream, size_t *const len)
+{
+	if (!stream->err) {
+		stream->buf[stream->len] = '\0';
+	}
+
+	if (len) {
+		*len = stream->err ? 0 : stream->len;
+	}
+
+	return stream->err;
+}
@@ -20,6 +20,7 @@
 #include "nrf_cloud_log_internal.h"
 #include "nrf_cloud_coap_transport.h"
 #include "nrf_cloud_client_id.h"
+#include "nrf_cloud_log_lz.h"
 #include <net/nrf_cloud_rest.h>
 #include <net/nrf_cloud_coap.h>
 #include <net/nrf_cloud_log.h>
@@ -66,6 +67,10 @@ static struct nrf_cloud_log_stats {
 	uint32_t bytes_sent;
 	/** Total number of bytes (before TLS) sent */
 	uint32_t lines_dropped;
+	/** Total number of dictionary log batches sent compressed */
+	uint32_t batches_compressed;
+	/** Total number of bytes saved by compressing dictionary log batches */
+	uint32_t bytes_saved;
 } stats;
 
 /* Information about a log message is stored in the log_context by the logger_process backend
@@ -138,6 +143,16 @@ LOG_BACKEND_DEFINE(log_nrf_cloud_backend, logger_api, false);
 LOG_OUTPUT_DEFINE(log_nrf_cloud_output, logger_out, log_buf, (sizeof(log_buf) - 1));
 RING_BUF_DECLARE(log_nrf_cloud_rb, RING_BUF_SIZE);
 
+#if defined(CONFIG_NRF_CLOUD_LOG_DICT_COMPRESS)
+BUILD_ASSERT(RING_BUF_SIZE <= NRF_CLOUD_LOG_LZ_BATCH_MAX,
+	     "Ring buffer size must fit in a compressed batch");
+
+static struct nrf_cloud_log_lz_ctx lz_ctx;
+/* Compressed batch, sent instead of the ring buffer contents */
+static uint8_t lz_buf[RING_BUF_SIZE];
+static uint32_t batch_seq;
+#endif
+
 static int send_ring_buffer(void);
 
 static void logger_init(const struct log_backend *const backend)
@@ -344,10 +359,12 @@ static void logger_notify(const struct log_backend *const backend, enum log_back
 	send_ring_buffer();
 	if (CONFIG_NRF_CLOUD_LOG_LOG_LEVEL >= LOG_LEVEL_DBG) {
 		LOG_DBG("Buffered lines:%u, bytes:%u; logged lines:%u, bytes:%u; "
-			"sent lines:%u, bytes:%u; dropped lines:%u",
+			"sent lines:%u, bytes:%u; dropped lines:%u; "
+			"compressed batches:%u, bytes saved:%u",
 			log_buffered_cnt(), ring_buf_size_get(&log_nrf_cloud_rb),
 			stats.lines_rendered, stats.bytes_rendered, stats.lines_sent,
-			stats.bytes_sent, stats.lines_dropped);
+			stats.bytes_sent, stats.lines_dropped, stats.batches_compressed,
+			stats.bytes_saved);
 	} else {
 		LOG_INF("Sent lines:%u, bytes:%u", stats.lines_sent, stats.bytes_sent);
 	}
@@ -381,6 +398,48 @@ static int convert_to_quoted_base64(const uint8_t *in_ptr, size_t in_sz, uint8_t
 	return 0;
 }
 
+#if defined(CONFIG_NRF_CLOUD_LOG_DICT_COMPRESS)
+/* Compress the dictionary logs read from the ring buffer into lz_buf, keeping the binary
+ * header in front. The batch is left as is when it does not get smaller.
+ */
+static void dict_batch_compress(uint8_t **batch, uint32_t *batch_len)
+{
+	struct nrf_cloud_bin_hdr hdr;
+	size_t lz_len;
+	int err;
+
+	if (*batch_len <= sizeof(hdr)) {
+		return;
+	}
+
+	memcpy(&hdr, *batch, sizeof(hdr));
+	err = nrf_cloud_log_lz_frame(&lz_ctx, *batch + sizeof(hdr), *batch_len - sizeof(hdr),
+				     num_msgs, batch_seq++, lz_buf + sizeof(hdr),
+				     *batch_len - sizeof(hdr) - 1, &lz_len);
+	if (err) {
+		if (err != -E2BIG) {
+			LOG_WRN("Error compressing logs: %d", err);
+		}
+		return;
+	}
+
+	hdr.format = NRF_CLOUD_DICT_LOG_LZ_FMT;
+	memcpy(lz_buf, &hdr, sizeof(hdr));
+	lz_len += sizeof(hdr);
+
+	stats.batches_compressed++;
+	stats.bytes_saved += *batch_len - lz_len;
+	*batch = lz_buf;
+	*batch_len = lz_len;
+}
+#else
+static void dict_batch_compress(uint8_t **batch, uint32_t *batch_len)
+{
+	ARG_UNUSED(batch);
+	ARG_UNUSED(batch_len);
+}
+#endif /* CONFIG_NRF_CLOUD_LOG_DICT_COMPRESS */
+
 static char *get_dict_topic(void)
 {
 	int err;
@@ -420,6 +479,8 @@ static int send_ring_buffer(void)
 	char *topic = NULL;
 	uint8_t *log_rb_ptr;
 	uint32_t log_rb_len;
+	uint8_t *batch_ptr;
+	uint32_t batch_len;
 	uint8_t *log_b64_ptr = NULL;
 	uint32_t log_b64_len;
 	struct nrf_cloud_data output_data;
@@ -442,12 +503,22 @@ static int send_ring_buffer(void)
 	if (!log_rb_len) {
 		goto cleanup;
 	}
+
+	/* The ring buffer is reset after each batch, so the whole batch can be compressed
+	 * straight from the claimed area.
+	 */
+	batch_ptr = log_rb_ptr;
+	batch_len = log_rb_len;
+	if (log_format_current == LOG_OUTPUT_DICT) {
+		dict_batch_compress(&batch_ptr, &batch_len);
+	}
+
 	if ((log_format_current == LOG_OUTPUT_DICT) && IS_ENABLED(CONFIG_NRF_CLOUD_REST)) {
 		topic = get_dict_topic();
 		if (!topic) {
 			goto cleanup;
 		}
-		err = convert_to_quoted_base64(log_rb_ptr, log_rb_len, &log_b64_ptr, &log_b64_len);
+		err = convert_to_quoted_base64(batch_ptr, batch_len, &log_b64_ptr, &log_b64_len);
 		if (err) {
 			goto cleanup;
 		}
@@ -458,8 +529,8 @@ static int send_ring_buffer(void)
 	} else {
 		/* Send ring buffer contents as is -- JSON or raw binary. */
 		log_rb_ptr[log_rb_len] = '\0';
-		output_data.ptr = log_rb_ptr;
-		output_data.len = log_rb_len;
+		output_data.ptr = batch_ptr;
+		output_data.len = batch_len;
 	}
 
 	LOG_DBG("Ready to transmit %zd bytes...", output_data.len);
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include "nrf_cloud_log_lz.h"
+
+/* Shortest match that is encoded as a back reference */
+#define MIN_MATCH 4
+/* Value of a token nibble that is followed by extension bytes */
+#define NIBBLE_MAX 15
+
+/* Bounded output of the compressor */
+struct lz_out {
+	uint8_t *buf;
+	size_t size;
+	size_t len;
+};
+
+static uint32_t read32(const uint8_t *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static uint32_t hash32(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - NRF_CLOUD_LOG_LZ_HASH_BITS);
+}
+
+static int out_put(struct lz_out *out, const uint8_t *data, size_t len)
+{
+	if (len > out->size - out->len) {
+		return -E2BIG;
+	}
+
+	memcpy(&out->buf[out->len], data, len);
+	out->len += len;
+	return 0;
+}
+
+/* Writes the remainder of a length that did not fit in its token nibble */
+static int out_len_ext(struct lz_out *out, size_t len)
+{
+	uint8_t byte = UINT8_MAX;
+	int err = 0;
+
+	len -= NIBBLE_MAX;
+	while (!err && (len >= UINT8_MAX)) {
+		err = out_put(out, &byte, 1);
+		len -= UINT8_MAX;
+	}
+
+	byte = len;
+	return err ? err : out_put(out, &byte, 1);
+}
+
+/* Writes one sequence: literals, then a match unless match_len is 0 */
+static int out_sequence(struct lz_out *out, const uint8_t *lit, size_t lit_len, uint16_t offset,
+			size_t match_len)
+{
+	size_t ml = match_len ? (match_len - MIN_MATCH) : 0;
+	uint8_t token = (MIN(lit_len, NIBBLE_MAX) << 4) | MIN(ml, NIBBLE_MAX);
+	uint8_t off[2] = {offset & 0xFF, offset >> 8};
+	int err;
+
+	err = out_put(out, &token, 1);
+	if (!err && (lit_len >= NIBBLE_MAX)) {
+		err = out_len_ext(out, lit_len);
+	}
+	if (!err) {
+		err = out_put(out, lit, lit_len);
+	}
+	if (err || !match_len) {
+		return err;
+	}
+
+	err = out_put(out, off, sizeof(off));
+	if (!err && (ml >= NIBBLE_MAX)) {
+		err = out_len_ext(out, ml);
+	}
+
+	return err;
+}
+
+static int compress(struct nrf_cloud_log_lz_ctx *const ctx, const uint8_t *const in,
+		    size_t in_len, struct lz_out *out)
+{
+	size_t anchor = 0;
+	size_t pos = 0;
+	size_t ref;
+	size_t len;
+	uint32_t v;
+	uint32_t h;
+	int err;
+
+	memset(ctx->table, 0, sizeof(ctx->table));
+
+	while (pos + MIN_MATCH <= in_len) {
+		v = read32(&in[pos]);
+		h = hash32(v);
+		ref = ctx->table[h];
+		ctx->table[h] = pos + 1;
+
+		if (!ref || (read32(&in[ref - 1]) != v)) {
+			pos++;
+			continue;
+		}
+
+		/* Extend the match, it may overlap the current position */
+		ref--;
+		len = MIN_MATCH;
+		while ((pos + len < in_len) && (in[ref + len] == in[pos + len])) {
+			len++;
+		}
+
+		err = out_sequence(out, &in[anchor], pos - anchor, pos - ref, len);
+		if (err) {
+			return err;
+		}
+
+		pos += len;
+		anchor = pos;
+	}
+
+	/* The last sequence only has literals */
+	return out_sequence(out, &in[anchor], in_len - anchor, 0, 0);
+}
+
+int nrf_cloud_log_lz_frame(struct nrf_cloud_log_lz_ctx *const ctx, const uint8_t *const batch,
+			   size_t batch_len, uint16_t msg_cnt, uint32_t batch_seq,
+			   uint8_t *const out, size_t out_size, size_t *const out_len)
+{
+	struct nrf_cloud_log_lz_hdr hdr = {
+		.raw_len = batch_len,
+		.msg_cnt = msg_cnt,
+		.batch_seq = batch_seq,
+	};
+	struct lz_out lz = {
+		.buf = out,
+		.size = out_size,
+		.len = 0,
+	};
+	int err;
+
+	if (!ctx || !batch || !out || !out_len || !batch_len ||
+	    (batch_len > NRF_CLOUD_LOG_LZ_BATCH_MAX)) {
+		return -EINVAL;
+	}
+
+	err = out_put(&lz, (const uint8_t *)&hdr, sizeof(hdr));
+	if (!err) {
+		err = compress(ctx, batch, batch_len, &lz);
+	}
+
+	*out_len = err ? 0 : lz.len;
+	return err;
+}
+
+#if defined(CONFIG_ZTEST)
+/* Reads the remainder of a length that did not fit in its token nibble */
+static int in_len_ext(const uint8_t *in, size_t in_len, size_t *pos, size_t *len)
+{
+	uint8_t byte;
+
+	do {
+		if (*pos >= in_len) {
+			return -EBADMSG;
+		}
+		byte = in[(*pos)++];
+		*len += byte;
+	} while (byte == UINT8_MAX);
+
+	return 0;
+}
+
+int nrf_cloud_log_lz_unframe(const uint8_t *const frame, size_t frame_len,
+			     struct nrf_cloud_log_lz_hdr *const hdr, uint8_t *const out,
+			     size_t out_size)
+{
+	const uint8_t *in;
+	size_t in_len;
+	size_t ip = 0;
+	size_t op = 0;
+	size_t len;
+	size_t offset;
+	uint8_t token;
+
+	if (!frame || !hdr || !out || (frame_len < sizeof(*hdr))) {
+		return -EBADMSG;
+	}
+
+	memcpy(hdr, frame, sizeof(*hdr));
+	in = &frame[sizeof(*hdr)];
+	in_len = frame_len - sizeof(*hdr);
+	if (hdr->raw_len > out_size) {
+		return -E2BIG;
+	}
+
+	while (ip < in_len) {
+		token = in[ip++];
+
+		len = token >> 4;
+		if ((len == NIBBLE_MAX) && in_len_ext(in, in_len, &ip, &len)) {
+			return -EBADMSG;
+		}
+		if ((len > in_len - ip) || (len > hdr->raw_len - op)) {
+			return -EBADMSG;
+		}
+		memcpy(&out[op], &in[ip], len);
+		ip += len;
+		op += len;
+
+		if (ip == in_len) {
+			/* Last sequence */
+			break;
+		}
+
+		if (in_len - ip < 2) {
+			return -EBADMSG;
+		}
+		offset = in[ip] | (in[ip + 1] << 8);
+		ip += 2;
+
+		len = token & NIBBLE_MAX;
+		if ((len == NIBBLE_MAX) && in_len_ext(in, in_len, &ip, &len)) {
+			return -EBADMSG;
+		}
+		len += MIN_MATCH;
+
+		if (!offset || (offset > op) || (len > hdr->raw_len - op)) {
+			return -EBADMSG;
+		}
+
+		/* Byte by byte, since the match may overlap the output */
+		for (size_t i = 0; i < len; i++, op++) {
+			out[op] = out[op - offset];
+		}
+	}
+
+	return (op == hdr->raw_len) ? 0 : -EBADMSG;
+}
+#endif /* CONFIG_ZTEST */
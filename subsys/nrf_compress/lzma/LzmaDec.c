@@ -1566,17 +1566,19 @@ SRes LzmaDec_Allocate(CLzmaDec *p, const Byte *props, unsigned propsSize, ISzAll
 	}
 	p->dicBufSize = dicBufSize;
 #else
-	if (!p->dicHandle || dicBufSize != p->dicHandle->dicBufSize) {
-		if (p->dicHandle) {
+	if (!p->dicHandle) {
+		return SZ_ERROR_PARAM;
+	}
+
+	if (!p->dicHandle->isOpened || dicBufSize != p->dicHandle->dicBufSize) {
+		if (p->dicHandle->isOpened) {
 			SRes const rc = LzmaDictionaryClose(p->dicHandle);
 			if (rc != 0) {
 				return rc;
 			}
 		}
 
-		p->dicHandle = LzmaDictionaryOpen(dicBufSize);
-
-		if (!p->dicHandle) {
+		if (!LzmaDictionaryOpen(p->dicHandle, dicBufSize)) {
 			return SZ_ERROR_MEM;
 		}
 	}
@@ -264,13 +264,15 @@ SRes LzmaDecode(Byte *dest, SizeT *destLen, const Byte *src, SizeT *srcLen, cons
 
 /* Open dictionary with requested size.
 
+handle:
+  Pointer to dictionary handle struct of the decoder, owned by the user of this library.
 minSize:
   Minimal size of the dictionary.
 Returns:
   Pointer to a dictionary handle struct for subsequent API calls
   or NULL if failed to open.
 */
-DictHandle *LzmaDictionaryOpen(SizeT minSize);
+DictHandle *LzmaDictionaryOpen(DictHandle *handle, SizeT minSize);
 
 /* Write to dictionary.
 
@@ -19,16 +19,9 @@ LOG_MODULE_REGISTER(nrf_compress_lzma, CONFIG_NRF_COMPRESS_LOG_LEVEL);
 /* Header size for lzma2 */
 #define LZMA2_HEADER_SIZE 2
 
-/* Assume lp and lc parameters in the compressed images do not sum to a value greater than the
- * following constant to limit the memory used by LZMA probability array.
- */
-#define MAX_LZMA_LC_PLUS_LP 4
-#define MAX_LZMA_PROB_SIZE  (1984 + (0x300 << MAX_LZMA_LC_PLUS_LP))
-
-/* Assume the maximum LZMA dictionary size to limit the RAM buffer size for the decompressed
- * stream.
- */
-#define MAX_LZMA_DICT_SIZE  (128 * 1024)
+/* Limits of the arenas of an instance, see lzma_types.h. */
+#define MAX_LZMA_PROB_SIZE  (NRF_COMPRESS_LZMA_PROBS_SIZE / sizeof(CLzmaProb))
+#define MAX_LZMA_DICT_SIZE  NRF_COMPRESS_LZMA_DICT_SIZE
 
 #if !defined(CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA1) && \
 	!defined(CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2)
@@ -36,35 +29,113 @@ LOG_MODULE_REGISTER(nrf_compress_lzma, CONFIG_NRF_COMPRESS_LOG_LEVEL);
 	"CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA1 or CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2"
 #endif
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
-static uint16_t lzma_probs[MAX_LZMA_PROB_SIZE];
+#if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+/**
+ * @brief Dictionary Cache Structure
+ */
+typedef struct dict_cache_t {
+	/** Cached dictionary data. */
+	uint8_t data[CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE];
+	/** Indicates which dictionary element is stored as first element of @a data. */
+	SizeT dict_pos_begin;
+	/** Indicates which dictionary element is stored as last element of @a data. */
+	SizeT dict_pos_end;
+	/** Write offset, for keeping track on invalidated bytes. */
+	SizeT write_offset;
+	/** Cache invalidation flag - if set, it is out of sync with external dictionary. */
+	bool invalid;
+} dict_cache;
 #endif
 
+/**
+ * @brief Decoder state of an instance, held in @ref lzma_codec.state.
+ */
+struct lzma_state {
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+	CLzma2Dec decoder;
+#else
+	CLzmaDec decoder;
+#endif
+	/** Allocator of the probabilities, used to find the instance in the callbacks. */
+	ISzAlloc alloc;
+	/** Arena for the probabilities, NULL if they are allocated with malloc. */
+	void *probs;
 #if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) && defined(CONFIG_NRF_COMPRESS_CLEANUP)
-static size_t malloc_probs_size = 0;
+	/** Size of the probabilities allocated with malloc. */
+	size_t malloc_probs_size;
+#endif
+	size_t output_limit;
+	bool allocated_probs;
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	/**
+	 * @brief Pointer to external dictionary interface,
+	 * set on module initialization function and held as context variable.
+	 */
+	const lzma_dictionary_interface *ext_dict;
+	DictHandle dict_handle;
+#if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+	dict_cache cache;
+#endif
+#else
+	/** Dictionary arena, NULL when the instance is not initialized. */
+	uint8_t *dict;
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	/** The dictionary was allocated with malloc. */
+	bool dict_allocated;
+#endif
 #endif
+};
+
+/* The instance reserves NRF_COMPRESS_LZMA_STATE_SIZE bytes for this structure. Increase it
+ * in lzma_types.h when the structure or the decoder state in it grows.
+ */
+BUILD_ASSERT(sizeof(struct lzma_state) <= sizeof(((lzma_codec *)NULL)->state),
+	     "NRF_COMPRESS_LZMA_STATE_SIZE is too small");
 
-static void *lzma_probs_alloc(ISzAllocPtr p, size_t size)
-{
 #if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
-	if (size > sizeof(lzma_probs)) {
-		LOG_ERR("Compress library tried to allocate too large a buffer (0x%x)", size);
-		return NULL;
-	}
+static CLzmaProb lzma_probs[MAX_LZMA_PROB_SIZE];
 
-	return lzma_probs;
+#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
+static uint8_t __aligned(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT) lzma_dict[MAX_LZMA_DICT_SIZE];
 #else
-	void *buffer = malloc(size);
+static uint8_t lzma_dict[MAX_LZMA_DICT_SIZE];
+#endif
+#endif
 
-	if (buffer == NULL) {
-		LOG_ERR("Failed to allocate nRF compression library buffer (0x%x)", size);
-#ifdef CONFIG_NRF_COMPRESS_CLEANUP
-	} else {
-		malloc_probs_size = size;
+/* The static buffers serve one instance at a time, other instances must provide their own. */
+static struct lzma_state *static_buffers_user;
+#endif
+
+#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+/* Instance used when the application does not provide one. */
+static lzma_codec default_codec;
 #endif
+
+static lzma_codec *codec_get(void *inst)
+{
+#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	if (inst == NULL) {
+		return &default_codec;
 	}
+#endif
 
-	return buffer;
+	return inst;
+}
+
+static struct lzma_state *state_get(void *inst)
+{
+	lzma_codec *codec = codec_get(inst);
+
+	return codec != NULL ? (struct lzma_state *)codec->state : NULL;
+}
+
+static CLzmaDec *decoder_get(struct lzma_state *state)
+{
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+	return &state->decoder.decoder;
+#else
+	return &state->decoder;
 #endif
 }
 
@@ -82,80 +153,140 @@ static void like_mbedtls_zeroize(void *p, size_t n)
 }
 #endif
 
-static void lzma_probs_free(ISzAllocPtr p, void *address)
+static void *lzma_probs_alloc(ISzAllocPtr p, size_t size)
 {
+	struct lzma_state *state = CONTAINER_OF(p, struct lzma_state, alloc);
+
+	if (state->probs != NULL) {
+		if (size > NRF_COMPRESS_LZMA_PROBS_SIZE) {
+			LOG_ERR("Compress library tried to allocate too large a buffer (0x%x)",
+				size);
+			return NULL;
+		}
+
+		return state->probs;
+	}
+
 #if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	void *buffer = malloc(size);
+
+	if (buffer == NULL) {
+		LOG_ERR("Failed to allocate nRF compression library buffer (0x%x)", size);
 #ifdef CONFIG_NRF_COMPRESS_CLEANUP
+	} else {
+		state->malloc_probs_size = size;
+#endif
+	}
+
+	return buffer;
+#else
+	return NULL;
+#endif
+}
+
+static void lzma_probs_free(ISzAllocPtr p, void *address)
+{
+	struct lzma_state *state = CONTAINER_OF(p, struct lzma_state, alloc);
+
 	if (address == NULL) {
 		return;
 	}
 
-	if (malloc_probs_size > 0) {
-		like_mbedtls_zeroize(address, malloc_probs_size);
-		malloc_probs_size = 0;
+	if (address == state->probs) {
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+		like_mbedtls_zeroize(address, NRF_COMPRESS_LZMA_PROBS_SIZE);
+#endif
+		return;
 	}
 
-#endif
-	free(address);
-#else
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
 #ifdef CONFIG_NRF_COMPRESS_CLEANUP
-	like_mbedtls_zeroize(lzma_probs, sizeof(lzma_probs));
+	if (state->malloc_probs_size > 0) {
+		like_mbedtls_zeroize(address, state->malloc_probs_size);
+		state->malloc_probs_size = 0;
+	}
 #endif
+	free(address);
 #endif
 }
 
-const static ISzAlloc lzma_probs_allocator = {
-	.Alloc = lzma_probs_alloc,
-	.Free = lzma_probs_free,
-};
+/**
+ * @brief Take the arenas of an instance. The ones not provided by the application are taken
+ * from the static buffers or allocated, depending on the memory type.
+ */
+static int buffers_take(const lzma_codec *codec, struct lzma_state *state)
+{
+	state->probs = codec->probs;
+#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	state->dict = codec->dict;
+#endif
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
-static uint8_t __aligned(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT) lzma_dict[MAX_LZMA_DICT_SIZE];
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	if (state->probs == NULL) {
 #else
-static uint8_t lzma_dict[MAX_LZMA_DICT_SIZE];
+	if (state->probs == NULL || state->dict == NULL) {
 #endif
-#elif defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-static uint8_t *lzma_dict = NULL;
+		if (static_buffers_user != NULL) {
+			LOG_ERR("Static buffers are used by another instance");
+			return -EBUSY;
+		}
+
+		static_buffers_user = state;
+
+		if (state->probs == NULL) {
+			state->probs = lzma_probs;
+		}
+
+#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+		if (state->dict == NULL) {
+			state->dict = lzma_dict;
+		}
+#endif
+	}
+#elif !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	if (state->dict == NULL) {
+#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
+		state->dict = (uint8_t *)aligned_alloc(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT,
+						       MAX_LZMA_DICT_SIZE);
 #else
-/**
- * @brief Pointer to external dictionary interface,
- * set on module initialization function and held as context variable.
- */
-static const lzma_dictionary_interface *ext_dict;
+		state->dict = (uint8_t *)malloc(MAX_LZMA_DICT_SIZE);
+#endif
 
-static DictHandle dict_handle;
+		if (state->dict == NULL) {
+			return -ENOMEM;
+		}
 
-#if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
-/**
- * @brief Dictionary Cache Structure
- */
-typedef struct dict_cache_t {
-	/** Cached dictionary data. */
-	uint8_t data[CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE];
-	/** Indicates which dictionary element is stored as first element of @a data. */
-	SizeT dict_pos_begin;
-	/** Indicates which dictionary element is stored as last element of @a data. */
-	SizeT dict_pos_end;
-	/** Write offset, for keeping track on invalidated bytes. */
-	SizeT write_offset;
-	/** Cache invalidation flag - if set, it is out of sync with external dictionary. */
-	bool invalid;
-} dict_cache;
+		state->dict_allocated = true;
+	}
+#endif
+
+	return 0;
+}
+
+static void buffers_release(struct lzma_state *state)
+{
+#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (state->dict_allocated) {
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+		memset(state->dict, 0x00, MAX_LZMA_DICT_SIZE);
+#endif
 
-static dict_cache cache;
+		free(state->dict);
+		state->dict_allocated = false;
+	}
 #endif
+	state->dict = NULL;
 #endif
 
-static size_t lzma_output_limit = SIZE_MAX;
-static bool allocated_probs = false;
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-static CLzma2Dec lzma_decoder;
-#else
-static CLzmaDec lzma_decoder;
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
+	if (static_buffers_user == state) {
+		static_buffers_user = NULL;
+	}
 #endif
+	state->probs = NULL;
+}
 
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
 /**
@@ -164,42 +295,44 @@ static CLzmaDec lzma_decoder;
  * This function synchronizes data in cache with external
  * dictionary and proceeds with cache window.
  *
- * @param handle pointer to Lzma dictionary handle struct, for dictionary size reference.
+ * @param state instance the cache belongs to.
  *
  * @retval 0 on successful synchronization
  * @retval -EIO on any error with reading/writing to external dictionary
  */
-static int synchronize_cache(const DictHandle *handle)
+static int synchronize_cache(struct lzma_state *state)
 {
+	dict_cache *cache = &state->cache;
+	const DictHandle *handle = &state->dict_handle;
 	SizeT dict_read_size;
-	const SizeT dict_write_size = cache.write_offset;
+	const SizeT dict_write_size = cache->write_offset;
 
-	if (ext_dict->write(cache.dict_pos_begin, cache.data, dict_write_size) !=
+	if (state->ext_dict->write(cache->dict_pos_begin, cache->data, dict_write_size) !=
 			dict_write_size) {
 		return -EIO;
 	}
 
-	cache.write_offset = 0;
+	cache->write_offset = 0;
 
-	cache.dict_pos_begin = cache.dict_pos_end + 1;
+	cache->dict_pos_begin = cache->dict_pos_end + 1;
 
-	if (cache.dict_pos_begin == handle->dicBufSize) {
+	if (cache->dict_pos_begin == handle->dicBufSize) {
 		/* We reached the end of dictionary, start caching from the beginning. */
-		cache.dict_pos_begin = 0;
+		cache->dict_pos_begin = 0;
 	}
 
-	dict_read_size = (handle->dicBufSize - cache.dict_pos_begin) < sizeof(cache.data) ?
-						(handle->dicBufSize - cache.dict_pos_begin)
-						: sizeof(cache.data);
+	dict_read_size = (handle->dicBufSize - cache->dict_pos_begin) < sizeof(cache->data) ?
+						(handle->dicBufSize - cache->dict_pos_begin)
+						: sizeof(cache->data);
 
-	cache.dict_pos_end = cache.dict_pos_begin + dict_read_size - 1;
+	cache->dict_pos_end = cache->dict_pos_begin + dict_read_size - 1;
 
-	if (ext_dict->read(cache.dict_pos_begin,
-			cache.data, dict_read_size) != dict_read_size) {
+	if (state->ext_dict->read(cache->dict_pos_begin,
+			cache->data, dict_read_size) != dict_read_size) {
 		return -EIO;
 	}
 
-	cache.invalid = false;
+	cache->invalid = false;
 
 	return 0;
 }
@@ -208,88 +341,76 @@ static int synchronize_cache(const DictHandle *handle)
 /**
  * @brief Check the instance of lzma_codec during API calls.
  */
-#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-static int check_inst(void *inst)
+static int check_inst(struct lzma_state *state)
 {
-	if (inst != CONTAINER_OF(ext_dict, lzma_codec, dict_if)) {
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	if (state == NULL || state->ext_dict == NULL) {
 		return -EINVAL;
 	}
+#else
+	ARG_UNUSED(state);
+#endif
 
 	return 0;
 }
-#else
-#define check_inst(...) 0
-#endif
 
 static int lzma_reset(void *inst, size_t decompressed_size);
 
 static int lzma_init(void *inst, size_t decompressed_size)
 {
-	int rc = 0;
+	int rc;
+	lzma_codec *codec = codec_get(inst);
+	struct lzma_state *state = state_get(inst);
 
 #if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	if (inst == NULL || ext_dict != NULL) {
+	if (state == NULL || state->ext_dict != NULL) {
 		return -EINVAL;
 	}
 
-	ext_dict = &((lzma_codec *)inst)->dict_if;
-	if (ext_dict->open == NULL || ext_dict->close == NULL
-	    || ext_dict->write == NULL || ext_dict->read == NULL) {
+	if (codec->dict_if.open == NULL || codec->dict_if.close == NULL
+	    || codec->dict_if.write == NULL || codec->dict_if.read == NULL) {
 		return -EINVAL;
 	}
 #else
-	ARG_UNUSED(inst);
+	if (state->dict != NULL) {
+		/* Already initialized */
+		return lzma_reset(inst, decompressed_size);
+	}
 #endif
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	if (lzma_dict != NULL) {
-		/* Already allocated */
-		lzma_reset(inst, decompressed_size);
+	rc = buffers_take(codec, state);
 
+	if (rc) {
+		buffers_release(state);
 		return rc;
 	}
 
-#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
-	lzma_dict = (uint8_t *)aligned_alloc(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT,
-					     MAX_LZMA_DICT_SIZE);
-#else
-	lzma_dict = (uint8_t *)malloc(MAX_LZMA_DICT_SIZE);
-#endif
+	state->alloc.Alloc = lzma_probs_alloc;
+	state->alloc.Free = lzma_probs_free;
+	state->allocated_probs = false;
+	state->output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
 
-	if (lzma_dict == NULL) {
-		rc = -ENOMEM;
-	}
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	state->ext_dict = &codec->dict_if;
 #endif
 
-	lzma_output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
-
-	return rc;
+	return 0;
 }
 
 static int lzma_deinit(void *inst)
 {
-	int rc = check_inst(inst);
+	struct lzma_state *state = state_get(inst);
+	int rc = check_inst(state);
 
 	if (rc) {
 		return rc;
 	}
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	if (lzma_dict != NULL) {
-#ifdef CONFIG_NRF_COMPRESS_CLEANUP
-		memset(lzma_dict, 0x00, MAX_LZMA_DICT_SIZE);
-#endif
-
-		free(lzma_dict);
-		lzma_dict = NULL;
-	}
-#endif
 	rc = lzma_reset(inst, 0);
+	buffers_release(state);
 
 #if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	ext_dict = NULL;
+	state->ext_dict = NULL;
 #endif
 
 	return rc;
@@ -297,65 +418,60 @@ static int lzma_deinit(void *inst)
 
 static int lzma_reset(void *inst, size_t decompressed_size)
 {
-	int rc = check_inst(inst);
+	struct lzma_state *state = state_get(inst);
+	int rc = check_inst(state);
+	CLzmaDec *decoder;
 
 	if (rc != 0) {
 		return rc;
 	}
 
-	if (allocated_probs) {
-		allocated_probs = false;
+	decoder = decoder_get(state);
 
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		Lzma2Dec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
+	if (state->allocated_probs) {
+		state->allocated_probs = false;
 
-#ifdef CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY
-		if (lzma_decoder.decoder.dicHandle->isOpened) {
-			rc = LzmaDictionaryClose(lzma_decoder.decoder.dicHandle);
-			if (rc != 0) {
-				rc = -EIO;
-			}
-		}
-#endif
-		lzma_decoder.decoder.dicPos = 0;
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+		Lzma2Dec_FreeProbs(&state->decoder, &state->alloc);
 #else
-		LzmaDec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
+		LzmaDec_FreeProbs(&state->decoder, &state->alloc);
+#endif
+
 #ifdef CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY
-		if (lzma_decoder.dicHandle->isOpened) {
-			rc = LzmaDictionaryClose(lzma_decoder.decoder.dicHandle);
+		if (decoder->dicHandle->isOpened) {
+			rc = LzmaDictionaryClose(decoder->dicHandle);
 			if (rc != 0) {
 				rc = -EIO;
 			}
 		}
 #endif
-		lzma_decoder.dicPos = 0;
-#endif
+		decoder->dicPos = 0;
 	}
 
-	lzma_output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
+	state->output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
 
 	return rc;
 }
 
 static size_t lzma_bytes_needed(void *inst)
 {
-	const int arg_check_rc = check_inst(inst);
+	struct lzma_state *state = state_get(inst);
+	const int arg_check_rc = check_inst(state);
 
 	if (arg_check_rc) {
 		return arg_check_rc;
 	}
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	if (lzma_dict == NULL) {
+#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	if (state->dict == NULL) {
 		return 0;
 	}
 #endif
 
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-	return (allocated_probs ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : LZMA2_HEADER_SIZE);
+	return (state->allocated_probs ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : LZMA2_HEADER_SIZE);
 #else
-	return (allocated_probs ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : LZMA_PROPS_SIZE);
+	return (state->allocated_probs ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : LZMA_PROPS_SIZE);
 #endif
 }
 
@@ -368,21 +484,13 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 	size_t chunk_size = input_size;
 	ELzmaFinishMode finish_mode = LZMA_FINISH_ANY;
 	SizeT dic_limit = MAX_LZMA_DICT_SIZE;
+	struct lzma_state *state = state_get(inst);
+	CLzmaDec *decoder = decoder_get(state);
+	SizeT curr_dic_pos = decoder->dicPos;
 
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2 /* For convenience */
-	SizeT *dic_pos = &lzma_decoder.decoder.dicPos;
-#else
-	SizeT *dic_pos =  &lzma_decoder.dicPos;
-#endif
-	SizeT curr_dic_pos = *dic_pos;
-
-	ARG_UNUSED(inst);
-
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
-	if (lzma_dict == NULL) {
+	if (state->dict == NULL) {
 		return -ESRCH;
 	}
-#endif
 
 	if (input == NULL || input_size == 0 || offset == NULL || output == NULL ||
 	    output_size == NULL) {
@@ -392,32 +500,28 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 	*output = NULL;
 	*output_size = 0;
 
-	if (!allocated_probs) {
+	if (!state->allocated_probs) {
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		rc = Lzma2Dec_AllocateProbs(&lzma_decoder, input[0], &lzma_probs_allocator);
+		rc = Lzma2Dec_AllocateProbs(&state->decoder, input[0], &state->alloc);
 #else
-		rc = LzmaDec_AllocateProbs(&lzma_decoder, input, LZMA_PROPS_SIZE,
-					   &lzma_probs_allocator);
+		rc = LzmaDec_AllocateProbs(&state->decoder, input, LZMA_PROPS_SIZE,
+					   &state->alloc);
 #endif
 
 		if (rc) {
 			return -EINVAL;
 		}
 
+		if (decoder->prop.dicSize > MAX_LZMA_DICT_SIZE) {
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		if (lzma_decoder.decoder.prop.dicSize > MAX_LZMA_DICT_SIZE) {
-#else
-		if (lzma_decoder.prop.dicSize > MAX_LZMA_DICT_SIZE) {
-#endif
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-			Lzma2Dec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
+			Lzma2Dec_FreeProbs(&state->decoder, &state->alloc);
 #else
-			LzmaDec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
+			LzmaDec_FreeProbs(&state->decoder, &state->alloc);
 #endif
 			return -EINVAL;
 		}
 
-		allocated_probs = true;
+		state->allocated_probs = true;
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
 		*offset = LZMA2_HEADER_SIZE;
 #else
@@ -425,32 +529,30 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 		*offset = LZMA_PROPS_SIZE + sizeof(uint64_t);
 #endif
 
+		decoder->dic = state->dict;
+		decoder->dicBufSize = MAX_LZMA_DICT_SIZE;
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		lzma_decoder.decoder.dic = lzma_dict;
-		lzma_decoder.decoder.dicBufSize = MAX_LZMA_DICT_SIZE;
-		Lzma2Dec_Init(&lzma_decoder);
+		Lzma2Dec_Init(&state->decoder);
 #else
-		lzma_decoder.dic = lzma_dict;
-		lzma_decoder.dicBufSize = MAX_LZMA_DICT_SIZE;
-		LzmaDec_Init(&lzma_decoder);
+		LzmaDec_Init(&state->decoder);
 #endif
 
 		return 0;
 	}
 
-	if (MAX_LZMA_DICT_SIZE - curr_dic_pos >= lzma_output_limit) {
+	if (MAX_LZMA_DICT_SIZE - curr_dic_pos >= state->output_limit) {
 		/* Limit the output size because we are reaching
 		 * the limit of expected decompressed data size.
 		 */
 		finish_mode = LZMA_FINISH_END;
-		dic_limit = lzma_output_limit + curr_dic_pos;
+		dic_limit = state->output_limit + curr_dic_pos;
 	}
 
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-	rc = Lzma2Dec_DecodeToDic(&lzma_decoder, dic_limit,
+	rc = Lzma2Dec_DecodeToDic(&state->decoder, dic_limit,
 				  input, &chunk_size, finish_mode, &status);
 #else
-	rc = LzmaDec_DecodeToDic(&lzma_decoder, dic_limit,
+	rc = LzmaDec_DecodeToDic(&state->decoder, dic_limit,
 				 input, &chunk_size, finish_mode, &status);
 #endif
 
@@ -459,7 +561,7 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 	}
 
 	*offset = chunk_size;
-	lzma_output_limit -= (*dic_pos - curr_dic_pos);
+	state->output_limit -= (decoder->dicPos - curr_dic_pos);
 
 	if (last_part && status == LZMA_STATUS_FINISHED_WITH_MARK &&
 	    *offset < input_size) {
@@ -475,36 +577,63 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 		 */
 		if (status != LZMA_STATUS_MAYBE_FINISHED_WITHOUT_MARK
 		 && status != LZMA_STATUS_FINISHED_WITH_MARK
-		 && (status != LZMA_STATUS_NEEDS_MORE_INPUT && lzma_output_limit == 0)) {
+		 && (status != LZMA_STATUS_NEEDS_MORE_INPUT && state->output_limit == 0)) {
 			return -EINVAL;
 		}
 	}
 
-	if (*dic_pos >= MAX_LZMA_DICT_SIZE || last_part) {
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		*output = lzma_decoder.decoder.dic;
-#else
-		*output = lzma_decoder.dic;
-#endif
-		*output_size = *dic_pos;
-		*dic_pos = 0;
+	if (decoder->dicPos >= MAX_LZMA_DICT_SIZE || last_part) {
+		*output = decoder->dic;
+		*output_size = decoder->dicPos;
+		decoder->dicPos = 0;
 	}
 
 	return rc;
 }
 #else
+DictHandle *LzmaDictionaryOpen(DictHandle *handle, SizeT size)
+{
+	struct lzma_state *state = CONTAINER_OF(handle, struct lzma_state, dict_handle);
+	size_t dict_size;
+
+	if (handle->isOpened) {
+		return handle;
+	}
+
+	if (state->ext_dict == NULL) {
+		return NULL;
+	}
+
+	if (state->ext_dict->open((size_t)size, &dict_size) != 0) {
+		LOG_ERR("Unable to open external dictionary with size %u", size);
+		return NULL;
+	}
+
+	handle->isOpened = True;
+	handle->dicBufSize = dict_size;
+
+#if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+	state->cache.dict_pos_begin = 0;
+	state->cache.dict_pos_end = sizeof(state->cache.data) - 1;
+	state->cache.write_offset = 0;
+#endif
+
+	return handle;
+}
+
 static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size, bool last_part,
 			   uint32_t *offset, uint8_t **output, size_t *output_size)
 {
 	int rc;
 	ELzmaStatus status;
 	size_t chunk_size = input_size;
+	struct lzma_state *state = state_get(inst);
 	CLzmaDec *decoder;
 	ELzmaFinishMode finish_mode = LZMA_FINISH_ANY;
 	SizeT dic_limit;
 	SizeT curr_dic_pos;
 
-	rc = check_inst(inst);
+	rc = check_inst(state);
 
 	if (rc) {
 		return rc;
@@ -518,69 +647,60 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 	*output = NULL;
 	*output_size = 0;
 
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-	decoder = &lzma_decoder.decoder;
-#else
-	decoder = &lzma_decoder;
-#endif
+	decoder = decoder_get(state);
 	curr_dic_pos = decoder->dicPos;
 
-	if (!allocated_probs) {
+	if (!state->allocated_probs) {
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		rc = Lzma2Dec_AllocateProbs(&lzma_decoder, input[0], &lzma_probs_allocator);
+		rc = Lzma2Dec_AllocateProbs(&state->decoder, input[0], &state->alloc);
 #else
-		rc = LzmaDec_AllocateProbs(&lzma_decoder, input, LZMA_PROPS_SIZE,
-					   &lzma_probs_allocator);
+		rc = LzmaDec_AllocateProbs(&state->decoder, input, LZMA_PROPS_SIZE,
+					   &state->alloc);
 #endif
 
 		if (rc) {
 			return -EINVAL;
 		}
 
-		decoder->dicHandle = LzmaDictionaryOpen(decoder->prop.dicSize);
+		decoder->dicHandle = LzmaDictionaryOpen(&state->dict_handle, decoder->prop.dicSize);
 
 		if (decoder->dicHandle == NULL) {
-			rc = -EINVAL;
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-			Lzma2Dec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
+			Lzma2Dec_FreeProbs(&state->decoder, &state->alloc);
 #else
-			LzmaDec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
+			LzmaDec_FreeProbs(&state->decoder, &state->alloc);
 #endif
 			return -EINVAL;
 		}
 
-		allocated_probs = true;
+		state->allocated_probs = true;
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
 		*offset = LZMA2_HEADER_SIZE;
+		Lzma2Dec_Init(&state->decoder);
 #else
 		/* Header and account for uncompressed size. */
 		*offset = LZMA_PROPS_SIZE + sizeof(uint64_t);
-#endif
-
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		Lzma2Dec_Init(&lzma_decoder);
-#else
-		LzmaDec_Init(&lzma_decoder);
+		LzmaDec_Init(&state->decoder);
 #endif
 
 		return 0;
 	}
 
-	if (decoder->dicHandle->dicBufSize - curr_dic_pos >= lzma_output_limit) {
+	if (decoder->dicHandle->dicBufSize - curr_dic_pos >= state->output_limit) {
 		/* Limit the output size because we are reaching
 		 * the limit of expected decompressed data size.
 		 */
 		finish_mode = LZMA_FINISH_END;
-		dic_limit = lzma_output_limit + curr_dic_pos;
+		dic_limit = state->output_limit + curr_dic_pos;
 	} else {
 		dic_limit = decoder->dicHandle->dicBufSize;
 	}
 
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-	rc = Lzma2Dec_DecodeToDic(&lzma_decoder, dic_limit,
+	rc = Lzma2Dec_DecodeToDic(&state->decoder, dic_limit,
 				  input, &chunk_size, finish_mode, &status);
 #else
-	rc = LzmaDec_DecodeToDic(&lzma_decoder, dic_limit,
+	rc = LzmaDec_DecodeToDic(&state->decoder, dic_limit,
 				 input, &chunk_size, finish_mode, &status);
 #endif
 	if (rc || chunk_size == 0) {
@@ -588,7 +708,7 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 	}
 
 	*offset = chunk_size;
-	lzma_output_limit -= (decoder->dicPos - curr_dic_pos);
+	state->output_limit -= (decoder->dicPos - curr_dic_pos);
 
 	if (last_part && status == LZMA_STATUS_FINISHED_WITH_MARK &&
 	    *offset < input_size) {
@@ -604,15 +724,15 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 		 */
 		if (status != LZMA_STATUS_MAYBE_FINISHED_WITHOUT_MARK
 		 && status != LZMA_STATUS_FINISHED_WITH_MARK
-		 && (status != LZMA_STATUS_NEEDS_MORE_INPUT && lzma_output_limit == 0)) {
+		 && (status != LZMA_STATUS_NEEDS_MORE_INPUT && state->output_limit == 0)) {
 			return -EINVAL;
 		}
 	}
 
 	if (decoder->dicPos >= decoder->dicHandle->dicBufSize || last_part) {
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
-		if (cache.invalid) {
-			rc = synchronize_cache(decoder->dicHandle);
+		if (state->cache.invalid) {
+			rc = synchronize_cache(state);
 		}
 #endif
 		*output_size = decoder->dicPos;
@@ -622,40 +742,12 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 	return rc;
 }
 
-DictHandle *LzmaDictionaryOpen(SizeT size)
-{
-	size_t dict_size;
-
-	if (dict_handle.isOpened) {
-		return &dict_handle;
-	}
-
-	if (ext_dict ==  NULL) {
-		return NULL;
-	}
-
-	if (ext_dict->open((size_t)size, &dict_size) != 0) {
-		LOG_ERR("Unable to open external dictionary with size %u", size);
-		return NULL;
-	}
-
-	dict_handle.isOpened = True;
-	dict_handle.dicBufSize = dict_size;
-
-#if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
-	cache.dict_pos_begin = 0;
-	cache.dict_pos_end = sizeof(cache.data) - 1;
-	cache.write_offset = 0;
-#endif
-
-	return &dict_handle;
-}
-
 SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT len)
 {
+	struct lzma_state *state = CONTAINER_OF(handle, struct lzma_state, dict_handle);
 	SizeT write_len = len;
 
-	if (handle != &dict_handle || ext_dict == NULL || pos > handle->dicBufSize) {
+	if (state->ext_dict == NULL || pos > handle->dicBufSize) {
 		return 0;
 	}
 
@@ -664,9 +756,10 @@ SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT
 	}
 
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+	dict_cache *cache = &state->cache;
 	SizeT bytes_written = 0;
 
-	if (pos > cache.dict_pos_end || pos < cache.dict_pos_begin) {
+	if (pos > cache->dict_pos_end || pos < cache->dict_pos_begin) {
 		/*
 		 * Should never happen, lzma operates on dicPos when writing to dictionary,
 		 * which should be aligned with cache.
@@ -676,19 +769,19 @@ SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT
 
 	while (bytes_written < write_len) {
 		SizeT cache_write_len =
-			(write_len - bytes_written) > (sizeof(cache.data) - cache.write_offset) ?
-				(sizeof(cache.data) - cache.write_offset) :
+			(write_len - bytes_written) > (sizeof(cache->data) - cache->write_offset) ?
+				(sizeof(cache->data) - cache->write_offset) :
 				(write_len - bytes_written);
 
-		memcpy(cache.data + cache.write_offset, data + bytes_written, cache_write_len);
-		cache.invalid = true;
+		memcpy(cache->data + cache->write_offset, data + bytes_written, cache_write_len);
+		cache->invalid = true;
 
 		bytes_written += cache_write_len;
-		cache.write_offset += cache_write_len;
+		cache->write_offset += cache_write_len;
 
-		if (cache.write_offset >= sizeof(cache.data)) {
+		if (cache->write_offset >= sizeof(cache->data)) {
 			/* Cache full, synchronize it. */
-			if (synchronize_cache(handle) != 0) {
+			if (synchronize_cache(state) != 0) {
 				bytes_written = 0;
 				break;
 			}
@@ -696,15 +789,17 @@ SizeT LzmaDictionaryWrite(DictHandle *handle, SizeT pos, const Byte *data, SizeT
 	}
 	return bytes_written;
 #else
-	return ext_dict->write(pos, data, write_len);
+	return state->ext_dict->write(pos, data, write_len);
 #endif
 }
 
 SizeT LzmaDictionaryRead(DictHandle *handle, SizeT pos, Byte *data, SizeT len)
 {
+	struct lzma_state *state = CONTAINER_OF(handle, struct lzma_state, dict_handle);
+	const lzma_dictionary_interface *ext_dict = state->ext_dict;
 	int read_len = len;
 
-	if (handle != &dict_handle || ext_dict == NULL || pos > handle->dicBufSize) {
+	if (ext_dict == NULL || pos > handle->dicBufSize) {
 		return 0;
 	}
 
@@ -713,29 +808,30 @@ SizeT LzmaDictionaryRead(DictHandle *handle, SizeT pos, Byte *data, SizeT len)
 	}
 
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+	const dict_cache *cache = &state->cache;
 	SizeT bytes_read = 0;
 
-	if (pos + read_len > cache.dict_pos_begin && pos <= cache.dict_pos_end) {
+	if (pos + read_len > cache->dict_pos_begin && pos <= cache->dict_pos_end) {
 		/* We have at least some of the requested data in the cache. */
 		SizeT cache_pos;
 		SizeT cache_copy_size;
 
-		if (pos < cache.dict_pos_begin) {
+		if (pos < cache->dict_pos_begin) {
 			/* First part of data is from dictionary... */
-			bytes_read = ext_dict->read(pos, data, cache.dict_pos_begin - pos);
-			if (bytes_read != cache.dict_pos_begin - pos) {
+			bytes_read = ext_dict->read(pos, data, cache->dict_pos_begin - pos);
+			if (bytes_read != cache->dict_pos_begin - pos) {
 				return bytes_read;
 			}
 
 			cache_pos = 0;
 		} else {
-			cache_pos = pos - cache.dict_pos_begin;
+			cache_pos = pos - cache->dict_pos_begin;
 		}
 
-		cache_copy_size = (pos + read_len > cache.dict_pos_end) ?
-				(sizeof(cache.data) - cache_pos)
+		cache_copy_size = (pos + read_len > cache->dict_pos_end) ?
+				(sizeof(cache->data) - cache_pos)
 				: (read_len - bytes_read);
-		memcpy(data + bytes_read, cache.data + cache_pos, cache_copy_size);
+		memcpy(data + bytes_read, cache->data + cache_pos, cache_copy_size);
 
 		bytes_read += cache_copy_size;
 
@@ -756,29 +852,30 @@ SizeT LzmaDictionaryRead(DictHandle *handle, SizeT pos, Byte *data, SizeT len)
 
 SRes LzmaDictionaryClose(DictHandle *handle)
 {
+	struct lzma_state *state = CONTAINER_OF(handle, struct lzma_state, dict_handle);
 	SRes rc = SZ_OK;
 
-	if (handle != &dict_handle || ext_dict == NULL) {
+	if (state->ext_dict == NULL) {
 		return SZ_ERROR_PARAM;
 	}
 
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
-	if (handle->isOpened && cache.invalid) {
-		if (synchronize_cache(handle) != 0) {
+	if (handle->isOpened && state->cache.invalid) {
+		if (synchronize_cache(state) != 0) {
 			rc = SZ_ERROR_MEM;
 		}
 	}
 
 	/* Clear the cache. */
-	memset(cache.data, 0, sizeof(cache.data));
+	memset(state->cache.data, 0, sizeof(state->cache.data));
 #endif
 
-	if (ext_dict->close() != 0) {
+	if (state->ext_dict->close() != 0) {
 		rc = SZ_ERROR_FAIL;
 		LOG_ERR("User external dictionary failed to close!");
 	}
 
-	dict_handle.isOpened = False;
+	handle->isOpened = False;
 
 	return rc;
 }
@@ -19,6 +19,21 @@ LOG_MODULE_REGISTER(nrf_rpc_uart, CONFIG_NRF_RPC_TR_LOG_LEVEL);
 
 #define CRC_SIZE sizeof(uint16_t)
 
+#if CONFIG_NRF_RPC_UART_WINDOW
+/* The sequence byte precedes the checksum field of a packet frame. */
+#define SEQ_SIZE sizeof(uint8_t)
+#define SEQ_MASK 0x7fu
+/* The receiver accepts a frame with the sync bit whatever its sequence number. */
+#define SEQ_SYNC 0x80u
+#define WINDOW_SIZE CONFIG_NRF_RPC_UART_WINDOW_SIZE
+#else
+#define SEQ_SIZE 0
+#endif
+
+#if CONFIG_NRF_RPC_UART_ASYNC
+#define ASYNC_RX_TIMEOUT_US 100
+#endif
+
 enum {
 	HDLC_CHAR_ESCAPE = 0x7d,
 	HDLC_CHAR_DELIMITER = 0x7e,
@@ -46,6 +61,23 @@ enum hdlc_state {
 	HDLC_STATE_ESCAPE,
 };
 
+enum rx_frame_status {
+	RX_FRAME_NEW,
+	RX_FRAME_DUPLICATE,
+	/* A frame before this one was lost, so it is dropped without an ack. */
+	RX_FRAME_OUT_OF_ORDER,
+};
+
+#if CONFIG_NRF_RPC_UART_WINDOW
+struct tx_frame {
+	const uint8_t *data;
+	size_t len;
+	/* Checksum field, sent back by the receiver in the ack */
+	uint16_t crc;
+	uint8_t seq;
+};
+#endif
+
 struct hdlc_decode_ctx {
 	enum hdlc_state state;
 	/* The number of bytes of the current packet that have been decoded so far. */
@@ -86,6 +118,45 @@ struct nrf_rpc_uart {
 
 	/* TX lock */
 	struct k_mutex tx_lock;
+
+#if CONFIG_NRF_RPC_UART_WINDOW
+	/* Frames waiting for ack. The indices are free running:
+	 * tx_free_idx <= tx_ack_idx <= tx_next_idx <= tx_free_idx + WINDOW_SIZE.
+	 * Frames from tx_free_idx to tx_ack_idx are acked, but their data is not freed yet.
+	 */
+	struct tx_frame tx_frames[WINDOW_SIZE];
+	uint32_t tx_free_idx;
+	uint32_t tx_ack_idx;
+	uint32_t tx_next_idx;
+	uint8_t tx_retx_count;
+	struct k_spinlock tx_window_lock;
+	struct k_sem tx_window_sem;
+	struct k_work_delayable retx_work;
+	/* Retransmissions unblock senders waiting for a window slot, so they have their own queue */
+	struct k_work_q retx_workq;
+
+	K_KERNEL_STACK_MEMBER(retx_workq_stack, CONFIG_NRF_RPC_UART_RETX_THREAD_STACK_SIZE);
+	uint8_t tx_seq;
+	bool tx_sync;
+	bool tx_failed;
+
+	/* Next expected sequence number */
+	uint8_t rx_seq;
+	bool rx_seq_any;
+	uint16_t rx_sync_crc;
+#endif
+
+#if CONFIG_NRF_RPC_UART_ASYNC
+	/* RX buffers filled by the UART, one is used while the other is processed */
+	uint8_t rx_dma_buf[2][CONFIG_NRF_RPC_UART_ASYNC_RX_BUF_SIZE];
+	uint8_t rx_dma_idx;
+
+	/* TX buffers, one is encoded while the other is sent */
+	uint8_t tx_dma_buf[2][CONFIG_NRF_RPC_UART_ASYNC_TX_BUF_SIZE];
+	uint8_t tx_dma_idx;
+	size_t tx_dma_len;
+	struct k_sem tx_dma_sem;
+#endif
 };
 
 static void log_hexdump_dbg(const uint8_t *data, size_t length, const char *fmt, ...)
@@ -102,7 +173,211 @@ static void log_hexdump_dbg(const uint8_t *data, size_t length, const char *fmt,
 	}
 }
 
-static void send_byte(const struct device *dev, uint8_t byte);
+#if CONFIG_NRF_RPC_UART_ASYNC
+/* Pass the filled TX buffer to the UART, once the other buffer has been sent. */
+static void tx_flush(struct nrf_rpc_uart *uart_tr)
+{
+	int ret;
+
+	if (uart_tr->tx_dma_len == 0) {
+		return;
+	}
+
+	k_sem_take(&uart_tr->tx_dma_sem, K_FOREVER);
+
+	ret = uart_tx(uart_tr->uart, uart_tr->tx_dma_buf[uart_tr->tx_dma_idx],
+		      uart_tr->tx_dma_len, SYS_FOREVER_US);
+	if (ret < 0) {
+		LOG_ERR("Failed to start UART TX: %d", ret);
+		k_sem_give(&uart_tr->tx_dma_sem);
+	}
+
+	uart_tr->tx_dma_idx ^= 1;
+	uart_tr->tx_dma_len = 0;
+}
+
+static void tx_raw(struct nrf_rpc_uart *uart_tr, uint8_t byte)
+{
+	uart_tr->tx_dma_buf[uart_tr->tx_dma_idx][uart_tr->tx_dma_len++] = byte;
+
+	if (uart_tr->tx_dma_len == CONFIG_NRF_RPC_UART_ASYNC_TX_BUF_SIZE) {
+		tx_flush(uart_tr);
+	}
+}
+#else
+static void tx_flush(struct nrf_rpc_uart *uart_tr)
+{
+	ARG_UNUSED(uart_tr);
+}
+
+static void tx_raw(struct nrf_rpc_uart *uart_tr, uint8_t byte)
+{
+	uart_poll_out(uart_tr->uart, byte);
+}
+#endif /* CONFIG_NRF_RPC_UART_ASYNC */
+
+static void tx_escaped(struct nrf_rpc_uart *uart_tr, uint8_t byte)
+{
+	if (byte == HDLC_CHAR_DELIMITER || byte == HDLC_CHAR_ESCAPE) {
+		tx_raw(uart_tr, HDLC_CHAR_ESCAPE);
+		byte ^= 0x20;
+	}
+
+	tx_raw(uart_tr, byte);
+}
+
+/* Send the data followed by the tail, that is the sequence byte and the checksum field. */
+static void frame_tx(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t length,
+		     const uint8_t *tail, size_t tail_length)
+{
+	tx_raw(uart_tr, HDLC_CHAR_DELIMITER);
+
+	for (size_t i = 0; i < length; i++) {
+		tx_escaped(uart_tr, data[i]);
+	}
+
+	for (size_t i = 0; i < tail_length; i++) {
+		tx_escaped(uart_tr, tail[i]);
+	}
+
+	tx_raw(uart_tr, HDLC_CHAR_DELIMITER);
+	tx_flush(uart_tr);
+}
+
+#if CONFIG_NRF_RPC_UART_WINDOW
+static void window_ack_rx(struct nrf_rpc_uart *uart_tr, uint16_t rx_ack)
+{
+	k_spinlock_key_t key = k_spin_lock(&uart_tr->tx_window_lock);
+	uint32_t idx;
+	uint32_t released;
+	bool pending;
+
+	for (idx = uart_tr->tx_ack_idx; idx != uart_tr->tx_next_idx; idx++) {
+		if (uart_tr->tx_frames[idx % WINDOW_SIZE].crc == rx_ack) {
+			break;
+		}
+	}
+
+	if (idx == uart_tr->tx_next_idx) {
+		k_spin_unlock(&uart_tr->tx_window_lock, key);
+		/* Acks of retransmitted frames may come more than once */
+		LOG_DBG("Received ack %04x but no frame is waiting for it", rx_ack);
+		return;
+	}
+
+	/* The receiver acks frames in order, so all the frames before are received too */
+	released = idx + 1 - uart_tr->tx_ack_idx;
+	uart_tr->tx_ack_idx = idx + 1;
+	uart_tr->tx_retx_count = 0;
+	pending = uart_tr->tx_ack_idx != uart_tr->tx_next_idx;
+
+	k_spin_unlock(&uart_tr->tx_window_lock, key);
+
+	while (released--) {
+		k_sem_give(&uart_tr->tx_window_sem);
+	}
+
+	if (pending) {
+		k_work_reschedule_for_queue(&uart_tr->retx_workq, &uart_tr->retx_work,
+					    K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
+	} else {
+		k_work_cancel_delayable(&uart_tr->retx_work);
+	}
+}
+
+static void window_frame_crc_set(struct tx_frame *frame)
+{
+	uint16_t crc_val = crc16_ccitt(0xffff, frame->data, frame->len);
+
+	frame->crc = crc16_ccitt(crc_val, &frame->seq, SEQ_SIZE);
+}
+
+static void window_frame_tx(struct nrf_rpc_uart *uart_tr, const struct tx_frame *frame)
+{
+	uint8_t tail[SEQ_SIZE + CRC_SIZE];
+
+	tail[0] = frame->seq;
+	sys_put_le16(frame->crc, &tail[SEQ_SIZE]);
+
+	k_mutex_lock(&uart_tr->ack_tx_lock, K_FOREVER);
+	frame_tx(uart_tr, frame->data, frame->len, tail, sizeof(tail));
+	k_mutex_unlock(&uart_tr->ack_tx_lock);
+}
+
+/* Free the data of the acked frames. Must be called with the TX lock held. */
+static void window_free_acked(struct nrf_rpc_uart *uart_tr)
+{
+	k_spinlock_key_t key = k_spin_lock(&uart_tr->tx_window_lock);
+	uint32_t ack_idx = uart_tr->tx_ack_idx;
+
+	k_spin_unlock(&uart_tr->tx_window_lock, key);
+
+	while (uart_tr->tx_free_idx != ack_idx) {
+		k_free((void *)uart_tr->tx_frames[uart_tr->tx_free_idx % WINDOW_SIZE].data);
+		uart_tr->tx_free_idx++;
+	}
+}
+
+/* No ack came for the oldest frame in time, so send it and all the following frames again.
+ * After the last attempt the frame is dropped, and the next frame gets the sync bit so that
+ * the receiver does not wait for the dropped one.
+ */
+static void retx_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct nrf_rpc_uart *uart_tr = CONTAINER_OF(dwork, struct nrf_rpc_uart, retx_work);
+	struct tx_frame *frame;
+	k_spinlock_key_t key;
+	uint32_t idx;
+	uint32_t next_idx;
+	bool give_up;
+
+	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
+
+	key = k_spin_lock(&uart_tr->tx_window_lock);
+
+	give_up = uart_tr->tx_ack_idx != uart_tr->tx_next_idx &&
+		  ++uart_tr->tx_retx_count >= CONFIG_NRF_RPC_UART_TX_ATTEMPTS;
+
+	if (give_up) {
+		uart_tr->tx_retx_count = 0;
+		uart_tr->tx_ack_idx++;
+
+		if (uart_tr->tx_ack_idx != uart_tr->tx_next_idx) {
+			frame = &uart_tr->tx_frames[uart_tr->tx_ack_idx % WINDOW_SIZE];
+			frame->seq |= SEQ_SYNC;
+			window_frame_crc_set(frame);
+		} else {
+			uart_tr->tx_sync = true;
+		}
+	}
+
+	idx = uart_tr->tx_ack_idx;
+	next_idx = uart_tr->tx_next_idx;
+
+	k_spin_unlock(&uart_tr->tx_window_lock, key);
+
+	if (give_up) {
+		LOG_ERR("Frame not acked after %d attempts", CONFIG_NRF_RPC_UART_TX_ATTEMPTS);
+		uart_tr->tx_failed = true;
+		k_sem_give(&uart_tr->tx_window_sem);
+		window_free_acked(uart_tr);
+	}
+
+	if (idx != next_idx) {
+		LOG_WRN("Ack timeout, sending %u frames again", next_idx - idx);
+
+		for (; idx != next_idx; idx++) {
+			window_frame_tx(uart_tr, &uart_tr->tx_frames[idx % WINDOW_SIZE]);
+		}
+
+		k_work_reschedule_for_queue(&uart_tr->retx_workq, dwork,
+					    K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
+	}
+
+	k_mutex_unlock(&uart_tr->tx_lock);
+}
+#endif /* CONFIG_NRF_RPC_UART_WINDOW */
 
 static void ack_rx(struct nrf_rpc_uart *uart_tr)
 {
@@ -115,12 +390,16 @@ static void ack_rx(struct nrf_rpc_uart *uart_tr)
 
 	LOG_DBG(">>> RX ack %04x", rx_ack);
 
+#if CONFIG_NRF_RPC_UART_WINDOW
+	window_ack_rx(uart_tr, rx_ack);
+#else
 	if (uart_tr->ack_payload != rx_ack) {
 		LOG_WRN("Received ack %04x but expected %04x", rx_ack, uart_tr->ack_payload);
 		return;
 	}
 
 	k_sem_give(&uart_tr->ack_sem);
+#endif
 }
 
 static void ack_tx(struct nrf_rpc_uart *uart_tr, uint16_t ack_pld)
@@ -135,16 +414,12 @@ static void ack_tx(struct nrf_rpc_uart *uart_tr, uint16_t ack_pld)
 	k_mutex_lock(&uart_tr->ack_tx_lock, K_FOREVER);
 	LOG_DBG("<<< TX ack %04x", ack_pld);
 
-	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
-
-	send_byte(uart_tr->uart, ack[0]);
-	send_byte(uart_tr->uart, ack[1]);
-
-	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+	frame_tx(uart_tr, ack, sizeof(ack), NULL, 0);
 
 	k_mutex_unlock(&uart_tr->ack_tx_lock);
 }
 
+#if !CONFIG_NRF_RPC_UART_WINDOW
 static uint16_t tx_flip(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
 {
 	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
@@ -180,10 +455,61 @@ static bool rx_flip_check(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
 
 	return true;
 }
+#endif /* !CONFIG_NRF_RPC_UART_WINDOW */
+
+#if CONFIG_NRF_RPC_UART_WINDOW
+static enum rx_frame_status rx_window_check(struct nrf_rpc_uart *uart_tr, uint8_t seq,
+					    uint16_t crc_val)
+{
+	uint8_t behind;
+
+	if (seq & SEQ_SYNC) {
+		/* A retransmitted sync frame */
+		if (!uart_tr->rx_seq_any && uart_tr->rx_sync_crc == crc_val) {
+			return RX_FRAME_DUPLICATE;
+		}
+
+		uart_tr->rx_sync_crc = crc_val;
+		uart_tr->rx_seq_any = true;
+	}
+
+	seq &= SEQ_MASK;
+
+	if (uart_tr->rx_seq_any) {
+		uart_tr->rx_seq_any = false;
+		uart_tr->rx_seq = (seq + 1) & SEQ_MASK;
+		return RX_FRAME_NEW;
+	}
+
+	behind = (uart_tr->rx_seq - seq) & SEQ_MASK;
+
+	if (behind == 0) {
+		uart_tr->rx_seq = (seq + 1) & SEQ_MASK;
+		return RX_FRAME_NEW;
+	}
+
+	return behind <= WINDOW_SIZE ? RX_FRAME_DUPLICATE : RX_FRAME_OUT_OF_ORDER;
+}
+#endif /* CONFIG_NRF_RPC_UART_WINDOW */
+
+/* Check the received frame against the previous ones. The sequence byte is removed from the
+ * frame, if any.
+ */
+static enum rx_frame_status rx_frame_check(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
+{
+#if CONFIG_NRF_RPC_UART_WINDOW
+	uart_tr->rx_pkt_ctx.len -= SEQ_SIZE;
+
+	return rx_window_check(uart_tr, uart_tr->rx_pkt[uart_tr->rx_pkt_ctx.len], crc_val);
+#else
+	return rx_flip_check(uart_tr, crc_val) ? RX_FRAME_DUPLICATE : RX_FRAME_NEW;
+#endif
+}
 
 static bool crc_compare(uint16_t rx_crc, uint16_t calc_crc)
 {
-	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
+	/* In the sliding window mode, the checksum covers the sequence byte instead */
+	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE) && !IS_ENABLED(CONFIG_NRF_RPC_UART_WINDOW)) {
 		return (rx_crc & 0x7fffu) == (calc_crc & 0x7fffu);
 	}
 
@@ -237,6 +563,7 @@ static void work_handler(struct k_work *work)
 	int ret;
 	uint16_t crc_received = 0;
 	uint16_t crc_calculated = 0;
+	enum rx_frame_status status;
 
 	while (!ring_buf_is_empty(&uart_tr->rx_ringbuf)) {
 		len = ring_buf_get_claim(&uart_tr->rx_ringbuf, &data,
@@ -249,7 +576,7 @@ static void work_handler(struct k_work *work)
 			}
 
 			/* ACKs are already handled in ISR, so process only normal packets here */
-			if (uart_tr->rx_pkt_ctx.len <= CRC_SIZE) {
+			if (uart_tr->rx_pkt_ctx.len <= CRC_SIZE + SEQ_SIZE) {
 				continue;
 			}
 
@@ -267,9 +594,15 @@ static void work_handler(struct k_work *work)
 				continue;
 			}
 
+			status = rx_frame_check(uart_tr, crc_received);
+			if (status == RX_FRAME_OUT_OF_ORDER) {
+				LOG_DBG("Out of order packet %04x", crc_received);
+				continue;
+			}
+
 			ack_tx(uart_tr, crc_received);
 
-			if (rx_flip_check(uart_tr, crc_received)) {
+			if (status == RX_FRAME_DUPLICATE) {
 				LOG_WRN("Duplicate packet %04x", crc_received);
 			} else {
 				uart_tr->receive_callback(uart_tr->transport, uart_tr->rx_pkt,
@@ -296,6 +629,62 @@ static void decode_ack(struct nrf_rpc_uart *inst, const uint8_t *in, size_t len)
 	}
 }
 
+#if CONFIG_NRF_RPC_UART_ASYNC
+static void async_rx_enable(struct nrf_rpc_uart *uart_tr)
+{
+	int ret;
+
+	uart_tr->rx_dma_idx = 0;
+
+	ret = uart_rx_enable(uart_tr->uart, uart_tr->rx_dma_buf[0], sizeof(uart_tr->rx_dma_buf[0]),
+			     ASYNC_RX_TIMEOUT_US);
+	if (ret < 0) {
+		LOG_ERR("Failed to enable UART RX: %d", ret);
+	}
+}
+
+static void async_rx_put(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t len)
+{
+	uint32_t put;
+
+	decode_ack(uart_tr, data, len);
+
+	put = ring_buf_put(&uart_tr->rx_ringbuf, data, len);
+	if (put < len) {
+		LOG_WRN("RX ring buffer full");
+	}
+
+	if (put > 0) {
+		k_work_submit_to_queue(&uart_tr->rx_workq, &uart_tr->rx_work);
+	}
+}
+
+static void async_cb(const struct device *uart, struct uart_event *evt, void *user_data)
+{
+	struct nrf_rpc_uart *uart_tr = user_data;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		k_sem_give(&uart_tr->tx_dma_sem);
+		break;
+	case UART_RX_RDY:
+		async_rx_put(uart_tr, evt->data.rx.buf + evt->data.rx.offset, evt->data.rx.len);
+		break;
+	case UART_RX_BUF_REQUEST:
+		uart_tr->rx_dma_idx ^= 1;
+		(void)uart_rx_buf_rsp(uart, uart_tr->rx_dma_buf[uart_tr->rx_dma_idx],
+				      sizeof(uart_tr->rx_dma_buf[0]));
+		break;
+	case UART_RX_DISABLED:
+		/* Receiving is stopped after an error, start it again */
+		async_rx_enable(uart_tr);
+		break;
+	default:
+		break;
+	}
+}
+#else
 static void serial_cb(const struct device *uart, void *user_data)
 {
 	struct nrf_rpc_uart *uart_tr = user_data;
@@ -331,6 +720,7 @@ static void serial_cb(const struct device *uart, void *user_data)
 		k_work_submit_to_queue(&uart_tr->rx_workq, &uart_tr->rx_work);
 	}
 }
+#endif /* CONFIG_NRF_RPC_UART_ASYNC */
 
 static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t receive_cb,
 		void *context)
@@ -357,6 +747,16 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 		return -NRF_ENOENT;
 	}
 
+#if CONFIG_NRF_RPC_UART_ASYNC
+	int ret = uart_callback_set(uart_tr->uart, async_cb, uart_tr);
+
+	if (ret < 0) {
+		LOG_ERR("Error setting UART async callback: %d", ret);
+		return 0;
+	}
+
+	k_sem_init(&uart_tr->tx_dma_sem, 1, 1);
+#else
 	/* configure interrupt and callback to receive data */
 	int ret = uart_irq_callback_user_data_set(uart_tr->uart, serial_cb, uart_tr);
 
@@ -370,6 +770,7 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 		}
 		return 0;
 	}
+#endif /* CONFIG_NRF_RPC_UART_ASYNC */
 
 	k_mutex_init(&uart_tr->tx_lock);
 
@@ -380,6 +781,20 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 		uart_tr->flips.rx_flip_any = 1;
 	}
 
+#if CONFIG_NRF_RPC_UART_WINDOW
+	k_sem_init(&uart_tr->tx_window_sem, 0, WINDOW_SIZE);
+	k_work_init_delayable(&uart_tr->retx_work, retx_work_handler);
+	uart_tr->tx_sync = true;
+	uart_tr->rx_seq_any = true;
+
+	const struct k_work_queue_config retx_workq_cfg = {.name = "rpc uart retx"};
+
+	k_work_queue_init(&uart_tr->retx_workq);
+	k_work_queue_start(&uart_tr->retx_workq, uart_tr->retx_workq_stack,
+			   K_THREAD_STACK_SIZEOF(uart_tr->retx_workq_stack), K_PRIO_PREEMPT(0),
+			   &retx_workq_cfg);
+#endif
+
 	k_work_queue_init(&uart_tr->rx_workq);
 	k_work_queue_start(&uart_tr->rx_workq, uart_tr->rx_workq_stack,
 			   K_THREAD_STACK_SIZEOF(uart_tr->rx_workq_stack), K_PRIO_PREEMPT(0),
@@ -392,22 +807,67 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 	uart_tr->rx_pkt_ctx.capacity = sizeof(uart_tr->rx_pkt);
 	uart_tr->rx_ack_ctx.state = HDLC_STATE_UNSYNC;
 	uart_tr->rx_ack_ctx.capacity = sizeof(uart_tr->rx_ack);
+#if CONFIG_NRF_RPC_UART_ASYNC
+	async_rx_enable(uart_tr);
+#else
 	uart_irq_rx_enable(uart_tr->uart);
+#endif
 	nrf_rpc_uart_initialized_hook(uart_tr->uart);
 
 	return 0;
 }
 
-static void send_byte(const struct device *dev, uint8_t byte)
+#if CONFIG_NRF_RPC_UART_WINDOW
+/* The frame is kept until it is acked, and the next frames are sent without waiting for the
+ * ack. Failure to deliver a frame is reported by the following call.
+ */
+static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
 {
-	if (byte == HDLC_CHAR_DELIMITER || byte == HDLC_CHAR_ESCAPE) {
-		uart_poll_out(dev, HDLC_CHAR_ESCAPE);
-		byte ^= 0x20;
+	struct nrf_rpc_uart *uart_tr = transport->ctx;
+	struct tx_frame *frame;
+	k_spinlock_key_t key;
+	int ret;
+
+	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
+
+	window_free_acked(uart_tr);
+
+	while (uart_tr->tx_next_idx - uart_tr->tx_free_idx >= WINDOW_SIZE) {
+		k_mutex_unlock(&uart_tr->tx_lock);
+		k_sem_take(&uart_tr->tx_window_sem, K_FOREVER);
+		k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
+		window_free_acked(uart_tr);
 	}
 
-	uart_poll_out(dev, byte);
-}
+	frame = &uart_tr->tx_frames[uart_tr->tx_next_idx % WINDOW_SIZE];
+	frame->data = data;
+	frame->len = length;
+	frame->seq = uart_tr->tx_seq | (uart_tr->tx_sync ? SEQ_SYNC : 0);
+	window_frame_crc_set(frame);
+
+	uart_tr->tx_seq = (uart_tr->tx_seq + 1) & SEQ_MASK;
+	uart_tr->tx_sync = false;
+
+	key = k_spin_lock(&uart_tr->tx_window_lock);
+	uart_tr->tx_next_idx++;
+	k_spin_unlock(&uart_tr->tx_window_lock, key);
 
+	log_hexdump_dbg(data, length, "<<< TX packet %02x %04x", frame->seq, frame->crc);
+
+	window_frame_tx(uart_tr, frame);
+
+	/* Keeps the timeout of the older frames if they are still waiting for ack */
+	k_work_schedule_for_queue(&uart_tr->retx_workq, &uart_tr->retx_work,
+				  K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
+
+	ret = uart_tr->tx_failed ? -EPROTO : 0;
+	uart_tr->tx_failed = false;
+
+	k_mutex_unlock(&uart_tr->tx_lock);
+
+	return ret;
+}
+#else
 static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
 {
 	uint8_t crc[2];
@@ -433,17 +893,8 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 		k_sem_reset(&uart_tr->ack_sem);
 #endif /* CONFIG_NRF_RPC_UART_RELIABLE */
 
-		uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
-
-		for (size_t i = 0; i < length; i++) {
-			send_byte(uart_tr->uart, data[i]);
-		}
-
 		sys_put_le16(crc_val, crc);
-		send_byte(uart_tr->uart, crc[0]);
-		send_byte(uart_tr->uart, crc[1]);
-
-		uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+		frame_tx(uart_tr, data, length, crc, sizeof(crc));
 
 #if CONFIG_NRF_RPC_UART_RELIABLE
 		k_mutex_unlock(&uart_tr->ack_tx_lock);
@@ -463,6 +914,7 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 
 	return acked ? 0 : -EPROTO;
 }
+#endif /* CONFIG_NRF_RPC_UART_WINDOW */
 
 static void *tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
 {
@@ -515,3 +967,5 @@ const struct nrf_rpc_tr_api nrf_rpc_uart_service_api = {
 	};
 
 DT_FOREACH_STATUS_OKAY(nordic_nrf_uarte, NRF_RPC_UART_TRANSPORT_DEFINE);
+/* Emulated UARTs allow testing the transport on native_sim */
+DT_FOREACH_STATUS_OKAY(zephyr_uart_emul, NRF_RPC_UART_TRANSPORT_DEFINE);
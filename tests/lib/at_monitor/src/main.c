@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <nrf_modem_at.h>
+#include <modem/at_monitor.h>
+
+/* Implemented by the AT monitor library, called to fake incoming notifications */
+extern void at_monitor_dispatch(const char *notif);
+
+enum mon_id {
+	MON_CEREG,
+	MON_CEREG_2,
+	MON_CE,
+	MON_REG,
+	MON_CSCON,
+	MON_ANY,
+	MON_PAUSED,
+	MON_ISR,
+	MON_ISR_ANY,
+	MON_COUNT,
+};
+
+static int calls[MON_COUNT];
+static char last_notif[MON_COUNT][64];
+
+static void record(enum mon_id id, const char *notif)
+{
+	calls[id]++;
+	strncpy(last_notif[id], notif, sizeof(last_notif[id]) - 1);
+}
+
+/* Filters which are prefixes, suffixes and duplicates of each other */
+AT_MONITOR(mon_cereg, "+CEREG", cereg_handler);
+AT_MONITOR(mon_cereg_2, "+CEREG", cereg_2_handler);
+AT_MONITOR(mon_ce, "+CE", ce_handler);
+AT_MONITOR(mon_reg, "REG", reg_handler);
+AT_MONITOR(mon_cscon, "+CSCON", cscon_handler);
+AT_MONITOR(mon_any, ANY, any_handler);
+AT_MONITOR(mon_paused, "+CEREG", paused_handler, PAUSED);
+AT_MONITOR_ISR(mon_isr, "%XSIM", isr_handler);
+AT_MONITOR_ISR(mon_isr_any, ANY, isr_any_handler);
+
+static void cereg_handler(const char *notif)
+{
+	record(MON_CEREG, notif);
+}
+
+static void cereg_2_handler(const char *notif)
+{
+	record(MON_CEREG_2, notif);
+}
+
+static void ce_handler(const char *notif)
+{
+	record(MON_CE, notif);
+}
+
+static void reg_handler(const char *notif)
+{
+	record(MON_REG, notif);
+}
+
+static void cscon_handler(const char *notif)
+{
+	record(MON_CSCON, notif);
+}
+
+static void any_handler(const char *notif)
+{
+	record(MON_ANY, notif);
+}
+
+static void paused_handler(const char *notif)
+{
+	record(MON_PAUSED, notif);
+}
+
+static void isr_handler(const char *notif)
+{
+	record(MON_ISR, notif);
+}
+
+static void isr_any_handler(const char *notif)
+{
+	record(MON_ISR_ANY, notif);
+}
+
+/* The modem library is not linked */
+int nrf_modem_at_notif_handler_set(nrf_modem_at_notif_handler_t callback)
+{
+	return 0;
+}
+
+/* Dispatch a notification and let the system workqueue dispatch it to the monitors */
+static void notif_dispatch(const char *notif)
+{
+	at_monitor_dispatch(notif);
+	k_sleep(K_MSEC(10));
+}
+
+static void assert_calls(const int expected[MON_COUNT])
+{
+	for (int i = 0; i < MON_COUNT; i++) {
+		zassert_equal(calls[i], expected[i], "monitor %d called %d times, expected %d", i,
+			      calls[i], expected[i]);
+	}
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(calls, 0, sizeof(calls));
+	memset(last_notif, 0, sizeof(last_notif));
+
+	at_monitor_resume(&mon_any);
+	at_monitor_pause(&mon_paused);
+}
+
+ZTEST(at_monitor, test_prefix_filters)
+{
+	const int expected[MON_COUNT] = {
+		[MON_CEREG] = 1,
+		[MON_CEREG_2] = 1,
+		[MON_CE] = 1,
+		[MON_REG] = 1,
+		[MON_ANY] = 1,
+		[MON_ISR_ANY] = 1,
+	};
+
+	notif_dispatch("+CEREG: 1\r\n");
+
+	assert_calls(expected);
+	zassert_str_equal(last_notif[MON_CEREG], "+CEREG: 1\r\n");
+	zassert_str_equal(last_notif[MON_REG], "+CEREG: 1\r\n");
+}
+
+ZTEST(at_monitor, test_filter_after_partial_match)
+{
+	const int expected[MON_COUNT] = {
+		[MON_CSCON] = 1,
+		[MON_ANY] = 1,
+		[MON_ISR_ANY] = 1,
+	};
+
+	/* "+C" starts a filter, but the filter only matches after it */
+	notif_dispatch("+C+CSCON: 1\r\n");
+
+	assert_calls(expected);
+}
+
+ZTEST(at_monitor, test_no_match)
+{
+	const int expected[MON_COUNT] = {
+		[MON_ANY] = 2,
+		[MON_ISR_ANY] = 2,
+	};
+
+	notif_dispatch("+CGEV: ME PDN ACT 0\r\n");
+	/* Shorter than all filters it is a prefix of */
+	notif_dispatch("+CERE");
+
+	assert_calls(expected);
+}
+
+ZTEST(at_monitor, test_isr_monitors)
+{
+	const int expected[MON_COUNT] = {
+		[MON_ANY] = 1,
+		[MON_ISR] = 1,
+		[MON_ISR_ANY] = 1,
+	};
+
+	/* Monitors receiving notifications in the ISR do so before the dispatch returns */
+	at_monitor_dispatch("%XSIM: 1\r\n");
+	zassert_equal(calls[MON_ISR], 1);
+	zassert_equal(calls[MON_ISR_ANY], 1);
+
+	k_sleep(K_MSEC(10));
+
+	/* and are not called again from the system workqueue */
+	assert_calls(expected);
+}
+
+ZTEST(at_monitor, test_wildcard_paused)
+{
+	const int expected[MON_COUNT] = {
+		[MON_CSCON] = 1,
+		[MON_ISR_ANY] = 1,
+	};
+
+	at_monitor_pause(&mon_any);
+
+	notif_dispatch("+CSCON: 0\r\n");
+
+	assert_calls(expected);
+
+	at_monitor_resume(&mon_any);
+
+	notif_dispatch("+CSCON: 1\r\n");
+
+	zassert_equal(calls[MON_ANY], 1);
+	zassert_str_equal(last_notif[MON_ANY], "+CSCON: 1\r\n");
+}
+
+ZTEST(at_monitor, test_paused_resumed)
+{
+	notif_dispatch("+CEREG: 2\r\n");
+	zassert_equal(calls[MON_PAUSED], 0);
+
+	at_monitor_resume(&mon_paused);
+
+	notif_dispatch("+CEREG: 5\r\n");
+	zassert_equal(calls[MON_PAUSED], 1);
+	zassert_equal(calls[MON_CEREG], 2);
+	zassert_str_equal(last_notif[MON_PAUSED], "+CEREG: 5\r\n");
+}
+
+ZTEST(at_monitor, test_queued_notifications)
+{
+	/* Both notifications are queued before the system workqueue runs */
+	k_sched_lock();
+	at_monitor_dispatch("+CSCON: 1\r\n");
+	at_monitor_dispatch("+CEREG: 1\r\n");
+	k_sched_unlock();
+
+	k_sleep(K_MSEC(10));
+
+	/* Each notification is dispatched to the monitors it matched */
+	zassert_equal(calls[MON_CSCON], 1);
+	zassert_str_equal(last_notif[MON_CSCON], "+CSCON: 1\r\n");
+	zassert_equal(calls[MON_CEREG], 1);
+	zassert_str_equal(last_notif[MON_CEREG], "+CEREG: 1\r\n");
+	zassert_equal(calls[MON_ANY], 2);
+	zassert_str_equal(last_notif[MON_ANY], "+CEREG: 1\r\n");
+}
+
+ZTEST_SUITE(at_monitor, NULL, NULL, before, NULL, NULL);
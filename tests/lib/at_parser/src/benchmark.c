@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <modem/at_parser.h>
+
+/* Number of measured cells in the %NCELLMEAS notification. */
+#define NCELLMEAS_NEIGHBORS 17
+/* Number of parameters per neighbor cell: EARFCN, PCI, RSRP, RSRQ and time difference. */
+#define NCELLMEAS_NEIGHBOR_PARAMS 5
+/* Index of the first neighbor cell parameter. */
+#define NCELLMEAS_NEIGHBOR_FIRST 11
+/* Number of values in the %NCELLMEAS notification, including the prefix. */
+#define NCELLMEAS_PARAMS \
+	(NCELLMEAS_NEIGHBOR_FIRST + NCELLMEAS_NEIGHBORS * NCELLMEAS_NEIGHBOR_PARAMS + 1)
+/* Number of times each notification is parsed. */
+#define ITERATIONS 20
+
+static char ncellmeas[1024];
+
+static const char xmonitor[] =
+	"%XMONITOR: 1,\"EDAV\",\"EDAV\",\"26295\",\"00B7\",7,20,\"00011B07\",7,2300,63,39,\"\","
+	"\"11100000\",\"11100000\",\"01001001\"\r\n";
+
+static void ncellmeas_build(void)
+{
+	int len;
+
+	len = snprintf(ncellmeas, sizeof(ncellmeas),
+		       "%%NCELLMEAS: 0,\"0199F10A\",\"24201\",\"0D4A\",65535,5300,21,50,-14,"
+		       "123456");
+
+	for (int i = 0; i < NCELLMEAS_NEIGHBORS; i++) {
+		len += snprintf(ncellmeas + len, sizeof(ncellmeas) - len, ",%d,%d,%d,%d,%d",
+				6400 + i, 100 + i, 30 + i, -(i % 20), 10 * i);
+	}
+
+	snprintf(ncellmeas + len, sizeof(ncellmeas) - len, ",%d\r\n", 42);
+}
+
+/* Access the neighbor cells in the order used by lte_lc: the time difference of each
+ * neighbor cell is checked before its other parameters.
+ */
+static void ncellmeas_parse(struct at_parser *parser)
+{
+	int ret;
+	int32_t num;
+
+	for (int i = 0; i < NCELLMEAS_NEIGHBORS; i++) {
+		size_t base = NCELLMEAS_NEIGHBOR_FIRST + i * NCELLMEAS_NEIGHBOR_PARAMS;
+
+		ret = at_parser_num_get(parser, base + 4, &num);
+		zassert_ok(ret);
+		zassert_equal(num, 10 * i);
+
+		for (int j = 0; j < NCELLMEAS_NEIGHBOR_PARAMS - 1; j++) {
+			ret = at_parser_num_get(parser, base + j, &num);
+			zassert_ok(ret);
+		}
+	}
+
+	ret = at_parser_num_get(parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 0);
+}
+
+static void xmonitor_parse(struct at_parser *parser)
+{
+	int ret;
+	int16_t num;
+	size_t len;
+	char buf[16];
+
+	for (size_t i = 16; i > 0; i--) {
+		len = sizeof(buf);
+
+		ret = at_parser_num_get(parser, i, &num);
+		if (ret == -EOPNOTSUPP) {
+			ret = at_parser_string_get(parser, i, buf, &len);
+		}
+		zassert_true(ret == 0 || ret == -ENODATA);
+	}
+}
+
+static uint32_t cycles_per_notif(const char *notif, struct at_parser_token *tokens,
+				 size_t tokens_size, void (*parse)(struct at_parser *parser))
+{
+	int ret;
+	struct at_parser parser;
+	uint32_t start;
+	uint32_t cycles;
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		if (tokens) {
+			ret = at_parser_init_indexed(&parser, notif, tokens, tokens_size);
+		} else {
+			ret = at_parser_init(&parser, notif);
+		}
+		zassert_ok(ret);
+
+		parse(&parser);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	return cycles / ITERATIONS;
+}
+
+ZTEST(at_parser_benchmark, test_at_parser_benchmark_ncellmeas)
+{
+	struct at_parser_token tokens[NCELLMEAS_PARAMS];
+	uint32_t linear;
+	uint32_t indexed;
+
+	ncellmeas_build();
+
+	linear = cycles_per_notif(ncellmeas, NULL, 0, ncellmeas_parse);
+	indexed = cycles_per_notif(ncellmeas, tokens, ARRAY_SIZE(tokens), ncellmeas_parse);
+
+	TC_PRINT("%%NCELLMEAS (%d neighbors): %u cycles linear, %u cycles indexed\n",
+		 NCELLMEAS_NEIGHBORS, linear, indexed);
+}
+
+ZTEST(at_parser_benchmark, test_at_parser_benchmark_xmonitor)
+{
+	struct at_parser_token tokens[17];
+	uint32_t linear;
+	uint32_t indexed;
+
+	linear = cycles_per_notif(xmonitor, NULL, 0, xmonitor_parse);
+	indexed = cycles_per_notif(xmonitor, tokens, ARRAY_SIZE(tokens), xmonitor_parse);
+
+	TC_PRINT("%%XMONITOR: %u cycles linear, %u cycles indexed\n", linear, indexed);
+}
+
+ZTEST_SUITE(at_parser_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -2190,4 +2190,181 @@ ZTEST(at_parser, test_at_parser_cmd_next)
 	zassert_equal(num, 6);
 }
 
+ZTEST(at_parser, test_at_parser_rewind_empty_subparam)
+{
+	int ret;
+	struct at_parser parser;
+	int32_t num = 0;
+
+	const char *str1 = "+CPSMS: 1,2,\r\n";
+
+	ret = at_parser_init(&parser, str1);
+	zassert_ok(ret);
+
+	/* Leaves the parser right before the trailing empty subparameter. */
+	ret = at_parser_num_get(&parser, 2, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 2);
+
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 1);
+}
+
+ZTEST(at_parser, test_at_parser_init_indexed_einval)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[4];
+
+	const char *str1 = "+NOTIF: 1,2,3\r\nOK\r\n";
+
+	ret = at_parser_init_indexed(NULL, str1, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_init_indexed(&parser, NULL, tokens, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_init_indexed(&parser, str1, NULL, ARRAY_SIZE(tokens));
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_init_indexed(&parser, str1, tokens, 0);
+	zassert_equal(ret, -EINVAL);
+}
+
+ZTEST(at_parser, test_at_parser_indexed_random_access)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[8];
+	int32_t num = 0;
+	size_t count = 0;
+	size_t len;
+	char buffer[32];
+
+	ret = at_parser_init_indexed(&parser, certificate, tokens, ARRAY_SIZE(tokens));
+	zassert_ok(ret);
+
+	len = sizeof(buffer);
+	ret = at_parser_string_get(&parser, 3, buffer, &len);
+	zassert_ok(ret);
+	zassert_str_equal(buffer, "978C...02C4");
+
+	ret = at_parser_num_get(&parser, 2, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 0);
+
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 12345678);
+
+	len = sizeof(buffer);
+	ret = at_parser_string_get(&parser, 0, buffer, &len);
+	zassert_ok(ret);
+	zassert_str_equal(buffer, "%CMNG");
+
+	ret = at_parser_num_get(&parser, 5, &num);
+	zassert_equal(ret, -EIO);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_ok(ret);
+	zassert_equal(count, 5);
+}
+
+ZTEST(at_parser, test_at_parser_indexed_small_table)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[2];
+	int32_t num = 0;
+	size_t count = 0;
+
+	const char *str1 = "+NOTIF: 1,2,3,4,5\r\nOK\r\n";
+
+	ret = at_parser_init_indexed(&parser, str1, tokens, ARRAY_SIZE(tokens));
+	zassert_ok(ret);
+
+	/* Values past the end of the token table are still reachable. */
+	for (int i = 5; i > 0; i--) {
+		ret = at_parser_num_get(&parser, i, &num);
+		zassert_ok(ret);
+		zassert_equal(num, i);
+	}
+
+	ret = at_parser_num_get(&parser, 6, &num);
+	zassert_equal(ret, -EIO);
+
+	ret = at_parser_cmd_count_get(&parser, &count);
+	zassert_ok(ret);
+	zassert_equal(count, 6);
+}
+
+ZTEST(at_parser, test_at_parser_indexed_ebadmsg)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[8];
+	int32_t num = 0;
+
+	const char *str1 = "+NOTIF: 1,2 3\r\n";
+
+	ret = at_parser_init_indexed(&parser, str1, tokens, ARRAY_SIZE(tokens));
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 1, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 1);
+
+	ret = at_parser_num_get(&parser, 2, &num);
+	zassert_equal(ret, -EBADMSG);
+}
+
+ZTEST(at_parser, test_at_parser_indexed_cmd_next)
+{
+	int ret;
+	struct at_parser parser;
+	struct at_parser_token tokens[8];
+	int32_t num = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(multiline); i++) {
+		ret = at_parser_init_indexed(&parser, multiline[i], tokens, ARRAY_SIZE(tokens));
+		zassert_ok(ret);
+
+		ret = at_parser_num_get(&parser, 2, &num);
+		zassert_ok(ret);
+		zassert_equal(num, 0);
+
+		ret = at_parser_num_get(&parser, 3, &num);
+		zassert_equal(ret, -ENODATA);
+
+		ret = at_parser_cmd_next(&parser);
+		zassert_ok(ret);
+
+		ret = at_parser_num_get(&parser, 2, &num);
+		zassert_ok(ret);
+		zassert_equal(num, 2);
+
+		ret = at_parser_num_get(&parser, 1, &num);
+		zassert_ok(ret);
+		zassert_equal(num, 1);
+
+		ret = at_parser_cmd_next(&parser);
+		zassert_ok(ret);
+
+		ret = at_parser_num_get(&parser, 6, &num);
+		zassert_ok(ret);
+		zassert_equal(num, 65280000);
+
+		ret = at_parser_num_get(&parser, 5, &num);
+		zassert_ok(ret);
+		zassert_equal(num, 1);
+
+		ret = at_parser_num_get(&parser, 7, &num);
+		zassert_true(ret == -EIO || ret == -EAGAIN);
+
+		ret = at_parser_cmd_next(&parser);
+		zassert_equal(ret, -EOPNOTSUPP);
+	}
+}
+
 ZTEST_SUITE(at_parser, NULL, NULL, NULL, NULL, NULL);
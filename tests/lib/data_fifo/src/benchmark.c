@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <data_fifo.h>
+
+/* Number of blocks in each FIFO. */
+#define BENCH_ELEMENTS	 8
+/* Block size, matching a small audio frame. */
+#define BENCH_BLOCK_SIZE 128
+/* Number of blocks passed from the producer to the consumer. */
+#define BENCH_BLOCKS_NUM 10000
+
+#define BENCH_STACK_SIZE 1024
+
+DATA_FIFO_DEFINE(bench_fifo, BENCH_ELEMENTS, BENCH_BLOCK_SIZE);
+DATA_FIFO_SPSC_DEFINE(bench_fifo_spsc, BENCH_ELEMENTS, BENCH_BLOCK_SIZE);
+
+K_THREAD_STACK_DEFINE(bench_stack, BENCH_STACK_SIZE);
+static struct k_thread bench_thread;
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	int ret;
+	struct data_fifo *data_fifo = p1;
+	uint32_t *data_ptr;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < BENCH_BLOCKS_NUM; i++) {
+		ret = data_fifo_pointer_first_vacant_get(data_fifo, (void **)&data_ptr, K_FOREVER);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		*data_ptr = i;
+
+		ret = data_fifo_block_lock(data_fifo, (void **)&data_ptr, BENCH_BLOCK_SIZE);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+	}
+}
+
+static uint32_t cycles_per_block(struct data_fifo *data_fifo)
+{
+	int ret;
+	uint32_t start;
+	uint32_t cycles;
+	void *data_ptr;
+	size_t data_size;
+
+	ret = data_fifo_init(data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	start = k_cycle_get_32();
+
+	k_thread_create(&bench_thread, bench_stack, K_THREAD_STACK_SIZEOF(bench_stack), producer,
+			data_fifo, NULL, NULL, k_thread_priority_get(k_current_get()), 0,
+			K_NO_WAIT);
+
+	for (uint32_t i = 0; i < BENCH_BLOCKS_NUM; i++) {
+		ret = data_fifo_pointer_last_filled_get(data_fifo, &data_ptr, &data_size,
+							K_FOREVER);
+		zassert_equal(ret, 0, "_last_filled_get did not return 0");
+		zassert_equal(*(uint32_t *)data_ptr, i, "blocks received out of order");
+
+		data_fifo_block_free(data_fifo, data_ptr);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	k_thread_join(&bench_thread, K_FOREVER);
+
+	ret = data_fifo_uninit(data_fifo);
+	zassert_equal(ret, 0, "deinit did not return 0");
+
+	return cycles / BENCH_BLOCKS_NUM;
+}
+
+ZTEST(data_fifo_benchmark, test_data_fifo_benchmark_throughput)
+{
+	uint32_t slab_msgq;
+	uint32_t spsc;
+
+	slab_msgq = cycles_per_block(&bench_fifo);
+	spsc = cycles_per_block(&bench_fifo_spsc);
+
+	TC_PRINT("%d blocks of %d bytes: %u cycles/block slab and msgq, %u cycles/block SPSC\n",
+		 BENCH_BLOCKS_NUM, BENCH_BLOCK_SIZE, slab_msgq, spsc);
+}
+
+ZTEST_SUITE(data_fifo_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -231,4 +231,173 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_size_zero)
 	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
 }
 
+ZTEST(suite_data_fifo, test_data_fifo_spsc_data_put_get_ok)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	for (uint32_t i = 0; i < 10; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+		data_ptr[0] = i;
+
+		internal_test_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, i + 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+
+		internal_test_remaining_elements(&data_fifo, 1, 1, __LINE__);
+
+		ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+							K_NO_WAIT);
+		zassert_equal(ret, 0, "_last_filled_get did not return 0");
+		zassert_equal(data_ptr_read, data_ptr, "block pointer incorrect");
+		zassert_equal(((uint8_t *)data_ptr_read)[0], i, "data contents incorrect");
+		zassert_equal(data_size, i + 1, "data size incorrect");
+
+		internal_test_remaining_elements(&data_fifo, 1, 0, __LINE__);
+
+		data_fifo_block_free(&data_fifo, data_ptr_read);
+
+		internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+	}
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_data_put_too_many)
+{
+#define SPSC_BLOCKS_NUM 4
+	DATA_FIFO_SPSC_DEFINE(data_fifo, SPSC_BLOCKS_NUM, 128);
+
+	int ret;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG, "_last_filled_get did not return -ENOMSG");
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+						K_MSEC(1));
+	zassert_equal(ret, -EAGAIN, "_last_filled_get did not return -EAGAIN");
+
+	for (uint32_t i = 0; i < SPSC_BLOCKS_NUM; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 5);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+	}
+
+	internal_test_remaining_elements(&data_fifo, SPSC_BLOCKS_NUM, SPSC_BLOCKS_NUM, __LINE__);
+
+	/* Add one too many elements */
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not ENOMEM");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_MSEC(1));
+	zassert_equal(ret, -EAGAIN, "first_vacant_get did not return -EAGAIN");
+
+	ret = data_fifo_uninit(&data_fifo);
+	zassert_equal(ret, 0, "deinit did not return 0");
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_lock_out_of_order)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	uint8_t *data_ptr_1;
+	uint8_t *data_ptr_2;
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr_1, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr_2, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_2, 5);
+	zassert_equal(ret, -ESPIPE, "block_lock did not return -ESPIPE");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_1, 5);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr_2, 5);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 2, 2, __LINE__);
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc_free_out_of_order)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	uint8_t *data_ptr;
+	void *data_ptr_read_1;
+	void *data_ptr_read_2;
+	size_t data_size;
+
+	/* Nothing has been read yet */
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_block_free(&data_fifo, data_ptr);
+	zassert_equal(ret, -EINVAL, "block_free did not return -EINVAL");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 5);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 5);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read_1, &data_size,
+						K_NO_WAIT);
+	zassert_equal(ret, 0, "_last_filled_get did not return 0");
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read_2, &data_size,
+						K_NO_WAIT);
+	zassert_equal(ret, 0, "_last_filled_get did not return 0");
+
+	ret = data_fifo_block_free(&data_fifo, data_ptr_read_2);
+	zassert_equal(ret, -EINVAL, "block_free did not return -EINVAL");
+
+	internal_test_remaining_elements(&data_fifo, 2, 0, __LINE__);
+
+	ret = data_fifo_block_free(&data_fifo, data_ptr_read_1);
+	zassert_equal(ret, 0, "block_free did not return 0");
+
+	ret = data_fifo_block_free(&data_fifo, data_ptr_read_2);
+	zassert_equal(ret, 0, "block_free did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+}
+
 ZTEST_SUITE(suite_data_fifo, NULL, NULL, NULL, NULL, NULL);
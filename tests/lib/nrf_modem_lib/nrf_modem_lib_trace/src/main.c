@@ -58,6 +58,24 @@ static int trace_backend_write_cmock_num_calls;
 
 static int callback_evt;
 
+/* Trace fragments written with vector writes, and the bytes written by each write */
+#define VEC_N_FRAGS 4
+static const size_t vec_frag_lens[VEC_N_FRAGS] = {100, 50, 200, 10};
+static const size_t vec_write_lens[] = {30, 120, 205, 5};
+static uint8_t vec_data[360];
+
+/* First fragment and number of fragments of each vector write */
+static struct {
+	const void *data;
+	size_t len;
+	size_t n_frags;
+} vec_writes[ARRAY_SIZE(vec_write_lens)];
+static int vec_write_cnt;
+/* Index of the vector write which fails, and its error */
+static int vec_write_error_idx;
+static int vec_write_error;
+static size_t processed_len;
+
 extern void nrf_modem_lib_trace_init(void);
 
 /* This is the override for the _weak callback. */
@@ -94,6 +112,10 @@ void setUp(void)
 	nrf_modem_trace_get_cmock_num_calls = 0;
 	trace_backend_write_error = 0;
 	trace_backend_write_cmock_num_calls = 9;
+	vec_write_cnt = 0;
+	vec_write_error_idx = -1;
+	vec_write_error = 0;
+	processed_len = 0;
 
 	RESET_FAKE(nrf_modem_at_printf);
 
@@ -191,6 +213,51 @@ int trace_backend_write_stub(const void *data, size_t len, int cmock_num_calls)
 	return (int)len;
 }
 
+/* Writes the number of bytes in `vec_write_lens` from the fragments, and completes the write
+ * before returning.
+ */
+static int trace_backend_write_vec_stub(const struct nrf_modem_trace_data *frags, size_t n_frags,
+					trace_backend_write_vec_done_cb done)
+{
+	int idx = vec_write_cnt++;
+
+	TEST_ASSERT_TRUE(idx < ARRAY_SIZE(vec_write_lens));
+
+	vec_writes[idx].data = frags[0].data;
+	vec_writes[idx].len = frags[0].len;
+	vec_writes[idx].n_frags = n_frags;
+
+	if (idx == vec_write_error_idx) {
+		done(vec_write_error);
+	} else {
+		done(vec_write_lens[idx]);
+	}
+
+	return 0;
+}
+
+static int nrf_modem_trace_processed_stub(size_t len, int cmock_num_calls)
+{
+	processed_len += len;
+
+	return 0;
+}
+
+/* Output the fragments in `vec_frag_lens` from the modem, in one call to nrf_modem_trace_get() */
+static void vec_frags_output(void)
+{
+	static struct nrf_modem_trace_data frags[VEC_N_FRAGS];
+	size_t offset = 0;
+
+	for (int i = 0; i < VEC_N_FRAGS; i++) {
+		frags[i].data = &vec_data[offset];
+		frags[i].len = vec_frag_lens[i];
+		offset += vec_frag_lens[i];
+
+		k_fifo_alloc_put(&get_fifo, &frags[i]);
+	}
+}
+
 /* Function implementing a mechanism to synchronize main testing thread with trace thread via
  * a semaphore. This is the last function in the execution flow that can be mocked.
  */
@@ -352,6 +419,79 @@ void test_trace_thread_handler_get_eshutdown(void)
 	TEST_ASSERT_EQUAL(1, nrf_modem_trace_get_cmock_num_calls);
 }
 
+/* Test that the trace fragments are written in place with vector writes, and that a partial write
+ * is resumed where it ended, in the middle of a fragment or at the start of the next one.
+ */
+void test_trace_thread_handler_write_vec(void)
+{
+	__cmock_trace_backend_init_ExpectAndReturn(nrf_modem_trace_processed, 0);
+	__cmock_nrf_modem_trace_get_Stub(nrf_modem_trace_get_stub);
+	__cmock_nrf_modem_trace_processed_Stub(nrf_modem_trace_processed_stub);
+	__cmock_trace_backend_deinit_Stub(trace_backend_deinit_stub);
+
+	trace_backend.write_vec = trace_backend_write_vec_stub;
+
+	nrf_modem_lib_trace_init();
+
+	vec_frags_output();
+
+	for (int i = 0; (i < 1000) && (processed_len < sizeof(vec_data)); i++) {
+		k_sleep(K_MSEC(1));
+	}
+
+	nrf_modem_trace_get_error = -ESHUTDOWN;
+
+	wait_trace_deinit();
+
+	trace_backend.write_vec = NULL;
+
+	TEST_ASSERT_EQUAL(sizeof(vec_data), processed_len);
+	TEST_ASSERT_EQUAL(4, vec_write_cnt);
+
+	/* All fragments */
+	TEST_ASSERT_EQUAL_PTR(&vec_data[0], vec_writes[0].data);
+	TEST_ASSERT_EQUAL(100, vec_writes[0].len);
+	TEST_ASSERT_EQUAL(4, vec_writes[0].n_frags);
+	/* The rest of the first fragment */
+	TEST_ASSERT_EQUAL_PTR(&vec_data[30], vec_writes[1].data);
+	TEST_ASSERT_EQUAL(70, vec_writes[1].len);
+	TEST_ASSERT_EQUAL(4, vec_writes[1].n_frags);
+	/* The first two fragments are written */
+	TEST_ASSERT_EQUAL_PTR(&vec_data[150], vec_writes[2].data);
+	TEST_ASSERT_EQUAL(200, vec_writes[2].len);
+	TEST_ASSERT_EQUAL(2, vec_writes[2].n_frags);
+	/* The rest of the last fragment */
+	TEST_ASSERT_EQUAL_PTR(&vec_data[355], vec_writes[3].data);
+	TEST_ASSERT_EQUAL(5, vec_writes[3].len);
+	TEST_ASSERT_EQUAL(1, vec_writes[3].n_frags);
+}
+
+/* Test that the trace is deinitialized when a vector write fails, after releasing to the modem
+ * what was written.
+ */
+void test_trace_thread_handler_write_vec_efault(void)
+{
+	__cmock_trace_backend_init_ExpectAndReturn(nrf_modem_trace_processed, 0);
+	__cmock_nrf_modem_trace_get_Stub(nrf_modem_trace_get_stub);
+	__cmock_nrf_modem_trace_processed_Stub(nrf_modem_trace_processed_stub);
+	__cmock_trace_backend_deinit_Stub(trace_backend_deinit_stub);
+
+	trace_backend.write_vec = trace_backend_write_vec_stub;
+	vec_write_error_idx = 1;
+	vec_write_error = -EFAULT;
+
+	nrf_modem_lib_trace_init();
+
+	vec_frags_output();
+
+	wait_trace_deinit();
+
+	trace_backend.write_vec = NULL;
+
+	TEST_ASSERT_EQUAL(2, vec_write_cnt);
+	TEST_ASSERT_EQUAL(30, processed_len);
+}
+
 void test_nrf_modem_lib_trace_level_set(void)
 {
 	int ret;
@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <unity.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/fff.h>
+#include <modem/trace_backend.h>
+#include <nrf_errno.h>
+
+#include "nrf_modem_lib_trace.h"
+
+#include "cmock_nrf_modem.h"
+#include "cmock_nrf_modem_trace.h"
+#include "cmock_nrf_modem_os.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC_VARARG(int, nrf_modem_at_printf, const char *, ...);
+
+LOG_MODULE_REGISTER(trace_staging_test, CONFIG_NRF_MODEM_LIB_TRACE_STAGING_TEST_LOG_LEVEL);
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+extern void nrf_modem_lib_trace_init(void);
+
+#define STAGING_BUF_SIZE CONFIG_NRF_MODEM_LIB_TRACE_STAGING_BUF_SIZE
+#define TRACE_SIZE	 (STAGING_BUF_SIZE * 4)
+/* Largest write of the backend, to have the trace data written in several parts */
+#define BACKEND_CHUNK_SZ 700
+#define MAX_N_FRAGS	 64
+#define WAIT_TIMEOUT	 K_SECONDS(1)
+
+/* Trace data as output by the modem, and as received by the backend */
+static uint8_t trace_data[TRACE_SIZE];
+static uint8_t backend_data[TRACE_SIZE];
+static size_t backend_len;
+static size_t processed_len;
+static size_t max_n_frags;
+static int backend_err;
+static bool backend_stalled;
+
+static struct nrf_modem_trace_data get_frags[MAX_N_FRAGS];
+static size_t get_n_frags;
+static int trace_get_error;
+
+K_SEM_DEFINE(get_sem, 0, 1);
+K_SEM_DEFINE(backend_deinit_sem, 0, 1);
+K_SEM_DEFINE(backend_resume_sem, 0, 1);
+K_SEM_DEFINE(write_pending_sem, 0, 1);
+K_SEM_DEFINE(write_attempt_sem, 0, 1);
+
+/* Vector write in progress */
+static const struct nrf_modem_trace_data *write_frags;
+static size_t write_n_frags;
+static trace_backend_write_vec_done_cb write_done;
+
+static int nrf_modem_trace_get_stub(struct nrf_modem_trace_data **frags, size_t *n_frags,
+				    int timeout, int cmock_num_calls)
+{
+	while (k_sem_take(&get_sem, K_MSEC(1)) != 0) {
+		if (trace_get_error) {
+			return trace_get_error;
+		}
+	}
+
+	*frags = get_frags;
+	*n_frags = get_n_frags;
+
+	return 0;
+}
+
+static int nrf_modem_trace_processed_stub(size_t len, int cmock_num_calls)
+{
+	processed_len += len;
+
+	return 0;
+}
+
+/* Copy up to BACKEND_CHUNK_SZ bytes from the fragments to the backend data. */
+static int backend_receive(const struct nrf_modem_trace_data *frags, size_t n_frags)
+{
+	size_t len;
+	size_t written = 0;
+
+	k_sem_give(&write_attempt_sem);
+
+	if (backend_err) {
+		return backend_err;
+	}
+
+	for (size_t i = 0; (i < n_frags) && (written < BACKEND_CHUNK_SZ); i++) {
+		len = MIN(frags[i].len, BACKEND_CHUNK_SZ - written);
+		TEST_ASSERT_TRUE(backend_len + len <= sizeof(backend_data));
+
+		memcpy(&backend_data[backend_len], frags[i].data, len);
+		backend_len += len;
+		written += len;
+	}
+
+	return written;
+}
+
+/* Completes vector writes, unless the backend is stalled */
+static void backend_thread_handler(void)
+{
+	trace_backend_write_vec_done_cb done;
+
+	while (true) {
+		k_sem_take(&write_pending_sem, K_FOREVER);
+
+		if (backend_stalled) {
+			k_sem_take(&backend_resume_sem, K_FOREVER);
+		}
+
+		done = write_done;
+		write_done = NULL;
+		done(backend_receive(write_frags, write_n_frags));
+	}
+}
+
+K_THREAD_DEFINE(backend_thread, 1024, backend_thread_handler, NULL, NULL, NULL,
+		K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+
+static int backend_init(trace_backend_processed_cb trace_processed_cb)
+{
+	/* Staged trace data is released to the modem when it is copied */
+	TEST_ASSERT_TRUE(trace_processed_cb != nrf_modem_trace_processed);
+
+	return 0;
+}
+
+static int backend_deinit(void)
+{
+	k_sem_give(&backend_deinit_sem);
+
+	return 0;
+}
+
+static int backend_write(const void *data, size_t len)
+{
+	struct nrf_modem_trace_data frag = {
+		.data = data,
+		.len = len,
+	};
+
+	return backend_receive(&frag, 1);
+}
+
+static int backend_clear(void)
+{
+	return 0;
+}
+
+static int backend_write_vec(const struct nrf_modem_trace_data *frags, size_t n_frags,
+			     trace_backend_write_vec_done_cb done)
+{
+	TEST_ASSERT_NULL(write_done);
+
+	max_n_frags = MAX(max_n_frags, n_frags);
+
+	write_frags = frags;
+	write_n_frags = n_frags;
+	write_done = done;
+	k_sem_give(&write_pending_sem);
+
+	return 0;
+}
+
+struct nrf_modem_lib_trace_backend trace_backend = {
+	.init = backend_init,
+	.deinit = backend_deinit,
+	.write = backend_write,
+	.write_vec = backend_write_vec,
+};
+
+void setUp(void)
+{
+	for (size_t i = 0; i < sizeof(trace_data); i++) {
+		trace_data[i] = (uint8_t)(i ^ (i >> 8));
+	}
+
+	memset(backend_data, 0, sizeof(backend_data));
+	backend_len = 0;
+	processed_len = 0;
+	max_n_frags = 0;
+	backend_err = 0;
+	backend_stalled = false;
+	trace_get_error = 0;
+	trace_backend.write_vec = backend_write_vec;
+	trace_backend.clear = NULL;
+	k_sem_reset(&write_attempt_sem);
+
+	RESET_FAKE(nrf_modem_at_printf);
+
+	__cmock_nrf_modem_trace_get_Stub(nrf_modem_trace_get_stub);
+	__cmock_nrf_modem_trace_processed_Stub(nrf_modem_trace_processed_stub);
+
+	nrf_modem_lib_trace_init();
+}
+
+static void trace_shutdown(void)
+{
+	trace_get_error = -NRF_ESHUTDOWN;
+
+	TEST_ASSERT_EQUAL(0, k_sem_take(&backend_deinit_sem, WAIT_TIMEOUT));
+}
+
+/* Output trace data from the modem in one call to nrf_modem_trace_get(), split in fragments of
+ * varying size.
+ */
+static void modem_trace_output(size_t offset, size_t len)
+{
+	size_t frag_len;
+
+	get_n_frags = 0;
+
+	while (len) {
+		TEST_ASSERT_TRUE(get_n_frags < MAX_N_FRAGS);
+
+		frag_len = MIN(len, 1 + ((offset * 7) % 300));
+		get_frags[get_n_frags].data = &trace_data[offset];
+		get_frags[get_n_frags].len = frag_len;
+		get_n_frags++;
+
+		offset += frag_len;
+		len -= frag_len;
+	}
+
+	k_sem_give(&get_sem);
+}
+
+static void wait_for(size_t *value, size_t expected)
+{
+	for (int i = 0; (i < 1000) && (*value != expected); i++) {
+		k_sleep(K_MSEC(1));
+	}
+
+	TEST_ASSERT_EQUAL(expected, *value);
+}
+
+/* Output and check the whole trace, in several calls to nrf_modem_trace_get() */
+static void trace_stream(void)
+{
+	const size_t len = STAGING_BUF_SIZE / 2;
+
+	for (size_t offset = 0; offset < sizeof(trace_data); offset += len) {
+		modem_trace_output(offset, len);
+		wait_for(&processed_len, offset + len);
+	}
+
+	wait_for(&backend_len, sizeof(trace_data));
+
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(trace_data, backend_data, sizeof(trace_data));
+}
+
+/* Test that trace data is released to the modem while the backend is not writing it */
+void test_trace_released_while_backend_stalled(void)
+{
+	backend_stalled = true;
+
+	modem_trace_output(0, STAGING_BUF_SIZE);
+
+	wait_for(&processed_len, STAGING_BUF_SIZE);
+	TEST_ASSERT_EQUAL(0, backend_len);
+
+	backend_stalled = false;
+	k_sem_give(&backend_resume_sem);
+
+	wait_for(&backend_len, STAGING_BUF_SIZE);
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(trace_data, backend_data, STAGING_BUF_SIZE);
+
+	trace_shutdown();
+}
+
+/* Test that trace data wrapping around the end of the staging buffer is written as one vector.
+ * The tests before this one leave the staging buffer at its start.
+ */
+void test_trace_staged_with_vec_write(void)
+{
+	modem_trace_output(0, 600);
+	wait_for(&backend_len, 600);
+	k_sleep(K_MSEC(10));
+
+	modem_trace_output(600, 800);
+	wait_for(&backend_len, 1400);
+	k_sleep(K_MSEC(10));
+
+	TEST_ASSERT_EQUAL(2, max_n_frags);
+
+	/* Back to the start of the staging buffer */
+	modem_trace_output(1400, (2 * STAGING_BUF_SIZE) - 1400);
+	wait_for(&backend_len, 2 * STAGING_BUF_SIZE);
+
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(trace_data, backend_data, 2 * STAGING_BUF_SIZE);
+
+	trace_shutdown();
+}
+
+/* Test that staged trace data is written with write() by backends without write_vec() */
+void test_trace_staged_with_write(void)
+{
+	trace_backend.write_vec = NULL;
+
+	trace_stream();
+
+	TEST_ASSERT_EQUAL(0, max_n_frags);
+
+	trace_shutdown();
+}
+
+/* Test that the trace is deinitialized after an irrecoverable backend error */
+void test_trace_backend_error(void)
+{
+	backend_err = -EFAULT;
+
+	modem_trace_output(0, 100);
+	TEST_ASSERT_EQUAL(0, k_sem_take(&write_attempt_sem, WAIT_TIMEOUT));
+	k_sleep(K_MSEC(10));
+
+	/* The trace is deinitialized when the next trace data is staged. */
+	modem_trace_output(100, 100);
+
+	TEST_ASSERT_EQUAL(0, k_sem_take(&backend_deinit_sem, WAIT_TIMEOUT));
+	TEST_ASSERT_EQUAL(100, processed_len);
+	TEST_ASSERT_EQUAL(0, backend_len);
+}
+
+/* Test that the trace is deinitialized while the staging thread waits for the trace level to be
+ * set, after the backend returned -ENOSR.
+ */
+void test_trace_deinit_while_trace_level_off(void)
+{
+	TEST_ASSERT_EQUAL(0, nrf_modem_lib_trace_level_set(NRF_MODEM_LIB_TRACE_LEVEL_OFF));
+	backend_err = -ENOSR;
+
+	modem_trace_output(0, 100);
+	TEST_ASSERT_EQUAL(0, k_sem_take(&write_attempt_sem, WAIT_TIMEOUT));
+
+	/* The write is not retried until the trace level is set */
+	TEST_ASSERT_NOT_EQUAL(0, k_sem_take(&write_attempt_sem, K_MSEC(10)));
+
+	/* The staged data is dropped */
+	trace_shutdown();
+	TEST_ASSERT_EQUAL(100, processed_len);
+	TEST_ASSERT_EQUAL(0, backend_len);
+
+	TEST_ASSERT_EQUAL(0, nrf_modem_lib_trace_level_set(NRF_MODEM_LIB_TRACE_LEVEL_FULL));
+}
+
+/* Test that the trace is deinitialized while the staging thread waits for the backend to be
+ * cleared, after the backend returned -ENOSPC.
+ */
+void test_trace_deinit_while_backend_full(void)
+{
+	trace_backend.clear = backend_clear;
+	backend_err = -ENOSPC;
+
+	modem_trace_output(0, 100);
+	TEST_ASSERT_EQUAL(0, k_sem_take(&write_attempt_sem, WAIT_TIMEOUT));
+
+	/* The write is not retried until the backend is cleared */
+	TEST_ASSERT_NOT_EQUAL(0, k_sem_take(&write_attempt_sem, K_MSEC(10)));
+
+	/* The staged data is dropped */
+	trace_shutdown();
+	TEST_ASSERT_EQUAL(100, processed_len);
+	TEST_ASSERT_EQUAL(0, backend_len);
+}
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
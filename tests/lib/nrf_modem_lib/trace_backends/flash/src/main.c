@@ -20,6 +20,14 @@ extern struct nrf_modem_lib_trace_backend trace_backend;
 /* The flash backend expects this semaphore to exist */
 K_SEM_DEFINE(trace_clear_sem, 0, 1);
 
+/* Pattern that differs between bytes at the same position in different FCB entries */
+static void pattern_fill(uint8_t *buf, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		buf[i] = (uint8_t)(i ^ (i >> 8));
+	}
+}
+
 /* Callback for processed traces - not used in these tests */
 static int processed_cb(size_t len)
 {
@@ -612,6 +620,168 @@ void test_read_small_amount_of_data_multiple_times(void)
 	TEST_ASSERT_EQUAL(-EFAULT, ret);
 }
 
+/* Test peek_at at offsets in decreasing order, so that no read starts from the cached position */
+void test_peek_at_random_access(void)
+{
+	int ret;
+	static uint8_t data[(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE * 20) + 100];
+	uint8_t read_buf[100];
+	const size_t step = 997;
+
+	pattern_fill(data, sizeof(data));
+
+	ret = trace_backend.init(processed_cb);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	ret = trace_backend.write(data, sizeof(data));
+	TEST_ASSERT_EQUAL((int)sizeof(data), ret);
+
+	for (size_t offset = sizeof(data) - sizeof(read_buf); offset >= step; offset -= step) {
+		ret = trace_backend.peek_at(offset, read_buf, sizeof(read_buf));
+		TEST_ASSERT_EQUAL((int)sizeof(read_buf), ret);
+
+		TEST_ASSERT_EQUAL_HEX8_ARRAY(&data[offset], read_buf, sizeof(read_buf));
+	}
+
+	/* Last byte in flash and first byte in the RAM buffer */
+	ret = trace_backend.peek_at(sizeof(data) - 101, read_buf, 2);
+	TEST_ASSERT_EQUAL(2, ret);
+
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(&data[sizeof(data) - 101], read_buf, 2);
+}
+
+/* Test that peek_at offsets follow the oldest data in flash after a sector is erased by read() */
+void test_peek_at_after_sector_rotation(void)
+{
+	int ret;
+	static uint8_t data[CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE * 12];
+	uint8_t read_buf[CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE];
+	uint8_t peek_at_buf[64];
+	size_t base = 0;
+
+	pattern_fill(data, sizeof(data));
+
+	ret = trace_backend.init(processed_cb);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	ret = trace_backend.write(data, sizeof(data));
+	TEST_ASSERT_EQUAL((int)sizeof(data), ret);
+
+	/* Read entries until the first sector has been erased */
+	for (size_t i = 0; i < sizeof(data) / sizeof(read_buf) / 2; i++) {
+		ret = trace_backend.read(read_buf, sizeof(read_buf));
+		TEST_ASSERT_EQUAL((int)sizeof(read_buf), ret);
+	}
+
+	/* The oldest byte in flash is now the first byte of a later entry */
+	ret = trace_backend.peek_at(0, peek_at_buf, sizeof(peek_at_buf));
+	TEST_ASSERT_EQUAL((int)sizeof(peek_at_buf), ret);
+
+	for (size_t i = 1; i < sizeof(data) / sizeof(read_buf); i++) {
+		if (!memcmp(&data[i * sizeof(read_buf)], peek_at_buf, sizeof(peek_at_buf))) {
+			base = i * sizeof(read_buf);
+			break;
+		}
+	}
+
+	TEST_ASSERT_NOT_EQUAL(0, base);
+
+	/* Offsets are bounded by the unread data */
+	for (size_t offset = trace_backend.data_size() - sizeof(peek_at_buf); offset > 0;
+	     offset -= MIN(offset, 1500)) {
+		ret = trace_backend.peek_at(offset, peek_at_buf, sizeof(peek_at_buf));
+		TEST_ASSERT_EQUAL((int)sizeof(peek_at_buf), ret);
+
+		TEST_ASSERT_EQUAL_HEX8_ARRAY(&data[base + offset], peek_at_buf, sizeof(peek_at_buf));
+	}
+}
+
+/* Test that peek_regions returns -EINVAL for NULL or empty array, and -EFAULT out of range */
+void test_peek_regions_invalid_parameters(void)
+{
+	int ret;
+	uint8_t data[8] = { 0xAB };
+	struct nrf_modem_lib_trace_region regions[2];
+
+	ret = trace_backend.peek_regions(0, regions, ARRAY_SIZE(regions));
+	TEST_ASSERT_EQUAL(-EPERM, ret);
+
+	ret = trace_backend.init(processed_cb);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	ret = trace_backend.write(data, sizeof(data));
+	TEST_ASSERT_EQUAL((int)sizeof(data), ret);
+
+	ret = trace_backend.peek_regions(0, NULL, 1);
+	TEST_ASSERT_EQUAL(-EINVAL, ret);
+
+	ret = trace_backend.peek_regions(0, regions, 0);
+	TEST_ASSERT_EQUAL(-EINVAL, ret);
+
+	ret = trace_backend.peek_regions(sizeof(data), regions, ARRAY_SIZE(regions));
+	TEST_ASSERT_EQUAL(-EFAULT, ret);
+
+	/* Data is still in the RAM buffer */
+	ret = trace_backend.peek_regions(0, regions, ARRAY_SIZE(regions));
+	TEST_ASSERT_EQUAL(-ENODATA, ret);
+}
+
+/* Test reading all trace data in flash ahead through the regions, and that it is not consumed */
+void test_peek_regions_read_ahead(void)
+{
+	int ret;
+	static uint8_t data[(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE * 6) + 100];
+	static uint8_t read_buf[CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE];
+	struct nrf_modem_lib_trace_region regions[4];
+	size_t offset = 100;
+	int cnt;
+
+	pattern_fill(data, sizeof(data));
+
+	ret = trace_backend.init(processed_cb);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	ret = trace_backend.write(data, sizeof(data));
+	TEST_ASSERT_EQUAL((int)sizeof(data), ret);
+
+	ret = trace_backend.peek_regions(offset, regions, ARRAY_SIZE(regions));
+	TEST_ASSERT_EQUAL(ARRAY_SIZE(regions), ret);
+
+	/* The first region starts at the offset */
+	TEST_ASSERT_EQUAL(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE - offset,
+			  regions[0].len);
+
+	while (true) {
+		cnt = trace_backend.peek_regions(offset, regions, ARRAY_SIZE(regions));
+		if (cnt == -ENODATA) {
+			break;
+		}
+
+		TEST_ASSERT_TRUE(cnt > 0);
+
+		for (int i = 0; i < cnt; i++) {
+			TEST_ASSERT_TRUE(regions[i].len <= sizeof(read_buf));
+
+			ret = flash_area_read(regions[i].fa, regions[i].off, read_buf,
+					      regions[i].len);
+			TEST_ASSERT_EQUAL(0, ret);
+
+			TEST_ASSERT_EQUAL_HEX8_ARRAY(&data[offset], read_buf, regions[i].len);
+
+			offset += regions[i].len;
+		}
+	}
+
+	/* Everything but the RAM buffer was handed out */
+	TEST_ASSERT_EQUAL(sizeof(data) - 100, offset);
+	TEST_ASSERT_EQUAL(sizeof(data), trace_backend.data_size());
+
+	ret = trace_backend.peek_at(offset, read_buf, 100);
+	TEST_ASSERT_EQUAL(100, ret);
+
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(&data[offset], read_buf, 100);
+}
+
 int main(void)
 {
 	(void)unity_main();
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <unity.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/serial/uart_emul.h>
+
+#include "trace_backend.h"
+
+extern struct nrf_modem_lib_trace_backend trace_backend;
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+#define CHUNK_SZ CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_CHUNK_SZ
+/* The UART transfers stop when the TX FIFO of the emulated UART is full */
+#define TX_FIFO_SIZE DT_PROP(DT_NODELABEL(trace_uart), tx_fifo_size)
+/* Data left in the TX FIFO to have the next writes stop after TX_FIFO_FREE bytes */
+#define TX_FIFO_FREE 40
+#define WAIT_TIMEOUT K_SECONDS(1)
+
+static const struct device *const uart_dev = DEVICE_DT_GET(DT_NODELABEL(trace_uart));
+
+static uint8_t trace_data[TX_FIFO_SIZE];
+static uint8_t tx_data[TX_FIFO_SIZE];
+
+/* Lengths released by the backend with the processed callback */
+static size_t processed[16];
+static int processed_cnt;
+
+/* Fragments of a vector write, taken apart in trace_data, and their concatenation */
+static const size_t vec_frag_lens[] = {10, 70, 5, 40};
+static struct nrf_modem_trace_data vec_frags[ARRAY_SIZE(vec_frag_lens)];
+static uint8_t vec_data[125];
+
+static int vec_result;
+K_SEM_DEFINE(vec_done_sem, 0, 1);
+
+static int processed_cb(size_t len)
+{
+	TEST_ASSERT_TRUE(processed_cnt < ARRAY_SIZE(processed));
+
+	processed[processed_cnt++] = len;
+
+	return 0;
+}
+
+static void vec_done(int result)
+{
+	vec_result = result;
+	k_sem_give(&vec_done_sem);
+}
+
+static int vec_write(void)
+{
+	int err;
+
+	err = trace_backend.write_vec(vec_frags, ARRAY_SIZE(vec_frags), vec_done);
+	if (err) {
+		return err;
+	}
+
+	TEST_ASSERT_EQUAL(0, k_sem_take(&vec_done_sem, WAIT_TIMEOUT));
+
+	return vec_result;
+}
+
+/* Fill the TX FIFO so that only TX_FIFO_FREE bytes can be written */
+static void tx_fifo_fill(void)
+{
+	TEST_ASSERT_EQUAL(TX_FIFO_SIZE - TX_FIFO_FREE,
+			  trace_backend.write(trace_data, TX_FIFO_SIZE - TX_FIFO_FREE));
+
+	processed_cnt = 0;
+}
+
+void setUp(void)
+{
+	size_t offset = 0;
+	size_t vec_len = 0;
+
+	for (size_t i = 0; i < sizeof(trace_data); i++) {
+		trace_data[i] = (uint8_t)(i * 7 + 3);
+	}
+
+	/* Fragments with gaps between them, crossing the chunk boundaries */
+	for (size_t i = 0; i < ARRAY_SIZE(vec_frags); i++) {
+		vec_frags[i].data = &trace_data[offset];
+		vec_frags[i].len = vec_frag_lens[i];
+
+		memcpy(&vec_data[vec_len], &trace_data[offset], vec_frag_lens[i]);
+		vec_len += vec_frag_lens[i];
+		offset += vec_frag_lens[i] + 3;
+	}
+
+	TEST_ASSERT_EQUAL(sizeof(vec_data), vec_len);
+
+	uart_emul_flush_tx_data(uart_dev);
+	memset(tx_data, 0, sizeof(tx_data));
+	memset(processed, 0, sizeof(processed));
+	processed_cnt = 0;
+	vec_result = 0;
+	k_sem_reset(&vec_done_sem);
+
+	TEST_ASSERT_EQUAL(0, trace_backend.init(processed_cb));
+}
+
+void test_trace_backend_init_uart_efault(void)
+{
+	TEST_ASSERT_EQUAL(-EFAULT, trace_backend.init(NULL));
+}
+
+/* Test that the trace data is split in chunks, which are released as they are written */
+void test_trace_backend_write_uart(void)
+{
+	const size_t len = 3 * CHUNK_SZ + 10;
+
+	TEST_ASSERT_EQUAL(len, trace_backend.write(trace_data, len));
+
+	TEST_ASSERT_EQUAL(4, processed_cnt);
+	TEST_ASSERT_EQUAL(CHUNK_SZ, processed[0]);
+	TEST_ASSERT_EQUAL(CHUNK_SZ, processed[1]);
+	TEST_ASSERT_EQUAL(CHUNK_SZ, processed[2]);
+	TEST_ASSERT_EQUAL(10, processed[3]);
+
+	TEST_ASSERT_EQUAL(len, uart_emul_get_tx_data(uart_dev, tx_data, sizeof(tx_data)));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(trace_data, tx_data, len);
+}
+
+/* Test that a write returns what was transferred when the UART stops, and -EAGAIN when
+ * nothing is transferred.
+ */
+void test_trace_backend_write_uart_short(void)
+{
+	tx_fifo_fill();
+
+	TEST_ASSERT_EQUAL(TX_FIFO_FREE, trace_backend.write(trace_data, 100));
+
+	/* A whole chunk, and what fits of the next one */
+	TEST_ASSERT_EQUAL(2, processed_cnt);
+	TEST_ASSERT_EQUAL(CHUNK_SZ, processed[0]);
+	TEST_ASSERT_EQUAL(TX_FIFO_FREE - CHUNK_SZ, processed[1]);
+
+	TEST_ASSERT_EQUAL(-EAGAIN, trace_backend.write(trace_data, 100));
+	TEST_ASSERT_EQUAL(2, processed_cnt);
+
+	uart_emul_flush_tx_data(uart_dev);
+
+	TEST_ASSERT_EQUAL(100, trace_backend.write(trace_data, 100));
+}
+
+/* Test that the fragments of a vector write are transferred in chunks, in order */
+void test_trace_backend_write_vec_uart(void)
+{
+	TEST_ASSERT_EQUAL(sizeof(vec_data), vec_write());
+
+	/* The trace library releases the data of vector writes */
+	TEST_ASSERT_EQUAL(0, processed_cnt);
+
+	TEST_ASSERT_EQUAL(sizeof(vec_data),
+			  uart_emul_get_tx_data(uart_dev, tx_data, sizeof(tx_data)));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(vec_data, tx_data, sizeof(vec_data));
+}
+
+/* Test that a vector write completes with what was transferred when the UART stops, and with
+ * -EAGAIN when nothing is transferred.
+ */
+void test_trace_backend_write_vec_uart_short(void)
+{
+	tx_fifo_fill();
+
+	TEST_ASSERT_EQUAL(TX_FIFO_FREE, vec_write());
+	TEST_ASSERT_EQUAL(-EAGAIN, vec_write());
+
+	/* The TX FIFO holds the first write, and the start of the vector */
+	TEST_ASSERT_EQUAL(TX_FIFO_SIZE,
+			  uart_emul_get_tx_data(uart_dev, tx_data, sizeof(tx_data)));
+	TEST_ASSERT_EQUAL_HEX8_ARRAY(vec_data, &tx_data[TX_FIFO_SIZE - TX_FIFO_FREE],
+				     TX_FIFO_FREE);
+}
+
+/* Test that nothing is written while the backend is suspended */
+void test_trace_backend_write_uart_suspended(void)
+{
+	TEST_ASSERT_EQUAL(0, trace_backend.suspend());
+
+	TEST_ASSERT_EQUAL(-EPERM, trace_backend.write(trace_data, 100));
+	TEST_ASSERT_EQUAL(-EPERM, trace_backend.write_vec(vec_frags, ARRAY_SIZE(vec_frags),
+							  vec_done));
+	TEST_ASSERT_EQUAL(0, processed_cnt);
+	TEST_ASSERT_EQUAL(0, uart_emul_get_tx_data(uart_dev, tx_data, sizeof(tx_data)));
+
+	TEST_ASSERT_EQUAL(0, trace_backend.resume());
+
+	TEST_ASSERT_EQUAL(100, trace_backend.write(trace_data, 100));
+}
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
@@ -127,4 +127,130 @@ ZTEST(suite_pcm_mix, test_mono_into_stereo_r)
 	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
 }
 
+ZTEST(suite_pcm_mix, test_odd_number_of_samples)
+{
+	int ret;
+	int16_t sample_a[] = { 1, 2, 3, INT16_MAX, INT16_MIN };
+	int16_t sample_b[] = { 1, 2, 3, 4, -4 };
+	int16_t sample_r[] = { 2, 4, 6, INT16_MAX, INT16_MIN };
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b), B_MONO_INTO_A_MONO);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mono_into_stereo_too_large)
+{
+	int ret;
+	int16_t sample_a[] = { 10, 10, 10, 10 };
+	int16_t sample_b[] = { -5, 5, 5 };
+	int16_t sample_r[] = { 10, 10, 10, 10 };
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+		      B_MONO_INTO_A_STEREO_L);
+	ZEQ(ret, -EPERM);
+
+	/* Buffer A must not be touched when the sizes do not match */
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_32_high_values)
+{
+	int ret;
+	int32_t sample_a[] = { INT32_MAX, INT32_MIN, INT32_MIN, INT32_MAX, 100000 };
+	int32_t sample_b[] = { 1, -1, 10, -10, -200000 };
+	int32_t sample_r[] = { INT32_MAX, INT32_MIN, INT32_MIN + 10, INT32_MAX - 10, -100000 };
+
+	ret = pcm_mix_32(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			 B_MONO_INTO_A_MONO);
+	ZEQ(ret, 0);
+
+	for (int i = 0; i < ARRAY_SIZE(sample_r); i++) {
+		ZEQ(sample_a[i], sample_r[i]);
+	}
+}
+
+ZTEST(suite_pcm_mix, test_mix_32_mono_into_stereo)
+{
+	int ret;
+	int32_t sample_a[] = { 10, 10, 10, 10 };
+	int32_t sample_b[] = { -5, INT32_MAX };
+	int32_t sample_r_lr[] = { 5, 5, INT32_MAX, INT32_MAX };
+	int32_t sample_r_r[] = { 5, 0, INT32_MAX, INT32_MAX };
+
+	ret = pcm_mix_32(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			 B_MONO_INTO_A_STEREO_LR);
+	ZEQ(ret, 0);
+
+	for (int i = 0; i < ARRAY_SIZE(sample_r_lr); i++) {
+		ZEQ(sample_a[i], sample_r_lr[i]);
+	}
+
+	ret = pcm_mix_32(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			 B_MONO_INTO_A_STEREO_R);
+	ZEQ(ret, 0);
+
+	for (int i = 0; i < ARRAY_SIZE(sample_r_r); i++) {
+		ZEQ(sample_a[i], sample_r_r[i]);
+	}
+
+	ret = pcm_mix_32(sample_a, sizeof(sample_a), sample_b, sizeof(sample_a),
+			 B_MONO_INTO_A_STEREO_R);
+	ZEQ(ret, -EPERM);
+}
+
+ZTEST(suite_pcm_mix, test_mix_weighted)
+{
+	int ret;
+	int16_t stream_1[] = { 100, -100, INT16_MAX, INT16_MIN, 3 };
+	int16_t stream_2[] = { 200, 200, INT16_MAX, INT16_MIN, 3 };
+	int16_t stream_3[] = { -300, 0, 0, 0, 0 };
+	void const *streams[] = { stream_1, stream_2, stream_3 };
+	int16_t gains[] = { PCM_MIX_GAIN_UNITY, PCM_MIX_GAIN_UNITY / 2, PCM_MIX_GAIN_UNITY };
+	int16_t sample_out[ARRAY_SIZE(stream_1)];
+	/* The last sample is 3 + 1.5 rounded to nearest */
+	int16_t sample_r[] = { -100, 0, INT16_MAX, INT16_MIN, 5 };
+
+	ret = pcm_mix_weighted(sample_out, sizeof(sample_out), streams, gains,
+			       ARRAY_SIZE(streams));
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_out, sample_r, ARRAY_SIZE(sample_r));
+
+	/* Half gain on the odd stream, written into one of the inputs */
+	gains[2] = PCM_MIX_GAIN_UNITY / 2;
+	ret = pcm_mix_weighted(stream_1, sizeof(stream_1), streams, gains, ARRAY_SIZE(streams));
+	ZEQ(ret, 0);
+	ZEQ(stream_1[0], 100 + 100 - 150);
+	ZEQ(stream_1[1], -100 + 100);
+
+	ret = pcm_mix_weighted(sample_out, sizeof(sample_out), streams, gains, 0);
+	ZEQ(ret, -EINVAL);
+}
+
+ZTEST(suite_pcm_mix, test_mix_weighted_unity_equals_mix)
+{
+	int ret;
+	int16_t sample_a[64];
+	int16_t sample_b[64];
+	int16_t sample_out[64];
+	void const *streams[] = { sample_a, sample_b };
+	int16_t gains[] = { PCM_MIX_GAIN_UNITY, PCM_MIX_GAIN_UNITY };
+
+	for (int i = 0; i < ARRAY_SIZE(sample_a); i++) {
+		sample_a[i] = (int16_t)(i * 1021 - 30000);
+		sample_b[i] = (int16_t)(i * 997 - 20000);
+	}
+
+	ret = pcm_mix_weighted(sample_out, sizeof(sample_out), streams, gains,
+			       ARRAY_SIZE(streams));
+	ZEQ(ret, 0);
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b), B_MONO_INTO_A_MONO);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_out, ARRAY_SIZE(sample_out));
+}
+
 ZTEST_SUITE(suite_pcm_mix, NULL, NULL, NULL, NULL, NULL);
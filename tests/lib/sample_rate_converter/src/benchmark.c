@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+#include <sample_rate_converter.h>
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+/* Number of 10 ms blocks converted for each measurement */
+#define BENCH_BLOCKS_NUM 100
+
+static struct sample_rate_converter_ctx bench_ctx[2];
+static struct sample_rate_converter_polyphase_ctx bench_poly_ctx;
+static int16_t bench_input[441 * 2];
+static int16_t bench_output[480 * 2];
+
+/* Separate contexts per channel, as needed by the integer ratio converter */
+static uint32_t cycles_integer_stereo(void)
+{
+	int ret;
+	uint32_t start;
+	size_t output_written;
+
+	sample_rate_converter_open(&bench_ctx[0]);
+	sample_rate_converter_open(&bench_ctx[1]);
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < BENCH_BLOCKS_NUM; i++) {
+		for (int ch = 0; ch < 2; ch++) {
+			ret = sample_rate_converter_process(
+				&bench_ctx[ch], SAMPLE_RATE_FILTER_SIMPLE, &bench_input[ch * 160],
+				160 * sizeof(int16_t), 16000, &bench_output[ch * 480],
+				480 * sizeof(int16_t), &output_written, 48000);
+			zassert_equal(ret, 0, "Sample rate conversion process failed");
+		}
+	}
+
+	return (k_cycle_get_32() - start) / BENCH_BLOCKS_NUM;
+}
+
+static uint32_t cycles_polyphase(uint32_t sample_rate_input, uint32_t sample_rate_output,
+				 size_t frames_in)
+{
+	int ret;
+	uint32_t start;
+	size_t output_written;
+
+	ret = sample_rate_converter_polyphase_open(&bench_poly_ctx, sample_rate_input,
+						   sample_rate_output, 2);
+	zassert_equal(ret, 0, "Polyphase open failed");
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < BENCH_BLOCKS_NUM; i++) {
+		ret = sample_rate_converter_polyphase_process(
+			&bench_poly_ctx, bench_input, frames_in * 2 * sizeof(int16_t), bench_output,
+			sizeof(bench_output), &output_written);
+		zassert_equal(ret, 0, "Polyphase process failed");
+	}
+
+	return (k_cycle_get_32() - start) / BENCH_BLOCKS_NUM;
+}
+
+ZTEST(suite_sample_rate_converter_benchmark, test_benchmark_stereo_10ms)
+{
+	uint32_t integer;
+	uint32_t poly_16k;
+	uint32_t poly_44k1;
+
+	for (int i = 0; i < ARRAY_SIZE(bench_input); i++) {
+		bench_input[i] = (i % 64) * 512 - 16384;
+	}
+
+	integer = cycles_integer_stereo();
+	poly_16k = cycles_polyphase(16000, 48000, 160);
+	poly_44k1 = cycles_polyphase(44100, 48000, 441);
+
+	TC_PRINT("Stereo 10 ms block, cycles/block: 16->48 kHz integer %u, 16->48 kHz polyphase "
+		 "%u, 44.1->48 kHz polyphase %u\n",
+		 integer, poly_16k, poly_44k1);
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_benchmark, NULL, NULL, NULL, NULL, NULL);
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
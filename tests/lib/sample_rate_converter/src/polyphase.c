@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+#include <sample_rate_converter.h>
+#include <stdlib.h>
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+/* 10 ms of stereo audio at 44.1 kHz */
+#define FRAMES_44K1 441
+#define FRAMES_48K  480
+
+static struct sample_rate_converter_polyphase_ctx poly_ctx;
+static int16_t poly_input[FRAMES_44K1 * 2];
+static int16_t poly_output[FRAMES_48K * 2];
+
+ZTEST(suite_sample_rate_converter_polyphase, test_valid_44k1_to_48k_stereo)
+{
+	int ret;
+	size_t output_written;
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 44100, 48000, 2);
+	zassert_equal(ret, 0, "Polyphase open failed");
+	zassert_equal(poly_ctx.interpolation, 160, "Interpolation not as expected");
+	zassert_equal(poly_ctx.decimation, 147, "Decimation not as expected");
+
+	/* Different constant levels in each channel */
+	for (int i = 0; i < FRAMES_44K1; i++) {
+		poly_input[i * 2] = 10000;
+		poly_input[i * 2 + 1] = -5000;
+	}
+
+	/* The first block fills the filter history, the second one is fully settled */
+	for (int block = 0; block < 2; block++) {
+		ret = sample_rate_converter_polyphase_process(&poly_ctx, poly_input,
+							      sizeof(poly_input), poly_output,
+							      sizeof(poly_output), &output_written);
+		zassert_equal(ret, 0, "Polyphase process failed");
+		zassert_equal(output_written, sizeof(poly_output),
+			      "Output size was not as expected (%d)", output_written);
+	}
+
+	for (int i = 0; i < FRAMES_48K; i++) {
+		zassert_within(poly_output[i * 2], 10000, 1, "Left frame %d: %d", i,
+			       poly_output[i * 2]);
+		zassert_within(poly_output[i * 2 + 1], -5000, 1, "Right frame %d: %d", i,
+			       poly_output[i * 2 + 1]);
+	}
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_valid_frames_out_follow_phase)
+{
+	int ret;
+	size_t output_written;
+	size_t frames_total = 0;
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 44100, 48000, 1);
+	zassert_equal(ret, 0, "Polyphase open failed");
+
+	/* Blocks that are not a multiple of the ratio still give 480 frames per 441 frames */
+	for (int block = 0; block < 9; block++) {
+		ret = sample_rate_converter_polyphase_process(&poly_ctx, poly_input, 49 * 2,
+							      poly_output, sizeof(poly_output),
+							      &output_written);
+		zassert_equal(ret, 0, "Polyphase process failed");
+		zassert_between_inclusive(output_written / 2, 53, 54,
+					  "Frames out not as expected (%d)", output_written / 2);
+		frames_total += output_written / 2;
+	}
+
+	zassert_equal(frames_total, FRAMES_48K, "Total frames out not as expected (%d)",
+		      frames_total);
+	zassert_equal(poly_ctx.phase, 0, "Phase not as expected (%d)", poly_ctx.phase);
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_valid_decimate_48k_to_16k)
+{
+	int ret;
+	size_t output_written;
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 48000, 16000, 2);
+	zassert_equal(ret, 0, "Polyphase open failed");
+
+	ret = sample_rate_converter_polyphase_process(&poly_ctx, poly_input, 96 * 2 * 2,
+						      poly_output, sizeof(poly_output),
+						      &output_written);
+	zassert_equal(ret, 0, "Polyphase process failed");
+	zassert_equal(output_written, 32 * 2 * 2, "Output size was not as expected (%d)",
+		      output_written);
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_invalid_open)
+{
+	int ret;
+
+	ret = sample_rate_converter_polyphase_open(NULL, 44100, 48000, 2);
+	zassert_equal(ret, -EINVAL, "Open did not fail on NULL context");
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 48000, 48000, 2);
+	zassert_equal(ret, -EINVAL, "Open did not fail on equal sample rates");
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 0, 48000, 2);
+	zassert_equal(ret, -EINVAL, "Open did not fail on zero sample rate");
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 44100, 48000, 0);
+	zassert_equal(ret, -EINVAL, "Open did not fail on zero channels");
+
+	ret = sample_rate_converter_polyphase_open(
+		&poly_ctx, 44100, 48000, CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_CHANNELS_MAX + 1);
+	zassert_equal(ret, -EINVAL, "Open did not fail on too many channels");
+
+	/* 44099 and 48000 have no common divisor, needing 48000 phases */
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 44099, 48000, 2);
+	zassert_equal(ret, -EINVAL, "Open did not fail on too many phases");
+}
+
+ZTEST(suite_sample_rate_converter_polyphase, test_invalid_process)
+{
+	int ret;
+	size_t output_written;
+
+	ret = sample_rate_converter_polyphase_open(&poly_ctx, 44100, 48000, 2);
+	zassert_equal(ret, 0, "Polyphase open failed");
+
+	ret = sample_rate_converter_polyphase_process(NULL, poly_input, sizeof(poly_input),
+						      poly_output, sizeof(poly_output),
+						      &output_written);
+	zassert_equal(ret, -EINVAL, "Process did not fail on NULL context");
+
+	/* Half a stereo frame */
+	ret = sample_rate_converter_polyphase_process(&poly_ctx, poly_input, sizeof(int16_t),
+						      poly_output, sizeof(poly_output),
+						      &output_written);
+	zassert_equal(ret, -EINVAL, "Process did not fail on partial frame");
+
+	ret = sample_rate_converter_polyphase_process(&poly_ctx, poly_input, sizeof(poly_input),
+						      poly_output, sizeof(poly_output) - 1,
+						      &output_written);
+	zassert_equal(ret, -EINVAL, "Process did not fail on too small output");
+	zassert_equal(poly_ctx.phase, 0, "Phase changed by failed process");
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_polyphase, NULL, NULL, NULL, NULL, NULL);
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
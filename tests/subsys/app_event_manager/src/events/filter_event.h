@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _FILTER_EVENT_H_
+#define _FILTER_EVENT_H_
+
+/**
+ * @brief Filter Event
+ * @defgroup filter_event Filter Event
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum filter_target {
+	FILTER_TARGET_A,
+	FILTER_TARGET_B,
+	FILTER_TARGET_C,
+
+	FILTER_TARGET_CNT
+};
+
+struct filter_event {
+	struct app_event_header header;
+
+	uint8_t seq;
+	enum filter_target target;
+};
+
+APP_EVENT_TYPE_DECLARE(filter_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _FILTER_EVENT_H_ */
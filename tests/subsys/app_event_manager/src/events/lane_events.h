@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _LANE_EVENTS_H_
+#define _LANE_EVENTS_H_
+
+/**
+ * @brief Lane Events
+ * @defgroup lane_events Events processed in different lanes
+ * @{
+ */
+
+#include <app_event_manager.h>
+#include <app_event_manager_profiler_tracer.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct lane_high_event {
+	struct app_event_header header;
+
+	int seq;
+};
+
+APP_EVENT_TYPE_DECLARE(lane_high_event);
+
+struct lane_normal_event {
+	struct app_event_header header;
+
+	int seq;
+};
+
+APP_EVENT_TYPE_DECLARE(lane_normal_event);
+
+struct lane_low_event {
+	struct app_event_header header;
+
+	int seq;
+};
+
+APP_EVENT_TYPE_DECLARE(lane_low_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _LANE_EVENTS_H_ */
@@ -9,6 +9,8 @@
 
 #include "sized_events.h"
 #include "test_events.h"
+#include "test_event_allocator.h"
+#include "app_event_manager_slab.h"
 
 static enum test_id cur_test_id;
 static K_SEM_DEFINE(test_end_sem, 0, 1);
@@ -184,6 +186,92 @@ ZTEST(suite0, test_name_style_events_sorting)
 	test_start(TEST_NAME_STYLE_SORTING);
 }
 
+ZTEST(suite0, test_subs_filter)
+{
+	test_start(TEST_SUBSCRIBER_FILTER);
+}
+
+ZTEST(suite0, test_lanes)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)) {
+		ztest_test_skip();
+		return;
+	}
+
+	test_start(TEST_LANES);
+}
+
+ZTEST(suite0, test_slab_exhaustion)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SLAB_ALLOCATOR)) {
+		ztest_test_skip();
+		return;
+	}
+
+	struct app_event_manager_slab_stats before;
+	struct app_event_manager_slab_stats stats;
+	struct test_size1_event *ev_tab[64];
+	struct test_dynamic_event *ev_dyn;
+	size_t heap_alloc_cnt;
+	size_t idx;
+	size_t cnt;
+
+	zassert_true(app_event_manager_slab_class_cnt() > 0, "No slab size classes");
+
+	/* Find the smallest size class that fits the event. */
+	for (idx = 0; idx < app_event_manager_slab_class_cnt(); idx++) {
+		zassert_ok(app_event_manager_slab_stats_get(idx, &before));
+		if (before.block_size >= sizeof(struct test_size1_event)) {
+			break;
+		}
+	}
+	zassert_true(idx < app_event_manager_slab_class_cnt(), "No size class fits the event");
+	zassert_true(before.num_blocks - before.num_used < ARRAY_SIZE(ev_tab),
+		     "Size class too large for the test");
+
+	/* Allocate until the size class is exhausted. */
+	heap_alloc_cnt = app_event_manager_slab_heap_alloc_cnt();
+	test_event_allocator_oom_expect(true);
+	for (cnt = 0; cnt < ARRAY_SIZE(ev_tab); cnt++) {
+		ev_tab[cnt] = new_test_size1_event();
+		if (!ev_tab[cnt]) {
+			break;
+		}
+	}
+	test_event_allocator_oom_expect(false);
+
+	zassert_equal(cnt, before.num_blocks - before.num_used,
+		      "Exhaustion before all blocks were allocated");
+	zassert_ok(app_event_manager_slab_stats_get(idx, &stats));
+	zassert_equal(stats.num_used, stats.num_blocks, "Not all blocks in use");
+	zassert_equal(stats.max_used, stats.num_blocks, "Unexpected highest usage");
+	zassert_equal(stats.alloc_fail, before.alloc_fail + 1, "Unexpected failure count");
+
+	/* An exhausted size class does not fall back to the heap. */
+	zassert_equal(app_event_manager_slab_heap_alloc_cnt(), heap_alloc_cnt,
+		      "Event allocated from the heap");
+
+	/* A freed block can be allocated again. */
+	app_event_manager_free(ev_tab[0]);
+	ev_tab[0] = new_test_size1_event();
+	zassert_not_null(ev_tab[0], "Freed block not reused");
+
+	for (size_t i = 0; i < cnt; i++) {
+		app_event_manager_free(ev_tab[i]);
+	}
+
+	zassert_ok(app_event_manager_slab_stats_get(idx, &stats));
+	zassert_equal(stats.num_used, before.num_used, "Blocks not freed");
+
+	/* Events with dynamic data are allocated from the heap. */
+	heap_alloc_cnt = app_event_manager_slab_heap_alloc_cnt();
+	ev_dyn = new_test_dynamic_event(10);
+	zassert_not_null(ev_dyn, "Event with dynamic data not allocated");
+	zassert_equal(app_event_manager_slab_heap_alloc_cnt(), heap_alloc_cnt + 1,
+		      "Event with dynamic data not allocated from the heap");
+	app_event_manager_free(ev_dyn);
+}
+
 ZTEST_SUITE(suite0, NULL, test_init, NULL, NULL, NULL);
 
 static bool app_event_handler(const struct app_event_header *aeh)
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "filter_event.h"
+
+/* Targets of the submitted events are A, B, C, A, B, C, A. */
+#define FILTER_EVENT_CNT 7
+#define FILTER_EVENT_A_CNT 3
+#define FILTER_EVENT_B_CNT 2
+#define FILTER_EVENT_C_CNT 2
+
+static int consumer_cnt;
+static int a_cnt;
+static int bc_cnt;
+static int final_cnt;
+static struct app_event_manager_listener_stats stats_start;
+
+static bool app_event_handler_start(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		if (st->test_id != TEST_SUBSCRIBER_FILTER) {
+			return false;
+		}
+
+		consumer_cnt = 0;
+		a_cnt = 0;
+		bc_cnt = 0;
+		final_cnt = 0;
+		app_event_manager_listener_stats_get(APP_EVENT_ID(filter_event), &stats_start);
+
+		for (size_t i = 0; i < FILTER_EVENT_CNT; i++) {
+			struct filter_event *event = new_filter_event();
+
+			event->seq = i;
+			event->target = i % FILTER_TARGET_CNT;
+			APP_EVENT_SUBMIT(event);
+		}
+
+		return false;
+	}
+
+	if (is_test_end_event(aeh)) {
+		struct test_end_event *te = cast_test_end_event(aeh);
+		struct app_event_manager_listener_stats stats;
+
+		if (te->test_id != TEST_SUBSCRIBER_FILTER) {
+			return false;
+		}
+
+		app_event_manager_listener_stats_get(APP_EVENT_ID(filter_event), &stats);
+
+		zassert_equal(stats.event_cnt - stats_start.event_cnt, FILTER_EVENT_CNT,
+			      "Wrong number of processed events");
+		zassert_equal(stats.notified_cnt - stats_start.notified_cnt,
+			      2 * FILTER_EVENT_A_CNT + 2 * FILTER_EVENT_B_CNT + FILTER_EVENT_C_CNT,
+			      "Wrong number of notifications");
+		zassert_equal(stats.not_consumed_cnt - stats_start.not_consumed_cnt,
+			      2 * FILTER_EVENT_A_CNT + 2 * FILTER_EVENT_B_CNT,
+			      "Wrong number of notifications without consuming");
+		zassert_equal(stats.filtered_cnt - stats_start.filtered_cnt,
+			      2 * FILTER_EVENT_A_CNT + 2 * FILTER_EVENT_B_CNT,
+			      "Wrong number of filtered listeners");
+
+		return false;
+	}
+
+	zassert_true(false, "Wrong event type received");
+	return false;
+}
+
+APP_EVENT_LISTENER(filter_start, app_event_handler_start);
+APP_EVENT_SUBSCRIBE_EARLY(filter_start, test_start_event);
+APP_EVENT_SUBSCRIBE_EARLY(filter_start, test_end_event);
+
+
+static bool app_event_handler_consumer(const struct app_event_header *aeh)
+{
+	struct filter_event *event = cast_filter_event(aeh);
+
+	zassert_not_null(event, "Wrong event type received");
+	zassert_equal(event->target, FILTER_TARGET_C, "Event not filtered");
+	consumer_cnt++;
+
+	return true;
+}
+
+APP_EVENT_LISTENER(filter_consumer, app_event_handler_consumer);
+APP_EVENT_SUBSCRIBE_EARLY_FILTERED(filter_consumer, filter_event, target,
+				   APP_EVENT_FILTER_VALUES(FILTER_TARGET_C));
+
+
+static bool app_event_handler_a(const struct app_event_header *aeh)
+{
+	struct filter_event *event = cast_filter_event(aeh);
+
+	zassert_not_null(event, "Wrong event type received");
+	zassert_equal(event->target, FILTER_TARGET_A, "Event not filtered");
+	a_cnt++;
+
+	return false;
+}
+
+APP_EVENT_LISTENER(filter_a, app_event_handler_a);
+APP_EVENT_SUBSCRIBE_FILTERED(filter_a, filter_event, target,
+			     APP_EVENT_FILTER_VALUES(FILTER_TARGET_A));
+
+
+static bool app_event_handler_bc(const struct app_event_header *aeh)
+{
+	struct filter_event *event = cast_filter_event(aeh);
+
+	zassert_not_null(event, "Wrong event type received");
+	zassert_equal(event->target, FILTER_TARGET_B,
+		      "Event not filtered or not consumed by earlier listener");
+	bc_cnt++;
+
+	return false;
+}
+
+APP_EVENT_LISTENER(filter_bc, app_event_handler_bc);
+APP_EVENT_SUBSCRIBE_FILTERED(filter_bc, filter_event, target,
+			     APP_EVENT_FILTER_VALUES(FILTER_TARGET_B, FILTER_TARGET_C));
+
+
+static bool app_event_handler_final(const struct app_event_header *aeh)
+{
+	struct filter_event *event = cast_filter_event(aeh);
+
+	zassert_not_null(event, "Wrong event type received");
+	zassert_not_equal(event->target, FILTER_TARGET_C, "Consumed event received");
+	final_cnt++;
+
+	if (event->seq == FILTER_EVENT_CNT - 1) {
+		zassert_equal(consumer_cnt, FILTER_EVENT_C_CNT, "Wrong consumer notifications");
+		zassert_equal(a_cnt, FILTER_EVENT_A_CNT, "Wrong filtered notifications");
+		zassert_equal(bc_cnt, FILTER_EVENT_B_CNT, "Wrong filtered notifications");
+		zassert_equal(final_cnt, FILTER_EVENT_A_CNT + FILTER_EVENT_B_CNT,
+			      "Wrong unfiltered notifications");
+
+		struct test_end_event *te = new_test_end_event();
+
+		te->test_id = TEST_SUBSCRIBER_FILTER;
+		APP_EVENT_SUBMIT(te);
+	}
+
+	return false;
+}
+
+APP_EVENT_LISTENER(filter_final, app_event_handler_final);
+APP_EVENT_SUBSCRIBE(filter_final, filter_event);
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "lane_events.h"
+
+#define MODULE test_lanes
+
+#define LANE_LOW_EVENT_CNT 3
+#define LANE_NORMAL_EVENT_CNT 2
+#define LANE_HIGH_EVENT_CNT 2
+#define LANE_EVENT_CNT (LANE_LOW_EVENT_CNT + LANE_NORMAL_EVENT_CNT + LANE_HIGH_EVENT_CNT)
+
+struct lane_record {
+	enum app_event_lane lane;
+	int seq;
+};
+
+static struct lane_record records[LANE_EVENT_CNT];
+static size_t record_cnt;
+
+static void lane_record(enum app_event_lane lane, int seq)
+{
+	zassert_true(record_cnt < ARRAY_SIZE(records), "Too many events processed");
+	records[record_cnt].lane = lane;
+	records[record_cnt].seq = seq;
+	record_cnt++;
+}
+
+static void lanes_test_start(void)
+{
+	record_cnt = 0;
+
+	/* Submitted in the reverse order of priority, while the system workqueue processes
+	 * the test start event, so none of them is processed before all are submitted.
+	 */
+	for (int i = 0; i < LANE_LOW_EVENT_CNT; i++) {
+		struct lane_low_event *event = new_lane_low_event();
+
+		event->seq = i;
+		APP_EVENT_SUBMIT(event);
+	}
+
+	for (int i = 0; i < LANE_NORMAL_EVENT_CNT; i++) {
+		struct lane_normal_event *event = new_lane_normal_event();
+
+		event->seq = i;
+		APP_EVENT_SUBMIT(event);
+	}
+
+	for (int i = 0; i < LANE_HIGH_EVENT_CNT; i++) {
+		struct lane_high_event *event = new_lane_high_event();
+
+		event->seq = i;
+		APP_EVENT_SUBMIT(event);
+	}
+}
+
+static void lanes_test_check(void)
+{
+	static const struct lane_record expected[] = {
+		{APP_EVENT_LANE_HIGH, 0},
+		{APP_EVENT_LANE_HIGH, 1},
+		{APP_EVENT_LANE_NORMAL, 0},
+		{APP_EVENT_LANE_NORMAL, 1},
+		{APP_EVENT_LANE_LOW, 0},
+		{APP_EVENT_LANE_LOW, 1},
+		{APP_EVENT_LANE_LOW, 2},
+	};
+
+	BUILD_ASSERT(ARRAY_SIZE(expected) == LANE_EVENT_CNT);
+
+	for (size_t i = 0; i < ARRAY_SIZE(expected); i++) {
+		zassert_equal(records[i].lane, expected[i].lane,
+			      "Event %zu processed in the wrong order", i);
+		zassert_equal(records[i].seq, expected[i].seq,
+			      "Events of the same lane reordered at %zu", i);
+	}
+
+	struct test_end_event *et = new_test_end_event();
+
+	et->test_id = TEST_LANES;
+	APP_EVENT_SUBMIT(et);
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		if (st->test_id == TEST_LANES) {
+			lanes_test_start();
+		}
+
+		return false;
+	}
+
+	if (is_lane_high_event(aeh)) {
+		zassert_equal(app_event_get_type_lane(aeh->type_id), APP_EVENT_LANE_HIGH);
+		lane_record(APP_EVENT_LANE_HIGH, cast_lane_high_event(aeh)->seq);
+		return false;
+	}
+
+	if (is_lane_normal_event(aeh)) {
+		zassert_equal(app_event_get_type_lane(aeh->type_id), APP_EVENT_LANE_NORMAL);
+		lane_record(APP_EVENT_LANE_NORMAL, cast_lane_normal_event(aeh)->seq);
+		return false;
+	}
+
+	if (is_lane_low_event(aeh)) {
+		zassert_equal(app_event_get_type_lane(aeh->type_id), APP_EVENT_LANE_LOW);
+		lane_record(APP_EVENT_LANE_LOW, cast_lane_low_event(aeh)->seq);
+		if (record_cnt == LANE_EVENT_CNT) {
+			lanes_test_check();
+		}
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, lane_high_event);
+APP_EVENT_SUBSCRIBE(MODULE, lane_normal_event);
+APP_EVENT_SUBSCRIBE(MODULE, lane_low_event);
@@ -50,7 +50,7 @@ DEFINE_FAKE_VALUE_FUNC(int, data_fifo_pointer_first_vacant_get, struct data_fifo
 DEFINE_FAKE_VALUE_FUNC(int, data_fifo_block_lock, struct data_fifo *, void **, size_t);
 DEFINE_FAKE_VALUE_FUNC(int, data_fifo_pointer_last_filled_get, struct data_fifo *, void **,
 		       size_t *, k_timeout_t);
-DEFINE_FAKE_VOID_FUNC2(data_fifo_block_free, struct data_fifo *, void *);
+DEFINE_FAKE_VALUE_FUNC2(int, data_fifo_block_free, struct data_fifo *, void *);
 DEFINE_FAKE_VALUE_FUNC(int, data_fifo_num_used_get, struct data_fifo *, uint32_t *, uint32_t *);
 DEFINE_FAKE_VALUE_FUNC(int, data_fifo_empty, struct data_fifo *);
 DEFINE_FAKE_VALUE_FUNC(int, data_fifo_uninit, struct data_fifo *);
@@ -200,7 +200,7 @@ int fake_data_fifo_pointer_last_filled_get__timeout_fails(struct data_fifo *data
 	return -EAGAIN;
 }
 
-void fake_data_fifo_block_free__succeeds(struct data_fifo *data_fifo, void *data)
+int fake_data_fifo_block_free__succeeds(struct data_fifo *data_fifo, void *data)
 {
 	ARG_UNUSED(data);
 
@@ -211,6 +211,8 @@ void fake_data_fifo_block_free__succeeds(struct data_fifo *data_fifo, void *data
 
 	k_sem_give(&test_fifo_slab_data->sem);
 	test_fifo_slab_data->tail = (test_fifo_slab_data->tail + 1) % test_fifo_slab_data->size;
+
+	return 0;
 }
 
 int fake_data_fifo_num_used_get__succeeds(struct data_fifo *data_fifo, uint32_t *alloced_num,
@@ -19,7 +19,7 @@ DECLARE_FAKE_VALUE_FUNC(int, data_fifo_pointer_first_vacant_get, struct data_fif
 DECLARE_FAKE_VALUE_FUNC(int, data_fifo_block_lock, struct data_fifo *, void **, size_t);
 DECLARE_FAKE_VALUE_FUNC(int, data_fifo_pointer_last_filled_get, struct data_fifo *, void **,
 			size_t *, k_timeout_t);
-DECLARE_FAKE_VOID_FUNC2(data_fifo_block_free, struct data_fifo *, void *);
+DECLARE_FAKE_VALUE_FUNC2(int, data_fifo_block_free, struct data_fifo *, void *);
 DECLARE_FAKE_VALUE_FUNC(int, data_fifo_num_used_get, struct data_fifo *, uint32_t *, uint32_t *);
 DECLARE_FAKE_VALUE_FUNC(int, data_fifo_empty, struct data_fifo *);
 DECLARE_FAKE_VALUE_FUNC(int, data_fifo_uninit, struct data_fifo *);
@@ -60,7 +60,7 @@ int fake_data_fifo_pointer_last_filled_get__no_wait_fails(struct data_fifo *data
 							  size_t *size, k_timeout_t timeout);
 int fake_data_fifo_pointer_last_filled_get__timeout_fails(struct data_fifo *data_fifo, void **data,
 							  size_t *size, k_timeout_t timeout);
-void fake_data_fifo_block_free__succeeds(struct data_fifo *data_fifo, void *data);
+int fake_data_fifo_block_free__succeeds(struct data_fifo *data_fifo, void *data);
 int fake_data_fifo_num_used_get__succeeds(struct data_fifo *data_fifo, uint32_t *alloced_num,
 					  uint32_t *locked_num);
 int fake_data_fifo_num_used_get__fails(struct data_fifo *data_fifo, uint32_t *alloced_num,
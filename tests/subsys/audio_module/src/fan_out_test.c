@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include "audio_module/audio_module.h"
+
+#include "audio_module_test_fakes.h"
+#include "audio_module_test_common.h"
+
+/* Number of output modules connected to the input module. */
+#define FO_OUTPUTS_NUM (FAKE_FIFO_NUM)
+/* Number of audio data items sent through the graph. */
+#define FO_BLOCKS_NUM  (100)
+/* Number of audio data items in flight, limited by the depth of the output RX FIFOs. */
+#define FO_CREDITS_NUM (FAKE_FIFO_MSG_QUEUE_SIZE - 1)
+/* Number of blocks in the input data slab. This covers the items in flight, the item the input
+ * module allocates while waiting for a credit and the items still being released.
+ */
+#define FO_SLAB_BLOCKS (2 * (FO_CREDITS_NUM + 1))
+
+struct fo_context {
+	uint32_t seq;
+};
+
+K_THREAD_STACK_ARRAY_DEFINE(fo_stacks, FO_OUTPUTS_NUM + 1, TEST_MOD_THREAD_STACK_SIZE);
+K_MEM_SLAB_DEFINE(fo_data_slab, TEST_MOD_DATA_SIZE, FO_SLAB_BLOCKS, 4);
+
+static struct data_fifo fo_fifo_rx[FO_OUTPUTS_NUM];
+static struct audio_module_handle fo_handle_in;
+static struct audio_module_handle fo_handles_out[FO_OUTPUTS_NUM];
+static struct fo_context fo_context_in;
+static struct fo_context fo_contexts_out[FO_OUTPUTS_NUM];
+static struct mod_config fo_config;
+
+/* Number of output modules that have processed each audio data item in flight. */
+static atomic_t fo_outputs_done[FO_SLAB_BLOCKS];
+
+static K_SEM_DEFINE(fo_credit_sem, 0, FO_CREDITS_NUM);
+static K_SEM_DEFINE(fo_done_sem, 0, 1);
+
+static int fo_config_set_function(struct audio_module_handle_private *handle,
+				  struct audio_module_configuration const *const configuration)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(configuration);
+
+	return 0;
+}
+
+static int fo_config_get_function(struct audio_module_handle_private const *const handle,
+				  struct audio_module_configuration *configuration)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(configuration);
+
+	return 0;
+}
+
+static int fo_input_process_function(struct audio_module_handle_private *handle,
+				     struct audio_data const *const audio_data_rx,
+				     struct audio_data *audio_data_tx)
+{
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct fo_context *ctx = (struct fo_context *)hdl->context;
+
+	ARG_UNUSED(audio_data_rx);
+
+	if (ctx->seq == FO_BLOCKS_NUM) {
+		/* All the audio data has been sent, park the input module. */
+		k_sleep(K_FOREVER);
+	}
+
+	k_sem_take(&fo_credit_sem, K_FOREVER);
+
+	*(uint32_t *)audio_data_tx->data = ctx->seq;
+	ctx->seq += 1;
+
+	return 0;
+}
+
+static int fo_output_process_function(struct audio_module_handle_private *handle,
+				      struct audio_data const *const audio_data_rx,
+				      struct audio_data *audio_data_tx)
+{
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct fo_context *ctx = (struct fo_context *)hdl->context;
+	uint32_t seq = *(uint32_t *)audio_data_rx->data;
+	atomic_t *done = &fo_outputs_done[seq % FO_SLAB_BLOCKS];
+
+	ARG_UNUSED(audio_data_tx);
+
+	zassert_equal(seq, ctx->seq, "Module %s got audio data %d, expected %d", hdl->name, seq,
+		      ctx->seq);
+	ctx->seq += 1;
+
+	if (atomic_inc(done) == FO_OUTPUTS_NUM - 1) {
+		/* All the output modules are done with this audio data. */
+		atomic_clear(done);
+
+		if (seq == FO_BLOCKS_NUM - 1) {
+			k_sem_give(&fo_done_sem);
+		} else {
+			k_sem_give(&fo_credit_sem);
+		}
+	}
+
+	return 0;
+}
+
+static const struct audio_module_functions fo_ft_in = {
+	.configuration_set = fo_config_set_function,
+	.configuration_get = fo_config_get_function,
+	.data_process = fo_input_process_function};
+static const struct audio_module_functions fo_ft_out = {
+	.configuration_set = fo_config_set_function,
+	.configuration_get = fo_config_get_function,
+	.data_process = fo_output_process_function};
+static const struct audio_module_description fo_description_in = {
+	.name = "FO input", .type = AUDIO_MODULE_TYPE_INPUT, .functions = &fo_ft_in};
+static const struct audio_module_description fo_description_out = {
+	.name = "FO output", .type = AUDIO_MODULE_TYPE_OUTPUT, .functions = &fo_ft_out};
+
+ZTEST(suite_audio_module_fan_out, test_fan_out_release)
+{
+	int ret;
+	struct audio_module_parameters parameters = {
+		.thread = {.stack_size = TEST_MOD_THREAD_STACK_SIZE,
+			   .priority = TEST_MOD_THREAD_PRIORITY,
+			   .data_slab = &fo_data_slab,
+			   .data_size = TEST_MOD_DATA_SIZE}};
+
+	data_fifo_init_fake.custom_fake = fake_data_fifo_init__succeeds;
+	data_fifo_uninit_fake.custom_fake = fake_data_fifo_uninit__succeeds;
+	data_fifo_empty_fake.custom_fake = fake_data_fifo_empty__succeeds;
+	data_fifo_pointer_first_vacant_get_fake.custom_fake =
+		fake_data_fifo_pointer_first_vacant_get__succeeds;
+	data_fifo_block_lock_fake.custom_fake = fake_data_fifo_block_lock__succeeds;
+	data_fifo_pointer_last_filled_get_fake.custom_fake =
+		fake_data_fifo_pointer_last_filled_get__succeeds;
+	data_fifo_block_free_fake.custom_fake = fake_data_fifo_block_free__succeeds;
+	data_fifo_state_fake.custom_fake = fake_data_fifo_state__succeeds;
+
+	fake_fifo_counter_reset();
+
+	parameters.description = &fo_description_out;
+
+	for (int i = 0; i < FO_OUTPUTS_NUM; i++) {
+		parameters.thread.stack = fo_stacks[i + 1];
+		parameters.thread.msg_rx = &fo_fifo_rx[i];
+
+		ret = audio_module_open(&parameters,
+					(struct audio_module_configuration *)&fo_config,
+					"FO output",
+					(struct audio_module_context *)&fo_contexts_out[i],
+					&fo_handles_out[i]);
+		zassert_equal(ret, 0, "Open function did not return successfully: ret %d", ret);
+
+		ret = audio_module_start(&fo_handles_out[i]);
+		zassert_equal(ret, 0, "Start function did not return successfully: ret %d", ret);
+	}
+
+	parameters.description = &fo_description_in;
+	parameters.thread.stack = fo_stacks[0];
+	parameters.thread.msg_rx = NULL;
+
+	ret = audio_module_open(&parameters, (struct audio_module_configuration *)&fo_config,
+				"FO input", (struct audio_module_context *)&fo_context_in,
+				&fo_handle_in);
+	zassert_equal(ret, 0, "Open function did not return successfully: ret %d", ret);
+
+	for (int i = 0; i < FO_OUTPUTS_NUM; i++) {
+		ret = audio_module_connect(&fo_handle_in, &fo_handles_out[i], false);
+		zassert_equal(ret, 0, "Connect function did not return successfully: ret %d",
+			      ret);
+	}
+
+	ret = audio_module_start(&fo_handle_in);
+	zassert_equal(ret, 0, "Start function did not return successfully: ret %d", ret);
+
+	for (int i = 0; i < FO_CREDITS_NUM; i++) {
+		k_sem_give(&fo_credit_sem);
+	}
+
+	ret = k_sem_take(&fo_done_sem, K_SECONDS(10));
+	zassert_equal(ret, 0, "Audio data not received by all output modules: ret %d", ret);
+
+	/* Let the last output module release its reference. */
+	k_sleep(K_MSEC(10));
+
+	/* Only the item allocated by the parked input module is still in use. */
+	zassert_equal(k_mem_slab_num_used_get(&fo_data_slab), 1,
+		      "Audio data not released, %d items in use",
+		      k_mem_slab_num_used_get(&fo_data_slab));
+
+	for (int i = 0; i < FO_OUTPUTS_NUM; i++) {
+		zassert_equal(fo_contexts_out[i].seq, FO_BLOCKS_NUM,
+			      "Module %d received %d audio data items", i, fo_contexts_out[i].seq);
+	}
+
+	ret = audio_module_stop(&fo_handle_in);
+	zassert_equal(ret, 0, "Stop function did not return successfully: ret %d", ret);
+
+	ret = audio_module_close(&fo_handle_in);
+	zassert_equal(ret, 0, "Close function did not return successfully: ret %d", ret);
+
+	for (int i = 0; i < FO_OUTPUTS_NUM; i++) {
+		ret = audio_module_stop(&fo_handles_out[i]);
+		zassert_equal(ret, 0, "Stop function did not return successfully: ret %d", ret);
+
+		ret = audio_module_close(&fo_handles_out[i]);
+		zassert_equal(ret, 0, "Close function did not return successfully: ret %d", ret);
+	}
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <bluetooth/conn_ctx.h>
+
+#define CONN_CNT CONFIG_BT_MAX_CONN
+#define LOOKUPS_NUM 10000
+
+struct test_ctx {
+	uint32_t conn_id;
+	uint8_t report[20];
+};
+
+BT_CONN_CTX_DEF(test, CONN_CNT, sizeof(struct test_ctx));
+
+/** Mocks ******************************************/
+
+struct bt_conn {
+	uint8_t index;
+};
+
+static struct bt_conn conns[CONN_CNT];
+static struct bt_conn other_conn = {
+	.index = CONN_CNT,
+};
+
+uint8_t bt_conn_index(const struct bt_conn *conn)
+{
+	return conn->index;
+}
+
+/** Test helpers ***********************************/
+
+static void ctx_alloc(struct bt_conn *conn)
+{
+	struct test_ctx *ctx = bt_conn_ctx_alloc(&test_ctx_lib, conn);
+
+	zassert_not_null(ctx, "No context for connection %u", conn->index);
+	ctx->conn_id = conn->index;
+	bt_conn_ctx_release(&test_ctx_lib, ctx);
+}
+
+static void ctx_check(struct bt_conn *conn)
+{
+	struct test_ctx *ctx = bt_conn_ctx_get(&test_ctx_lib, conn);
+
+	zassert_not_null(ctx, "No context for connection %u", conn->index);
+	zassert_equal(ctx->conn_id, conn->index);
+	bt_conn_ctx_release(&test_ctx_lib, ctx);
+}
+
+/* Cycles of a context lookup, as done on each notification */
+static uint32_t lookup_cycles(struct bt_conn *conn)
+{
+	struct test_ctx *ctx;
+	uint32_t start;
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < LOOKUPS_NUM; i++) {
+		ctx = bt_conn_ctx_get(&test_ctx_lib, conn);
+		if (ctx) {
+			bt_conn_ctx_release(&test_ctx_lib, ctx);
+		}
+	}
+
+	return (k_cycle_get_32() - start) / LOOKUPS_NUM;
+}
+
+static void *setup(void)
+{
+	for (uint8_t i = 0; i < CONN_CNT; i++) {
+		conns[i].index = i;
+	}
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (size_t i = 0; i < ARRAY_SIZE(conns); i++) {
+		ctx_alloc(&conns[i]);
+	}
+}
+
+static void after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bt_conn_ctx_free_all(&test_ctx_lib);
+}
+
+/** Test cases *************************************/
+
+ZTEST(conn_ctx, test_get)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(conns); i++) {
+		ctx_check(&conns[i]);
+	}
+
+	zassert_is_null(bt_conn_ctx_get(&test_ctx_lib, &other_conn));
+}
+
+ZTEST(conn_ctx, test_get_by_id)
+{
+	const struct bt_conn_ctx *ctx;
+
+	for (uint8_t i = 0; i < bt_conn_ctx_count(&test_ctx_lib); i++) {
+		ctx = bt_conn_ctx_get_by_id(&test_ctx_lib, i);
+
+		zassert_not_null(ctx);
+		zassert_equal_ptr(ctx->conn, &conns[i]);
+		zassert_equal(((struct test_ctx *)ctx->data)->conn_id, i);
+		bt_conn_ctx_release(&test_ctx_lib, ctx->data);
+	}
+}
+
+ZTEST(conn_ctx, test_free)
+{
+	struct bt_conn *conn = &conns[CONN_CNT / 2];
+
+	/* The context of a connection is only allocated once. */
+	zassert_is_null(bt_conn_ctx_alloc(&test_ctx_lib, conn));
+
+	zassert_ok(bt_conn_ctx_free(&test_ctx_lib, conn));
+	zassert_is_null(bt_conn_ctx_get(&test_ctx_lib, conn));
+	zassert_is_null(bt_conn_ctx_get_by_id(&test_ctx_lib, conn->index));
+	zassert_equal(bt_conn_ctx_free(&test_ctx_lib, conn), -EINVAL);
+
+	/* The freed memory is used for the next connection. */
+	ctx_alloc(conn);
+	ctx_check(conn);
+
+	for (size_t i = 0; i < ARRAY_SIZE(conns); i++) {
+		ctx_check(&conns[i]);
+	}
+}
+
+ZTEST(conn_ctx, test_lookup_time)
+{
+	uint32_t first = lookup_cycles(&conns[0]);
+	uint32_t last = lookup_cycles(&conns[CONN_CNT - 1]);
+	uint32_t missing;
+
+	zassert_ok(bt_conn_ctx_free(&test_ctx_lib, &conns[CONN_CNT - 1]));
+	missing = lookup_cycles(&conns[CONN_CNT - 1]);
+
+	TC_PRINT("Context lookup with %d connections: first %u ns, last %u ns, missing %u ns\n",
+		 CONN_CNT, k_cyc_to_ns_floor32(first), k_cyc_to_ns_floor32(last),
+		 k_cyc_to_ns_floor32(missing));
+}
+
+ZTEST_SUITE(conn_ctx, NULL, setup, before, after, NULL);
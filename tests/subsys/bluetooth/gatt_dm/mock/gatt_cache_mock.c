@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <string.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/ztest.h>
+
+#include "gatt_cache_mock.h"
+
+#define SETTINGS_ENTRIES 4
+#define SETTINGS_DATA_SIZE 2048
+
+static const bt_addr_le_t peer_addr = {
+	.type = BT_ADDR_LE_RANDOM,
+	.a.val = {0x01, 0x02, 0x03, 0x04, 0x05, 0xc6},
+};
+
+/* Settings of the read mock */
+static struct bt_read_mock {
+	bool bonded;
+	const uint8_t *db_hash;
+	struct bt_conn *conn;
+	struct bt_gatt_read_params *params;
+	struct k_work_delayable work;
+	size_t calls;
+} read_mock_data;
+
+/* Settings storage kept in RAM */
+static struct settings_mock_entry {
+	char name[SETTINGS_MAX_NAME_LEN + 1];
+	uint8_t data[SETTINGS_DATA_SIZE];
+	size_t len;
+} settings_entries[SETTINGS_ENTRIES];
+
+static void bt_gatt_read_work(struct k_work *work)
+{
+	struct bt_gatt_read_params *params = read_mock_data.params;
+
+	if (read_mock_data.db_hash) {
+		(void)params->func(read_mock_data.conn, 0, params, read_mock_data.db_hash,
+				   BT_GATT_CACHE_MOCK_HASH_SIZE);
+	} else {
+		(void)params->func(read_mock_data.conn, BT_ATT_ERR_ATTRIBUTE_NOT_FOUND, params,
+				   NULL, 0);
+	}
+}
+
+void bt_gatt_cache_mock_setup(bool bonded, const uint8_t *db_hash)
+{
+	k_work_init_delayable(&read_mock_data.work, bt_gatt_read_work);
+	read_mock_data.bonded = bonded;
+	read_mock_data.db_hash = db_hash;
+	read_mock_data.calls = 0;
+}
+
+size_t bt_gatt_cache_mock_reads(void)
+{
+	return read_mock_data.calls;
+}
+
+/* Mocked version of the bt_gatt_read, only reading the Database Hash by UUID is expected */
+int bt_gatt_read(struct bt_conn *conn, struct bt_gatt_read_params *params)
+{
+	zassert_equal(params->handle_count, 0, "Unexpected read by handle");
+	zassert_ok(bt_uuid_cmp(params->by_uuid.uuid, BT_UUID_GATT_DB_HASH),
+		   "Unexpected UUID read");
+
+	read_mock_data.conn = conn;
+	read_mock_data.params = params;
+	read_mock_data.calls++;
+
+	k_work_schedule(&read_mock_data.work, K_MSEC(5));
+	return 0;
+}
+
+int __wrap_bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
+{
+	memset(info, 0, sizeof(*info));
+	info->type = BT_CONN_TYPE_LE;
+	info->id = BT_ID_DEFAULT;
+	info->le.dst = &peer_addr;
+
+	return 0;
+}
+
+bool __wrap_bt_addr_le_is_bonded(uint8_t id, const bt_addr_le_t *addr)
+{
+	return read_mock_data.bonded && (id == BT_ID_DEFAULT) &&
+	       !bt_addr_le_cmp(addr, &peer_addr);
+}
+
+static struct settings_mock_entry *settings_entry_find(const char *name)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(settings_entries); i++) {
+		if (settings_entries[i].len && !strcmp(settings_entries[i].name, name)) {
+			return &settings_entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+void bt_gatt_cache_mock_settings_clear(void)
+{
+	memset(settings_entries, 0, sizeof(settings_entries));
+}
+
+size_t bt_gatt_cache_mock_settings_len(const char *name)
+{
+	struct settings_mock_entry *entry = settings_entry_find(name);
+
+	return entry ? entry->len : 0;
+}
+
+int __wrap_settings_save_one(const char *name, const void *value, size_t val_len)
+{
+	struct settings_mock_entry *entry = settings_entry_find(name);
+
+	zassert_true(val_len <= SETTINGS_DATA_SIZE, "Settings entry too long: %zu", val_len);
+
+	/* Saving an empty value deletes the entry. */
+	if (!val_len) {
+		if (entry) {
+			entry->len = 0;
+		}
+
+		return 0;
+	}
+
+	for (size_t i = 0; !entry && (i < ARRAY_SIZE(settings_entries)); i++) {
+		if (!settings_entries[i].len) {
+			entry = &settings_entries[i];
+		}
+	}
+
+	zassert_not_null(entry, "Settings storage full");
+
+	strncpy(entry->name, name, sizeof(entry->name) - 1);
+	memcpy(entry->data, value, val_len);
+	entry->len = val_len;
+
+	return 0;
+}
+
+int __wrap_settings_delete(const char *name)
+{
+	return __wrap_settings_save_one(name, NULL, 0);
+}
+
+static ssize_t settings_mock_read(void *cb_arg, void *data, size_t len)
+{
+	struct settings_mock_entry *entry = cb_arg;
+
+	len = MIN(len, entry->len);
+	memcpy(data, entry->data, len);
+
+	return len;
+}
+
+int __wrap_settings_load_subtree_direct(const char *subtree, settings_load_direct_cb cb,
+					void *param)
+{
+	size_t subtree_len = strlen(subtree);
+
+	for (size_t i = 0; i < ARRAY_SIZE(settings_entries); i++) {
+		struct settings_mock_entry *entry = &settings_entries[i];
+		const char *key;
+
+		if (!entry->len || strncmp(entry->name, subtree, subtree_len)) {
+			continue;
+		}
+
+		if (entry->name[subtree_len] == '\0') {
+			key = NULL;
+		} else if (entry->name[subtree_len] == '/') {
+			key = &entry->name[subtree_len + 1];
+		} else {
+			continue;
+		}
+
+		if (cb(key, entry->len, settings_mock_read, entry, param)) {
+			break;
+		}
+	}
+
+	return 0;
+}
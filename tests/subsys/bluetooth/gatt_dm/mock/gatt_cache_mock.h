@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BT_GATT_CACHE_MOCK_H_
+#define BT_GATT_CACHE_MOCK_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @file
+ * @defgroup bt_gatt_cache_mock API
+ * @{
+ * @brief The API used to setup the mocks used by the discovery cache
+ *
+ * The mocks replace the Database Hash read, the connection information, the bond check
+ * and the settings storage.
+ */
+
+/** Size of the Database Hash. */
+#define BT_GATT_CACHE_MOCK_HASH_SIZE 16
+
+/**
+ * @brief Discovery cache mock setup
+ *
+ * @param bonded  The peer of the connection is bonded.
+ * @param db_hash The Database Hash read from the peer, or NULL if the peer does not
+ *                have the Database Hash characteristic.
+ */
+void bt_gatt_cache_mock_setup(bool bonded, const uint8_t *db_hash);
+
+/**
+ * @brief Number of the Database Hash reads
+ *
+ * @return The number of the bt_gatt_read calls since the mock setup.
+ */
+size_t bt_gatt_cache_mock_reads(void);
+
+/**
+ * @brief Remove all entries from the settings storage.
+ */
+void bt_gatt_cache_mock_settings_clear(void);
+
+/**
+ * @brief Find an entry in the settings storage.
+ *
+ * @param name Name of the entry.
+ *
+ * @return The length of the entry, or 0 if it was not found.
+ */
+size_t bt_gatt_cache_mock_settings_len(const char *name);
+
+/** @} */
+#endif /* BT_GATT_CACHE_MOCK_H_ */
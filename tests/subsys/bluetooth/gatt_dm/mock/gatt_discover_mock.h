@@ -90,5 +90,12 @@
  */
 void bt_gatt_discover_mock_setup(const struct bt_gatt_attr *attr, size_t len);
 
+/**
+ * @brief Number of the bt_gatt_discover calls
+ *
+ * @return The number of the calls since the mock setup.
+ */
+size_t bt_gatt_discover_mock_calls(void);
+
 /** @} */
 #endif /* #define BT_GATT_DISCOVERY_MOCK_H_ */
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <bluetooth/gatt_dm.h>
+#include "../mock/gatt_discover_mock.h"
+#include "../mock/gatt_cache_mock.h"
+
+/* Timeout for the discovery in ms */
+#define SERVICE_DISCOVERY_TIMEOUT 2000
+
+/* Settings key of the DIS cache of the peer used by the mock */
+#define DIS_CACHE_KEY "bt_dm/0/0102030405c61/180a"
+
+static char dummy_conn;
+static K_SEM_DEFINE(cache_discovery_finished, 0, 1);
+static bool peer_bonded;
+
+static const uint8_t db_hash_1[BT_GATT_CACHE_MOCK_HASH_SIZE] = {
+	0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+	0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10,
+};
+
+static const uint8_t db_hash_2[BT_GATT_CACHE_MOCK_HASH_SIZE] = {
+	0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+	0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
+};
+
+static const struct bt_gatt_attr dis_v1[] = {
+	BT_GATT_DISCOVER_MOCK_SERV(1, BT_UUID_DIS, 5),
+	BT_GATT_DISCOVER_MOCK_CHRC(2, BT_UUID_DIS_MODEL_NUMBER, BT_GATT_CHRC_READ),
+	BT_GATT_DISCOVER_MOCK_DESC(3, BT_UUID_DIS_MODEL_NUMBER),
+	BT_GATT_DISCOVER_MOCK_CHRC(4, BT_UUID_DIS_MANUFACTURER_NAME, BT_GATT_CHRC_READ),
+	BT_GATT_DISCOVER_MOCK_DESC(5, BT_UUID_DIS_MANUFACTURER_NAME),
+};
+
+/* The same service after the peer added a characteristic */
+static const struct bt_gatt_attr dis_v2[] = {
+	BT_GATT_DISCOVER_MOCK_SERV(1, BT_UUID_DIS, 7),
+	BT_GATT_DISCOVER_MOCK_CHRC(2, BT_UUID_DIS_MODEL_NUMBER, BT_GATT_CHRC_READ),
+	BT_GATT_DISCOVER_MOCK_DESC(3, BT_UUID_DIS_MODEL_NUMBER),
+	BT_GATT_DISCOVER_MOCK_CHRC(4, BT_UUID_DIS_MANUFACTURER_NAME, BT_GATT_CHRC_READ),
+	BT_GATT_DISCOVER_MOCK_DESC(5, BT_UUID_DIS_MANUFACTURER_NAME),
+	BT_GATT_DISCOVER_MOCK_CHRC(6, BT_UUID_DIS_SERIAL_NUMBER,
+				   BT_GATT_CHRC_READ | BT_GATT_CHRC_NOTIFY),
+	BT_GATT_DISCOVER_MOCK_DESC(7, BT_UUID_DIS_SERIAL_NUMBER),
+};
+
+static void cache_cb_completed(struct bt_gatt_dm *dm, void *context)
+{
+	*(struct bt_gatt_dm **)context = dm;
+	k_sem_give(&cache_discovery_finished);
+}
+
+static void cache_cb_service_not_found(struct bt_conn *conn, void *context)
+{
+	zassert_unreachable("DIS not found");
+}
+
+static void cache_cb_error_found(struct bt_conn *conn, int err, void *context)
+{
+	zassert_unreachable("DIS error found: %d", err);
+}
+
+static struct bt_gatt_dm_cb cache_dis_cb = {
+	.completed         = cache_cb_completed,
+	.service_not_found = cache_cb_service_not_found,
+	.error_found       = cache_cb_error_found
+};
+
+static void attrs_check(struct bt_gatt_dm *dm, const struct bt_gatt_attr *attrs, size_t cnt)
+{
+	const struct bt_gatt_dm_attr *attr = NULL;
+
+	zassert_equal(cnt, bt_gatt_dm_attr_cnt(dm), "Unexpected number of attributes: %zu",
+		      bt_gatt_dm_attr_cnt(dm));
+
+	for (size_t i = 0; i < cnt; i++) {
+		const struct bt_gatt_service_val *service_val;
+		const struct bt_gatt_chrc *chrc;
+
+		attr = i ? bt_gatt_dm_attr_next(dm, attr) : bt_gatt_dm_service_get(dm);
+		zassert_not_null(attr, "Attr handle: %u", attrs[i].handle);
+		zassert_equal(attrs[i].handle, attr->handle, "Attr handle: %u", attr->handle);
+		zassert_ok(bt_uuid_cmp(attrs[i].uuid, attr->uuid), "Attr handle: %u",
+			   attr->handle);
+
+		service_val = bt_gatt_dm_attr_service_val(attr);
+		chrc = bt_gatt_dm_attr_chrc_val(attr);
+
+		if (service_val) {
+			const struct bt_gatt_service_val *expected = attrs[i].user_data;
+
+			zassert_equal(expected->end_handle, service_val->end_handle);
+			zassert_ok(bt_uuid_cmp(expected->uuid, service_val->uuid));
+		} else if (chrc) {
+			const struct bt_gatt_chrc *expected = attrs[i].user_data;
+
+			zassert_equal(expected->properties, chrc->properties);
+			zassert_equal(expected->value_handle, chrc->value_handle);
+			zassert_ok(bt_uuid_cmp(expected->uuid, chrc->uuid));
+		}
+	}
+}
+
+/* Discovers DIS in the given database and checks whether the result came from the cache. */
+static void dis_discover(const struct bt_gatt_attr *attrs, size_t cnt, const uint8_t *db_hash,
+			 bool cached)
+{
+	struct bt_gatt_dm *dm;
+	int err;
+
+	bt_gatt_discover_mock_setup(attrs, cnt);
+	bt_gatt_cache_mock_setup(peer_bonded, db_hash);
+
+	err = bt_gatt_dm_start((struct bt_conn *)&dummy_conn, BT_UUID_DIS, &cache_dis_cb, &dm);
+	zassert_ok(err, "bt_gatt_dm_start finished with error: %d", err);
+
+	err = k_sem_take(&cache_discovery_finished, K_MSEC(SERVICE_DISCOVERY_TIMEOUT));
+	zassert_ok(err, "It seems that no callback function was called: %d", err);
+
+	attrs_check(dm, attrs, cnt);
+
+	/* The Database Hash is only read from bonded peers */
+	zassert_equal(bt_gatt_cache_mock_reads(), peer_bonded ? 1 : 0);
+
+	if (cached) {
+		zassert_equal(bt_gatt_discover_mock_calls(), 0, "Cached attributes not used");
+	} else {
+		zassert_true(bt_gatt_discover_mock_calls() > 0, "Full discovery not run");
+	}
+
+	bt_gatt_dm_data_release(dm);
+
+	/* Wait until the result is stored from the system workqueue */
+	k_work_queue_drain(&k_sys_work_q, false);
+}
+
+static void cache_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&cache_discovery_finished);
+	bt_gatt_cache_mock_settings_clear();
+	peer_bonded = true;
+}
+
+static void cache_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* The other tests run with a peer which is not bonded */
+	bt_gatt_cache_mock_setup(false, NULL);
+}
+
+ZTEST_SUITE(gatt_dm_cache, NULL, NULL, cache_before, cache_after, NULL);
+
+ZTEST(gatt_dm_cache, test_cache_hit)
+{
+	/* Nothing is stored yet */
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), db_hash_1, false);
+	zassert_true(bt_gatt_cache_mock_settings_len(DIS_CACHE_KEY) > 0, "Cache not stored");
+
+	/* The same Database Hash restores the stored attributes */
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), db_hash_1, true);
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), db_hash_1, true);
+}
+
+ZTEST(gatt_dm_cache, test_cache_invalidated)
+{
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), db_hash_1, false);
+
+	/* The peer database changed, the new attributes are discovered and stored */
+	dis_discover(dis_v2, ARRAY_SIZE(dis_v2), db_hash_2, false);
+	dis_discover(dis_v2, ARRAY_SIZE(dis_v2), db_hash_2, true);
+
+	/* Only the last result is kept */
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), db_hash_1, false);
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), db_hash_1, true);
+}
+
+ZTEST(gatt_dm_cache, test_cache_no_db_hash)
+{
+	/* Without the Database Hash the result cannot be validated, so it is not stored */
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), NULL, false);
+	zassert_equal(bt_gatt_cache_mock_settings_len(DIS_CACHE_KEY), 0);
+
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), NULL, false);
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), db_hash_1, false);
+
+	/* Nor is a stored result used */
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), NULL, false);
+}
+
+ZTEST(gatt_dm_cache, test_cache_not_bonded)
+{
+	peer_bonded = false;
+
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), db_hash_1, false);
+	zassert_equal(bt_gatt_cache_mock_settings_len(DIS_CACHE_KEY), 0);
+
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), db_hash_1, false);
+}
+
+ZTEST(gatt_dm_cache, test_cache_corrupted)
+{
+	uint8_t data[1 + BT_GATT_CACHE_MOCK_HASH_SIZE + 3] = {1};
+
+	/* A cache entry with the current version and Database Hash, but truncated attributes */
+	memcpy(&data[1], db_hash_1, sizeof(db_hash_1));
+	data[1 + BT_GATT_CACHE_MOCK_HASH_SIZE] = 2;
+	zassert_ok(settings_save_one(DIS_CACHE_KEY, data, sizeof(data)));
+
+	/* The full discovery replaces the entry */
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), db_hash_1, false);
+	zassert_true(bt_gatt_cache_mock_settings_len(DIS_CACHE_KEY) > sizeof(data));
+
+	dis_discover(dis_v1, ARRAY_SIZE(dis_v1), db_hash_1, true);
+}
@@ -0,0 +1,666 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/uuid.h>
+
+/* Included to test the filter internals */
+#include "scan.c"
+
+#define UUID_16 0x180f
+
+static const bt_addr_le_t addr_a = {
+	.type = BT_ADDR_LE_RANDOM,
+	.a.val = {0x01, 0x02, 0x03, 0x04, 0x05, 0xc6},
+};
+
+/* Same address hash as addr_a: the change of bit 8 of the first word is canceled by the
+ * change of bit 8 of the shifted second word.
+ */
+static const bt_addr_le_t addr_a_collision = {
+	.type = BT_ADDR_LE_RANDOM,
+	.a.val = {0x01, 0x03, 0x03, 0x04, 0x04, 0xc6},
+};
+
+static const bt_addr_le_t addr_a_public = {
+	.type = BT_ADDR_LE_PUBLIC,
+	.a.val = {0x01, 0x02, 0x03, 0x04, 0x05, 0xc6},
+};
+
+static const bt_addr_le_t addr_b = {
+	.type = BT_ADDR_LE_RANDOM,
+	.a.val = {0x11, 0x22, 0x33, 0x44, 0x55, 0xc6},
+};
+
+/* 16-bit UUID in the advertising data. */
+static const uint8_t ad_uuid16[] = {
+	0x03, BT_DATA_UUID16_ALL, BT_UUID_16_ENCODE(UUID_16),
+};
+
+/* The same UUID in its 128-bit form, built on the Bluetooth Base UUID. */
+static const uint8_t ad_uuid128_base[] = {
+	0x11, BT_DATA_UUID128_ALL,
+	BT_UUID_128_ENCODE(UUID_16, 0x0000, 0x1000, 0x8000, 0x00805f9b34fb),
+};
+
+/* A different 128-bit UUID whose words are folded to the same hash as UUID_16. */
+static const uint8_t ad_uuid128_collision[] = {
+	0x11, BT_DATA_UUID128_ALL,
+	BT_UUID_128_ENCODE(0x00000000, 0x0000, 0x0000, 0x0000, UUID_16),
+};
+
+static const uint8_t ad_name[] = {
+	0x02, BT_DATA_FLAGS, BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR,
+	0x05, BT_DATA_NAME_COMPLETE, 'T', 'e', 's', 't',
+};
+
+/* The length of the second field is beyond the end of the data. */
+static const uint8_t ad_malformed[] = {
+	0x02, BT_DATA_FLAGS, BT_LE_AD_GENERAL,
+	0x09, BT_DATA_UUID16_ALL, BT_UUID_16_ENCODE(UUID_16),
+};
+
+static uint32_t match_cnt;
+static uint32_t no_match_cnt;
+
+static void filter_match(struct bt_scan_device_info *device_info,
+			 struct bt_scan_filter_match *match, bool connectable)
+{
+	match_cnt++;
+}
+
+static void filter_no_match(struct bt_scan_device_info *device_info, bool connectable)
+{
+	no_match_cnt++;
+}
+
+BT_SCAN_CB_INIT(test_scan_cb, filter_match, filter_no_match, NULL, NULL);
+
+/* Pass an advertising report to the library, returns true if it matched the filters. */
+static bool report_recv(const bt_addr_le_t *addr, const uint8_t *data, size_t len)
+{
+	struct bt_le_scan_recv_info info = {
+		.addr = addr,
+		.adv_props = BT_GAP_ADV_PROP_CONNECTABLE,
+	};
+	struct net_buf_simple ad;
+	uint32_t matched = match_cnt;
+	uint32_t not_matched = no_match_cnt;
+
+	net_buf_simple_init_with_data(&ad, (void *)data, len);
+
+	scan_recv(&info, &ad);
+
+	/* Each report is notified once */
+	zassert_equal(match_cnt + no_match_cnt, matched + not_matched + 1);
+
+	return match_cnt > matched;
+}
+
+static void uuid_filter_add(uint16_t val)
+{
+	struct bt_uuid_16 uuid = BT_UUID_INIT_16(val);
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, &uuid));
+}
+
+static void *setup(void)
+{
+	bt_scan_init(NULL);
+	bt_scan_cb_register(&test_scan_cb);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bt_scan_filter_remove_all();
+	bt_scan_filter_disable();
+	bt_scan_stats_reset();
+
+	match_cnt = 0;
+	no_match_cnt = 0;
+}
+
+ZTEST(bt_scan, test_addr_collision)
+{
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	zassert_equal(addr_hash(&addr_a), addr_hash(&addr_a_collision));
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr_a));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER, false));
+
+	/* Addresses with the same hash, or the same value but another type, do not match */
+	zassert_true(report_recv(&addr_a, ad_name, sizeof(ad_name)));
+	zassert_false(report_recv(&addr_a_collision, ad_name, sizeof(ad_name)));
+	zassert_false(report_recv(&addr_a_public, ad_name, sizeof(ad_name)));
+	zassert_false(report_recv(&addr_b, ad_name, sizeof(ad_name)));
+
+	/* Both colliding addresses are in the same probe sequence */
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr_a_collision));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr_a_collision));
+	zassert_equal(bt_scan.scan_filters.addr.cnt, 2, "Duplicate filter added");
+
+	zassert_true(report_recv(&addr_a, ad_name, sizeof(ad_name)));
+	zassert_true(report_recv(&addr_a_collision, ad_name, sizeof(ad_name)));
+	zassert_false(report_recv(&addr_a_public, ad_name, sizeof(ad_name)));
+}
+
+ZTEST(bt_scan, test_uuid_collision)
+{
+	struct bt_uuid_128 uuid_collision;
+
+	zassert_true(bt_uuid_create(&uuid_collision.uuid, &ad_uuid128_collision[2], 16));
+
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+	zassert_equal(uuid_hash(BT_UUID_DECLARE_16(UUID_16)), uuid_hash(&uuid_collision.uuid));
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
+	uuid_filter_add(UUID_16);
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_UUID_FILTER, false));
+
+	zassert_true(report_recv(&addr_b, ad_uuid16, sizeof(ad_uuid16)));
+	/* The 128-bit form of a 16-bit UUID is the same UUID */
+	zassert_true(report_recv(&addr_b, ad_uuid128_base, sizeof(ad_uuid128_base)));
+	/* A UUID with the same hash is not */
+	zassert_false(report_recv(&addr_b, ad_uuid128_collision, sizeof(ad_uuid128_collision)));
+}
+
+#if CONFIG_BT_SCAN_FILTER_PRECOMPILED
+ZTEST(bt_scan, test_uuid_probe_sequence)
+{
+	uint16_t vals[CONFIG_BT_SCAN_UUID_CNT + 1];
+	uint8_t ad[4] = {0x03, BT_DATA_UUID16_ALL};
+	uint32_t home;
+	size_t cnt = 0;
+
+	/* UUIDs starting their probe sequence in the same slot */
+	home = uuid_hash(BT_UUID_DECLARE_16(UUID_16)) & (UUID_HASH_SIZE - 1);
+
+	for (uint32_t val = UUID_16; cnt < ARRAY_SIZE(vals); val++) {
+		if ((uuid_hash(BT_UUID_DECLARE_16(val)) & (UUID_HASH_SIZE - 1)) == home) {
+			vals[cnt++] = val;
+		}
+	}
+
+	/* The table is full of filters in a single probe sequence, except for the last UUID */
+	for (size_t i = 0; i < CONFIG_BT_SCAN_UUID_CNT; i++) {
+		uuid_filter_add(vals[i]);
+	}
+
+	zassert_equal(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID,
+					 BT_UUID_DECLARE_16(vals[CONFIG_BT_SCAN_UUID_CNT])),
+		      -ENOMEM);
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_UUID_FILTER, false));
+
+	for (size_t i = 0; i < ARRAY_SIZE(vals); i++) {
+		sys_put_le16(vals[i], &ad[2]);
+
+		zassert_equal(report_recv(&addr_b, ad, sizeof(ad)), i < CONFIG_BT_SCAN_UUID_CNT,
+			      "UUID %04x", vals[i]);
+		zassert_equal(uuid_filter_find(BT_UUID_DECLARE_16(vals[i])),
+			      i < CONFIG_BT_SCAN_UUID_CNT ? (int)i : -ENOENT);
+	}
+}
+
+ZTEST(bt_scan, test_filters_compile)
+{
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_NAME_FILTER | BT_SCAN_UUID_FILTER, false));
+
+	zassert_equal(bt_scan.scan_filters.enabled_cnt, 2);
+	zassert_true(ad_type_check(BT_DATA_NAME_COMPLETE));
+	zassert_true(ad_type_check(BT_DATA_UUID16_SOME));
+	zassert_true(ad_type_check(BT_DATA_UUID32_ALL));
+	zassert_true(ad_type_check(BT_DATA_UUID128_ALL));
+	zassert_false(ad_type_check(BT_DATA_NAME_SHORTENED));
+	zassert_false(ad_type_check(BT_DATA_FLAGS));
+	zassert_false(ad_type_check(BT_DATA_MANUFACTURER_DATA));
+
+	/* Enabling filters again compiles them from scratch */
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER, false));
+
+	zassert_equal(bt_scan.scan_filters.enabled_cnt, 1);
+	zassert_false(ad_type_check(BT_DATA_NAME_COMPLETE));
+	zassert_false(ad_type_check(BT_DATA_UUID16_SOME));
+
+	bt_scan_filter_disable();
+
+	zassert_equal(bt_scan.scan_filters.enabled_cnt, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(bt_scan.scan_filters.ad_types); i++) {
+		zassert_equal(bt_scan.scan_filters.ad_types[i], 0);
+	}
+}
+
+ZTEST(bt_scan, test_prescreen)
+{
+	struct net_buf_simple ad;
+	struct bt_scan_stats stats;
+
+	uuid_filter_add(UUID_16);
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_UUID_FILTER, false));
+
+	net_buf_simple_init_with_data(&ad, (void *)ad_uuid16, sizeof(ad_uuid16));
+	zassert_true(ad_prescreen(&ad));
+	net_buf_simple_init_with_data(&ad, (void *)ad_name, sizeof(ad_name));
+	zassert_false(ad_prescreen(&ad));
+	/* The UUID field is not checked when its length is invalid, as in bt_data_parse() */
+	net_buf_simple_init_with_data(&ad, (void *)ad_malformed, sizeof(ad_malformed));
+	zassert_false(ad_prescreen(&ad));
+	net_buf_simple_init_with_data(&ad, NULL, 0);
+	zassert_false(ad_prescreen(&ad));
+
+	zassert_false(report_recv(&addr_b, ad_name, sizeof(ad_name)));
+	zassert_false(report_recv(&addr_b, ad_malformed, sizeof(ad_malformed)));
+	zassert_true(report_recv(&addr_b, ad_uuid16, sizeof(ad_uuid16)));
+
+	zassert_ok(bt_scan_stats_get(&stats));
+	zassert_equal(stats.reports, 3);
+	zassert_equal(stats.prescreened, 2);
+	zassert_equal(stats.matched, 1);
+
+	/* The address is checked even if the advertising data is not parsed */
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr_a));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER | BT_SCAN_UUID_FILTER, false));
+
+	zassert_true(report_recv(&addr_a, ad_name, sizeof(ad_name)));
+
+	zassert_ok(bt_scan_stats_get(&stats));
+	zassert_equal(stats.prescreened, 3);
+}
+#endif /* CONFIG_BT_SCAN_FILTER_PRECOMPILED */
+
+ZTEST(bt_scan, test_stats_counters)
+{
+	struct bt_scan_stats stats;
+	uint32_t prescreened = IS_ENABLED(CONFIG_BT_SCAN_FILTER_PRECOMPILED) ? 2 : 0;
+
+	zassert_equal(bt_scan_stats_get(NULL), -EINVAL);
+
+	uuid_filter_add(UUID_16);
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr_a));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER | BT_SCAN_UUID_FILTER, true));
+
+	/* Only the report matching both filters matches in the all filters mode */
+	zassert_true(report_recv(&addr_a, ad_uuid16, sizeof(ad_uuid16)));
+	zassert_false(report_recv(&addr_a, ad_name, sizeof(ad_name)));
+	zassert_false(report_recv(&addr_b, ad_uuid16, sizeof(ad_uuid16)));
+	zassert_false(report_recv(&addr_b, ad_name, sizeof(ad_name)));
+
+	zassert_ok(bt_scan_stats_get(&stats));
+	zassert_equal(stats.reports, 4);
+	zassert_equal(stats.prescreened, prescreened);
+	zassert_equal(stats.matched, 1);
+
+	bt_scan_stats_reset();
+
+	zassert_ok(bt_scan_stats_get(&stats));
+	zassert_equal(stats.reports, 0);
+	zassert_equal(stats.prescreened, 0);
+	zassert_equal(stats.matched, 0);
+	zassert_equal(stats.reports_per_sec, 0);
+	zassert_equal(stats.matched_per_sec, 0);
+}
+
+ZTEST(bt_scan, test_stats_rates)
+{
+	struct bt_scan_stats stats;
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &addr_a));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_ADDR_FILTER, false));
+
+	for (int i = 0; i < 20; i++) {
+		(void)report_recv(i % 4 ? &addr_b : &addr_a, ad_name, sizeof(ad_name));
+	}
+
+	/* The rates are measured when a window of one second is complete */
+	zassert_ok(bt_scan_stats_get(&stats));
+	zassert_equal(stats.reports_per_sec, 0);
+
+	k_sleep(K_MSEC(1000));
+
+	zassert_ok(bt_scan_stats_get(&stats));
+	zassert_within(stats.reports_per_sec, 20, 1);
+	zassert_within(stats.matched_per_sec, 5, 1);
+
+	/* No report in the next window */
+	k_sleep(K_MSEC(1000));
+
+	zassert_ok(bt_scan_stats_get(&stats));
+	zassert_equal(stats.reports, 20);
+	zassert_equal(stats.matched, 5);
+	zassert_equal(stats.reports_per_sec, 0);
+	zassert_equal(stats.matched_per_sec, 0);
+}
+
+ZTEST_SUITE(bt_scan, NULL, setup, before, NULL, NULL);
+
+#if CONFIG_BT_SCAN_DEVICE_HASH
+/* 4 entries in 8 slots */
+ADDR_TABLE_DEFINE(test_table, 4);
+
+#define RACE_READERS 2
+#define RACE_STACK_SIZE 1024
+#define RACE_PRIO K_PRIO_PREEMPT(5)
+#define RACE_TIME_MS 500
+
+static K_THREAD_STACK_ARRAY_DEFINE(race_stacks, RACE_READERS + 1, RACE_STACK_SIZE);
+static struct k_thread race_threads[RACE_READERS + 1];
+static atomic_t race_stop;
+static atomic_t race_lookups;
+static atomic_t race_errors;
+
+/* Returns a new random address. */
+static void addr_next(bt_addr_le_t *addr)
+{
+	static uint32_t counter;
+
+	addr->type = BT_ADDR_LE_RANDOM;
+	sys_put_le32(++counter, addr->a.val);
+	addr->a.val[4] = 0x00;
+	addr->a.val[5] = 0xc6;
+}
+
+/* Returns a new address whose probe sequence starts in the given slot of the table. */
+static void addr_with_home(const struct addr_table *table, uint32_t home, bt_addr_le_t *addr)
+{
+	do {
+		addr_next(addr);
+	} while ((addr_hash(addr) & table->slot_mask) != home);
+}
+
+/* Checks if the device is in the table without marking it as seen. */
+static bool table_contains(const struct addr_table *table, const bt_addr_le_t *addr)
+{
+	return table->slots[addr_table_slot_find(table, addr)] != 0;
+}
+
+static uint32_t table_used_slots(const struct addr_table *table)
+{
+	uint32_t cnt = 0;
+
+	for (uint32_t i = 0; i <= table->slot_mask; i++) {
+		cnt += table->slots[i] ? 1 : 0;
+	}
+
+	return cnt;
+}
+
+static void table_slot_remove(struct addr_table *table, const bt_addr_le_t *addr)
+{
+	addr_table_write_begin(table);
+	addr_table_slot_remove(table, addr_table_slot_find(table, addr));
+	addr_table_write_end(table);
+}
+
+static void addr_table_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	addr_table_clear(&test_table);
+	bt_scan_blocklist_clear();
+	bt_scan_conn_attempts_filter_clear();
+}
+
+ZTEST(bt_scan_addr_table, test_slot_remove_wrapped)
+{
+	struct addr_table *table = &test_table;
+	uint32_t last = table->slot_mask;
+	bt_addr_le_t tail[3];
+	bt_addr_le_t head;
+
+	/* Devices at home in the last slot, their probe sequence wraps around to the first slots */
+	for (size_t i = 0; i < ARRAY_SIZE(tail); i++) {
+		addr_with_home(table, last, &tail[i]);
+		zassert_ok(addr_table_add(table, &tail[i]));
+	}
+
+	/* A device at home in the first slot, displaced behind the wrapped ones */
+	addr_with_home(table, 0, &head);
+	zassert_ok(addr_table_add(table, &head));
+
+	zassert_equal(addr_table_slot_find(table, &tail[0]), last);
+	zassert_equal(addr_table_slot_find(table, &tail[1]), 0);
+	zassert_equal(addr_table_slot_find(table, &tail[2]), 1);
+	zassert_equal(addr_table_slot_find(table, &head), 2);
+
+	table_slot_remove(table, &tail[0]);
+
+	/* The whole chain is shifted back across the end of the table, leaving no hole */
+	zassert_false(table_contains(table, &tail[0]));
+	zassert_equal(addr_table_slot_find(table, &tail[1]), last);
+	zassert_equal(addr_table_slot_find(table, &tail[2]), 0);
+	zassert_equal(addr_table_slot_find(table, &head), 1);
+	zassert_equal(table->slots[2], 0);
+	zassert_equal(table_used_slots(table), 3);
+}
+
+ZTEST(bt_scan_addr_table, test_slot_remove_home_slot)
+{
+	struct addr_table *table = &test_table;
+	uint32_t last = table->slot_mask;
+	bt_addr_le_t tail[2];
+	bt_addr_le_t home_1;
+
+	addr_with_home(table, last, &tail[0]);
+	zassert_ok(addr_table_add(table, &tail[0]));
+	addr_with_home(table, 1, &home_1);
+	zassert_ok(addr_table_add(table, &home_1));
+	addr_with_home(table, last, &tail[1]);
+	zassert_ok(addr_table_add(table, &tail[1]));
+
+	/* One chain across the end of the table: tail[0], tail[1], home_1 */
+	zassert_equal(addr_table_slot_find(table, &tail[1]), 0);
+	zassert_equal(addr_table_slot_find(table, &home_1), 1);
+
+	table_slot_remove(table, &tail[0]);
+
+	/* The device in its home slot is not moved before it, leaving the hole in slot 0 */
+	zassert_equal(addr_table_slot_find(table, &tail[1]), last);
+	zassert_equal(addr_table_slot_find(table, &home_1), 1);
+	zassert_equal(table->slots[0], 0);
+	zassert_true(table_contains(table, &home_1));
+	zassert_false(table_contains(table, &tail[0]));
+}
+
+ZTEST(bt_scan_addr_table, test_blocklist_evict)
+{
+	bt_addr_le_t addr[CONFIG_BT_SCAN_BLOCKLIST_LEN + 2];
+	const size_t len = CONFIG_BT_SCAN_BLOCKLIST_LEN;
+
+	for (size_t i = 0; i < ARRAY_SIZE(addr); i++) {
+		addr_next(&addr[i]);
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		zassert_ok(bt_scan_blocklist_device_add(&addr[i]));
+	}
+
+	/* A full blocklist takes the new device instead of failing with -ENOMEM. All devices
+	 * were added since the last sweep, so the sweep goes around and evicts the oldest one.
+	 */
+	zassert_ok(bt_scan_blocklist_device_add(&addr[len]));
+	zassert_equal(blocklist_table.count, len);
+	zassert_false(table_contains(&blocklist_table, &addr[0]));
+
+	for (size_t i = 1; i <= len; i++) {
+		zassert_true(table_contains(&blocklist_table, &addr[i]));
+	}
+
+	/* A device seen since the sweep gets a second chance, the next one is evicted */
+	zassert_true(blocklist_device_check(&addr[1]));
+	zassert_ok(bt_scan_blocklist_device_add(&addr[len + 1]));
+	zassert_true(table_contains(&blocklist_table, &addr[1]));
+	zassert_false(table_contains(&blocklist_table, &addr[2]));
+	zassert_true(table_contains(&blocklist_table, &addr[len]));
+	zassert_true(table_contains(&blocklist_table, &addr[len + 1]));
+	zassert_equal(table_used_slots(&blocklist_table), len);
+
+	/* Adding a device again keeps it */
+	zassert_ok(bt_scan_blocklist_device_add(&addr[1]));
+	zassert_true(table_contains(&blocklist_table, &addr[1]));
+}
+
+ZTEST(bt_scan_addr_table, test_evict_full_chain)
+{
+	struct addr_table *table = &test_table;
+	uint32_t last = table->slot_mask;
+	bt_addr_le_t addr[5];
+
+	/* Fill the table with one chain wrapping around the end of the table */
+	for (size_t i = 0; i < ARRAY_SIZE(addr); i++) {
+		addr_with_home(table, last, &addr[i]);
+	}
+
+	for (size_t i = 0; i < table->capacity; i++) {
+		zassert_ok(addr_table_add(table, &addr[i]));
+	}
+
+	zassert_equal(addr_table_slot_find(table, &addr[4]), 3);
+
+	/* Evicting the first device shifts the chain back, so the new device takes slot 2 */
+	zassert_ok(addr_table_add(table, &addr[4]));
+	zassert_false(table_contains(table, &addr[0]));
+	zassert_equal(addr_table_slot_find(table, &addr[4]), 2);
+	zassert_equal(table->slots[3], 0);
+
+	for (size_t i = 1; i < ARRAY_SIZE(addr); i++) {
+		zassert_true(addr_table_find(table, &addr[i], NULL));
+	}
+}
+
+ZTEST(bt_scan_addr_table, test_conn_attempts_evict)
+{
+	bt_addr_le_t addr[CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER_LEN + 1];
+
+	for (size_t i = 0; i < ARRAY_SIZE(addr); i++) {
+		addr_next(&addr[i]);
+	}
+
+	scan_attempts_filter_device_add(&addr[0]);
+
+	for (size_t i = 0; i < CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT; i++) {
+		zassert_false(conn_attempts_exceeded(&addr[0]));
+		addr_table_value_inc(&attempts_table, &addr[0], CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT);
+	}
+
+	zassert_true(conn_attempts_exceeded(&addr[0]));
+
+	/* The counter saturates */
+	addr_table_value_inc(&attempts_table, &addr[0], CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT);
+	zassert_equal(attempts_table.entries[0].value, CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT);
+
+	/* An evicted device starts counting again */
+	for (size_t i = 1; i < ARRAY_SIZE(addr); i++) {
+		scan_attempts_filter_device_add(&addr[i]);
+	}
+
+	zassert_false(table_contains(&attempts_table, &addr[0]));
+	scan_attempts_filter_device_add(&addr[0]);
+	zassert_false(conn_attempts_exceeded(&addr[0]));
+}
+
+/* Readers look up devices which are always in the table, and one which never is. */
+static void race_reader(void *p1, void *p2, void *p3)
+{
+	const bt_addr_le_t *stable = p1;
+	const bt_addr_le_t *absent = p2;
+	uint16_t value;
+
+	while (!atomic_get(&race_stop)) {
+		for (size_t i = 0; i < 2; i++) {
+			if (!addr_table_find(&test_table, &stable[i], &value) || (value != i + 1)) {
+				atomic_inc(&race_errors);
+			}
+		}
+
+		if (addr_table_find(&test_table, absent, NULL)) {
+			atomic_inc(&race_errors);
+		}
+
+		atomic_inc(&race_lookups);
+		k_yield();
+	}
+}
+
+/* The writer keeps removing and inserting the devices in front of the stable ones in
+ * their probe sequence, so that the backward shift moves the stable devices around.
+ */
+static void race_writer(void *p1, void *p2, void *p3)
+{
+	bt_addr_le_t *churn = p1;
+	struct addr_table *table = &test_table;
+	uint32_t i = 0;
+	uint32_t slot;
+	uint16_t idx;
+
+	while (!atomic_get(&race_stop)) {
+		addr_table_write_begin(table);
+		slot = addr_table_slot_find(table, &churn[i % 2]);
+		idx = table->slots[slot];
+		addr_table_slot_remove(table, slot);
+		table->slots[addr_table_slot_find(table, &churn[i % 2])] = idx;
+		addr_table_write_end(table);
+
+		i++;
+		k_yield();
+	}
+}
+
+ZTEST(bt_scan_addr_table, test_lookup_race)
+{
+	struct addr_table *table = &test_table;
+	static bt_addr_le_t churn[2];
+	static bt_addr_le_t stable[2];
+	static bt_addr_le_t absent;
+
+	/* All devices share the home slot, the chain starts with the churned ones */
+	for (size_t i = 0; i < ARRAY_SIZE(churn); i++) {
+		addr_with_home(table, table->slot_mask, &churn[i]);
+		zassert_ok(addr_table_add(table, &churn[i]));
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(stable); i++) {
+		addr_with_home(table, table->slot_mask, &stable[i]);
+		zassert_ok(addr_table_add(table, &stable[i]));
+		table->entries[table->slots[addr_table_slot_find(table, &stable[i])] - 1].value = i + 1;
+	}
+
+	addr_with_home(table, table->slot_mask, &absent);
+
+	atomic_clear(&race_stop);
+	atomic_clear(&race_lookups);
+	atomic_clear(&race_errors);
+
+	for (size_t i = 0; i < RACE_READERS; i++) {
+		k_thread_create(&race_threads[i], race_stacks[i], RACE_STACK_SIZE, race_reader,
+				stable, &absent, NULL, RACE_PRIO, 0, K_NO_WAIT);
+	}
+
+	k_thread_create(&race_threads[RACE_READERS], race_stacks[RACE_READERS], RACE_STACK_SIZE,
+			race_writer, churn, NULL, NULL, RACE_PRIO, 0, K_NO_WAIT);
+
+	k_sleep(K_MSEC(RACE_TIME_MS));
+	atomic_set(&race_stop, 1);
+
+	for (size_t i = 0; i < ARRAY_SIZE(race_threads); i++) {
+		zassert_ok(k_thread_join(&race_threads[i], K_FOREVER));
+	}
+
+	zassert_true(atomic_get(&race_lookups) > 0);
+	zassert_equal(atomic_get(&race_errors), 0, "%ld failed lookups",
+		      (long)atomic_get(&race_errors));
+	/* The writer left the table consistent */
+	zassert_equal(atomic_get(&table->seq) & 1, 0);
+	zassert_equal(table_used_slots(table), 4);
+}
+
+ZTEST_SUITE(bt_scan_addr_table, NULL, NULL, addr_table_before, NULL, NULL);
+#endif /* CONFIG_BT_SCAN_DEVICE_HASH */
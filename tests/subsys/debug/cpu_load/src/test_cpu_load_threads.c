@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/irq.h>
+#include <debug/cpu_load.h>
+#include <cmsis_core.h>
+
+#define FULL_LOAD 100000
+
+/* Interrupt lines unused by the test, the first one preempts the second one */
+#define IRQ_HIGH (CONFIG_NUM_IRQS - 1)
+#define IRQ_LOW (CONFIG_NUM_IRQS - 2)
+#define IRQ_HIGH_PRIO 1
+#define IRQ_LOW_PRIO 2
+
+#define IRQ_BUSY_US 2000
+
+static void irq_high_handler(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	k_busy_wait(IRQ_BUSY_US);
+}
+
+static void irq_low_handler(const void *arg)
+{
+	ARG_UNUSED(arg);
+
+	k_busy_wait(IRQ_BUSY_US / 2);
+	/* The higher priority interrupt preempts this one as soon as it is pending */
+	NVIC_SetPendingIRQ(IRQ_HIGH);
+	k_busy_wait(IRQ_BUSY_US / 2);
+}
+
+static void *setup(void)
+{
+	IRQ_CONNECT(IRQ_HIGH, IRQ_HIGH_PRIO, irq_high_handler, NULL, 0);
+	IRQ_CONNECT(IRQ_LOW, IRQ_LOW_PRIO, irq_low_handler, NULL, 0);
+	irq_enable(IRQ_HIGH);
+	irq_enable(IRQ_LOW);
+
+	return NULL;
+}
+
+ZTEST(cpu_load_threads, test_cpu_load_threads)
+{
+	struct cpu_load_thread_stat stats[CONFIG_NRF_CPU_LOAD_THREADS_MAX];
+	uint32_t busy_load = 0;
+	uint32_t sum = 0;
+	uint64_t cycles;
+	int cnt;
+
+	cpu_load_stats_reset();
+
+	/* Busy wait for 10 ms and sleep for 10 ms */
+	k_busy_wait(10000);
+	k_sleep(K_MSEC(10));
+
+	cnt = cpu_load_thread_stats_get(stats, ARRAY_SIZE(stats));
+	cycles = cpu_load_stats_cycles_get();
+	zassert_true(cnt >= 2, "Unexpected number of threads:%d", cnt);
+	zassert_true(cycles > 0);
+
+	for (int i = 0; i < cnt; i++) {
+		if (stats[i].thread == k_current_get()) {
+			busy_load = stats[i].load;
+		}
+
+		sum += stats[i].load;
+	}
+
+	zassert_within(busy_load, FULL_LOAD / 2, FULL_LOAD / 10, "Unexpected load:%d", busy_load);
+	/* The idle thread is measured as well, only interrupts are left out. */
+	zassert_within(sum, FULL_LOAD, FULL_LOAD / 10, "Unexpected total load:%d", sum);
+}
+
+ZTEST(cpu_load_threads, test_cpu_load_nested_irqs)
+{
+	struct cpu_load_irq_stat stats[CONFIG_NUM_IRQS];
+	struct cpu_load_thread_stat thread_stats[CONFIG_NRF_CPU_LOAD_THREADS_MAX];
+	uint64_t busy_cycles = k_us_to_cyc_floor64(IRQ_BUSY_US);
+	uint64_t high_cycles = 0;
+	uint64_t low_cycles = 0;
+	uint64_t thread_cycles = 0;
+	int cnt;
+
+	cpu_load_stats_reset();
+
+	/* Both handlers run before the thread continues */
+	NVIC_SetPendingIRQ(IRQ_LOW);
+
+	cnt = cpu_load_irq_stats_get(stats, ARRAY_SIZE(stats));
+
+	for (int i = 0; i < cnt; i++) {
+		zassert_true(stats[i].irq < CONFIG_NUM_IRQS);
+
+		if (stats[i].irq == IRQ_HIGH) {
+			high_cycles = stats[i].cycles;
+		} else if (stats[i].irq == IRQ_LOW) {
+			low_cycles = stats[i].cycles;
+		}
+	}
+
+	cnt = cpu_load_thread_stats_get(thread_stats, ARRAY_SIZE(thread_stats));
+
+	for (int i = 0; i < cnt; i++) {
+		if (thread_stats[i].thread == k_current_get()) {
+			thread_cycles = thread_stats[i].cycles;
+		}
+	}
+
+	zassert_within(high_cycles, busy_cycles, busy_cycles / 5, "Unexpected cycles:%u",
+		       (uint32_t)high_cycles);
+	/* The time of the nested interrupt is not accounted to the preempted one */
+	zassert_within(low_cycles, busy_cycles, busy_cycles / 5, "Unexpected cycles:%u",
+		       (uint32_t)low_cycles);
+	/* nor to the thread after the preempted interrupt returns */
+	zassert_true(thread_cycles < busy_cycles / 5, "Unexpected cycles:%u",
+		     (uint32_t)thread_cycles);
+}
+
+ZTEST_SUITE(cpu_load_threads, NULL, setup, NULL, NULL, NULL);
@@ -23,13 +23,17 @@ enum test_states {
 	EMDS_TS_STORE_DATA,
 	EMDS_TS_CLEAR_FLASH,
 	EMDS_TS_NO_STORE,
-	EMDS_TS_SEVERAL_STORE
+	EMDS_TS_SEVERAL_STORE,
+	EMDS_TS_INCREMENTAL
 };
 
 static int iteration;
 
 /* test scenario */
 static enum test_states state[] = {
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	EMDS_TS_INCREMENTAL,
+#endif
 	EMDS_TS_EMPTY_FLASH,
 	EMDS_TS_STORE_DATA,
 	EMDS_TS_SEVERAL_STORE,
@@ -62,6 +66,14 @@ static uint8_t s_data[1024];
 
 EMDS_STATIC_ENTRY_DEFINE(s_entry, 0x100, s_data, sizeof(s_data));
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+#define T_ENTRY_ID 0x200
+
+static uint8_t t_data[512];
+
+EMDS_STATIC_ENTRY_TRACKED_DEFINE(t_entry, T_ENTRY_ID, t_data, sizeof(t_data));
+#endif
+
 static char *print_state(enum test_states s)
 {
 	switch (s) {
@@ -75,6 +87,8 @@ static char *print_state(enum test_states s)
 		return "SEVERAL_STORE";
 	case EMDS_TS_NO_STORE:
 		return "NO_STORE";
+	case EMDS_TS_INCREMENTAL:
+		return "INCREMENTAL";
 	default:
 		return "UNKNOWN";
 	}
@@ -115,6 +129,10 @@ static void add_d_entries(void)
 	uint32_t store_expected = sizeof(s_data) + sizeof(struct emds_data_entry);
 	uint32_t store_used;
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+	store_expected += sizeof(t_data) + sizeof(struct emds_data_entry);
+#endif
+
 	for (int i = 0; i < ARRAY_SIZE(d_entries); i++) {
 		err = emds_entry_add(&d_entries[i]);
 		store_expected += d_entries[i].entry.len + sizeof(struct emds_data_entry);
@@ -209,6 +227,87 @@ static void clear(void)
 	zassert_equal(emds_clear(), 0, "Clear failed");
 }
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+/* Find the freshest snapshot in flash, independently of the library state */
+static void freshest_snapshot_get(struct emds_snapshot_candidate *freshest,
+				  struct emds_partition *partition)
+{
+	const uint8_t id[] = {FIXED_PARTITION_ID(emds_partition_0),
+			      FIXED_PARTITION_ID(emds_partition_1)};
+	struct emds_partition p;
+	struct emds_snapshot_candidate candidate;
+
+	memset(freshest, 0, sizeof(*freshest));
+
+	for (int i = 0; i < ARRAY_SIZE(id); i++) {
+		zassert_ok(flash_area_open(id[i], &p.fa), "Failed to open flash area");
+		zassert_ok(emds_flash_init(&p), "Failed to initialize flash area");
+
+		memset(&candidate, 0, sizeof(candidate));
+		zassert_ok(emds_flash_scan_partition(&p, &candidate), "Failed to scan partition");
+
+		if (candidate.metadata.fresh_cnt > freshest->metadata.fresh_cnt) {
+			*freshest = candidate;
+			*partition = p;
+		}
+	}
+
+	zassert_not_equal(freshest->metadata.fresh_cnt, 0, "No snapshot found");
+}
+
+/* Find the record of the tracked entry in the freshest snapshot, which must be a delta */
+static bool delta_record_get(struct emds_delta_entry *record, uint32_t *data_len)
+{
+	struct emds_snapshot_candidate freshest;
+	struct emds_partition p;
+	off_t off;
+	off_t end;
+
+	freshest_snapshot_get(&freshest, &p);
+
+	zassert_true(emds_flash_snapshot_is_delta(&freshest.metadata),
+		     "Freshest snapshot is not a delta snapshot");
+
+	*data_len = freshest.metadata.data_instance_len;
+	off = freshest.metadata.data_instance_off;
+	end = off + freshest.metadata.data_instance_len;
+
+	while (off < end) {
+		zassert_ok(flash_area_read(p.fa, off, record, sizeof(*record)),
+			   "Failed to read delta entry");
+		if (record->id == T_ENTRY_ID) {
+			return true;
+		}
+
+		off += sizeof(*record) + record->length;
+	}
+
+	return false;
+}
+
+/* Size of a delta snapshot, in which all the untracked entries are stored in full */
+static uint32_t delta_size(uint32_t t_len)
+{
+	uint32_t size = sizeof(s_data) + sizeof(struct emds_delta_entry);
+
+	for (int i = 0; i < ARRAY_SIZE(d_entries); i++) {
+		size += d_entries[i].entry.len + sizeof(struct emds_delta_entry);
+	}
+
+	if (t_len) {
+		size += t_len + sizeof(struct emds_delta_entry);
+	}
+
+	return size;
+}
+
+static void t_data_write(size_t offset, uint8_t val, size_t len)
+{
+	memset(&t_data[offset], val, len);
+	emds_entry_dirty_mark(&emds_t_entry, offset, len);
+}
+#endif
+
 static bool pragma_always(const void *s)
 {
 	return true;
@@ -249,6 +348,13 @@ static bool pragma_several_store(const void *s)
 	return *state == EMDS_TS_SEVERAL_STORE;
 }
 
+static bool pragma_incremental(const void *s)
+{
+	const enum test_states *state = s;
+
+	return *state == EMDS_TS_INCREMENTAL;
+}
+
 #if CONFIG_SETTINGS
 static int emds_test_settings_set(const char *name, size_t len,
 				  settings_read_cb read_cb, void *cb_arg)
@@ -326,12 +432,81 @@ ZTEST(several_store, test_several_store)
 	load_flash(0);
 }
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+ZTEST(incremental, test_incremental)
+{
+	uint8_t expect_t_data[sizeof(t_data)];
+	struct emds_delta_entry record;
+	uint32_t data_len;
+
+	clear();
+	load_empty_flash();
+
+	/* Without loaded data, a full snapshot is stored */
+	memset(t_data, 0x5A, sizeof(t_data));
+	memcpy(expect_t_data, t_data, sizeof(t_data));
+	prepare();
+	store(0);
+
+	memset(t_data, 0, sizeof(t_data));
+	load_flash(0);
+	zassert_mem_equal(t_data, expect_t_data, sizeof(t_data), "Tracked data not loaded");
+
+	/* Changes of the tracked entry are merged into one region */
+	prepare();
+	t_data_write(16, 0x11, 8);
+	t_data_write(32, 0x22, 8);
+	memcpy(expect_t_data, t_data, sizeof(t_data));
+	store(1);
+
+	zassert_true(delta_record_get(&record, &data_len), "Tracked entry not stored");
+	zassert_equal(record.offset, 16, "Wrong offset of the stored region");
+	zassert_equal(record.length, 24, "Wrong length of the stored region");
+	zassert_equal(data_len, delta_size(24), "Not only the changed data stored");
+
+	memset(t_data, 0, sizeof(t_data));
+	load_flash(1);
+	zassert_mem_equal(t_data, expect_t_data, sizeof(t_data),
+			  "Tracked data not replayed from the delta snapshot");
+
+	/* A tracked entry without changes is not stored */
+	prepare();
+	store(2);
+
+	zassert_false(delta_record_get(&record, &data_len), "Unchanged tracked entry stored");
+	zassert_equal(data_len, delta_size(0), "Unchanged tracked entry stored");
+
+	memset(t_data, 0, sizeof(t_data));
+	load_flash(2);
+	zassert_mem_equal(t_data, expect_t_data, sizeof(t_data),
+			  "Tracked data not replayed from the delta snapshots");
+
+	/* Changes at the end of the entry */
+	prepare();
+	t_data_write(sizeof(t_data) - 4, 0x33, 4);
+	memcpy(expect_t_data, t_data, sizeof(t_data));
+	store(0);
+
+	zassert_true(delta_record_get(&record, &data_len), "Tracked entry not stored");
+	zassert_equal(record.offset, sizeof(t_data) - 4, "Wrong offset of the stored region");
+	zassert_equal(record.length, 4, "Wrong length of the stored region");
+
+	memset(t_data, 0, sizeof(t_data));
+	load_flash(0);
+	zassert_mem_equal(t_data, expect_t_data, sizeof(t_data),
+			  "Tracked data not replayed from the delta snapshots");
+
+	clear();
+}
+#endif
+
 ZTEST_SUITE(_setup, pragma_always, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(empty_flash, pragma_empty_flash, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(store_data, pragma_store_data, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(clear_flash, pragma_clear_flash, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(no_store, pragma_no_store, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(several_store, pragma_several_store, NULL, NULL, NULL, NULL);
+ZTEST_SUITE(incremental, pragma_incremental, NULL, NULL, NULL, NULL);
 
 void test_main(void)
 {
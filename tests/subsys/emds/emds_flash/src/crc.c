@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/random/random.h>
+#include <emds/emds.h>
+#include <emds_flash.h>
+#include <emds_crc.h>
+
+/* 64 kB of tracked data, as two entries, since the length of an entry is stored in 16 bits */
+#define CRC_ENTRY_SIZE (32 * 1024)
+#define CRC_ENTRY_CNT 2
+
+static uint8_t entry_data[CRC_ENTRY_CNT][CRC_ENTRY_SIZE];
+
+EMDS_STATIC_ENTRY_TRACKED_DEFINE(crc_entry_0, 0x10, entry_data[0], CRC_ENTRY_SIZE);
+EMDS_STATIC_ENTRY_TRACKED_DEFINE(crc_entry_1, 0x11, entry_data[1], CRC_ENTRY_SIZE);
+
+static const struct emds_entry *const crc_entries[CRC_ENTRY_CNT] = {
+	&emds_crc_entry_0,
+	&emds_crc_entry_1,
+};
+
+static void entries_fill(void)
+{
+	for (int i = 0; i < CRC_ENTRY_CNT; i++) {
+		sys_rand_get(entry_data[i], CRC_ENTRY_SIZE);
+	}
+}
+
+static void entries_report(void)
+{
+	for (int i = 0; i < CRC_ENTRY_CNT; i++) {
+		emds_entry_dirty_mark(crc_entries[i], 0, CRC_ENTRY_SIZE);
+	}
+}
+
+/* Start from empty storage, so the next snapshot is a full snapshot */
+static void emds_reset(void)
+{
+	int err;
+
+	err = emds_init(NULL);
+	zassert_true(err == 0 || err == -EALREADY, "Initializing failed");
+	zassert_ok(emds_clear(), "Clear failed");
+	zassert_equal(emds_load(), -ENOENT, "Storage not empty");
+}
+
+static uint32_t store_timed(void)
+{
+	uint32_t start;
+	uint32_t cycles;
+	unsigned int key;
+
+	key = irq_lock();
+	start = k_cycle_get_32();
+	zassert_ok(emds_store(), "Store failed");
+	cycles = k_cycle_get_32() - start;
+	irq_unlock(key);
+
+	return cycles;
+}
+
+/* Check the snapshot CRC in flash against a full calculation over the data in flash */
+static void snapshot_check(void)
+{
+	const uint8_t id[] = {FIXED_PARTITION_ID(emds_partition_0),
+			      FIXED_PARTITION_ID(emds_partition_1)};
+	struct emds_snapshot_candidate freshest = {0};
+	struct emds_snapshot_candidate candidate;
+	struct emds_partition p;
+	struct emds_partition freshest_p;
+	uint8_t chunk[64];
+	uint32_t crc = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(id); i++) {
+		zassert_ok(flash_area_open(id[i], &p.fa), "Failed to open flash area");
+		zassert_ok(emds_flash_init(&p), "Failed to initialize flash area");
+
+		memset(&candidate, 0, sizeof(candidate));
+		zassert_ok(emds_flash_scan_partition(&p, &candidate), "Failed to scan partition");
+
+		if (candidate.metadata.fresh_cnt > freshest.metadata.fresh_cnt) {
+			freshest = candidate;
+			freshest_p = p;
+		}
+	}
+
+	zassert_not_equal(freshest.metadata.fresh_cnt, 0, "No valid snapshot stored");
+	zassert_false(emds_flash_snapshot_is_delta(&freshest.metadata), "Not a full snapshot");
+	zassert_equal(freshest.metadata.data_instance_len,
+		      CRC_ENTRY_CNT * (CRC_ENTRY_SIZE + sizeof(struct emds_data_entry)),
+		      "Wrong snapshot length");
+
+	for (size_t off = 0; off < freshest.metadata.data_instance_len; off += sizeof(chunk)) {
+		size_t len = MIN(sizeof(chunk), freshest.metadata.data_instance_len - off);
+
+		zassert_ok(flash_area_read(freshest_p.fa,
+					   freshest.metadata.data_instance_off + off, chunk, len),
+			   "Failed to read snapshot");
+		crc = crc32_k_4_2_update(crc, chunk, len);
+	}
+
+	zassert_equal(freshest.metadata.snapshot_crc, crc,
+		      "Snapshot CRC differs from the CRC of the stored data");
+}
+
+static void load_check(void)
+{
+	uint32_t crc[CRC_ENTRY_CNT];
+
+	for (int i = 0; i < CRC_ENTRY_CNT; i++) {
+		crc[i] = crc32_ieee(entry_data[i], CRC_ENTRY_SIZE);
+		memset(entry_data[i], 0, CRC_ENTRY_SIZE);
+	}
+
+	zassert_ok(emds_load(), "Load failed");
+
+	for (int i = 0; i < CRC_ENTRY_CNT; i++) {
+		zassert_equal(crc32_ieee(entry_data[i], CRC_ENTRY_SIZE), crc[i],
+			      "Wrong data loaded for entry %d", i);
+	}
+}
+
+ZTEST(emds_crc, test_crc_combine)
+{
+	const size_t sizes[] = {1, 3, 16, 255, 1000};
+	uint32_t shift[EMDS_CRC_SHIFT_WORDS];
+	uint32_t crc_a;
+	uint32_t crc_b;
+
+	sys_rand_get(entry_data[0], 2 * 1000);
+
+	for (int i = 0; i < ARRAY_SIZE(sizes); i++) {
+		crc_a = crc32_k_4_2_update(0, entry_data[0], 1000);
+		crc_b = crc32_k_4_2_update(0, &entry_data[0][1000], sizes[i]);
+		emds_crc_shift_init(shift, sizes[i]);
+
+		zassert_equal(emds_crc_combine(crc_a, crc_b, shift),
+			      crc32_k_4_2_update(crc_a, &entry_data[0][1000], sizes[i]),
+			      "Wrong combined CRC for %zu bytes", sizes[i]);
+	}
+
+	/* Moving a CRC over no data leaves it unchanged */
+	emds_crc_shift_init(shift, 0);
+	zassert_equal(emds_crc_combine(crc_a, 0, shift), crc_a);
+}
+
+ZTEST(emds_crc, test_crc_cache_store)
+{
+	uint32_t direct_cycles;
+	uint32_t cached_cycles;
+	unsigned int key;
+
+	/* The CRCs of changes reported after preparing are recalculated in the system workqueue */
+	emds_reset();
+	zassert_ok(emds_prepare(), "Prepare failed");
+	entries_fill();
+	entries_report();
+	k_sleep(K_MSEC(CONFIG_EMDS_CRC_CACHE_DELAY_MS + 100));
+	cached_cycles = store_timed();
+
+	snapshot_check();
+	load_check();
+
+	/* Changes reported with interrupts locked are not recalculated before the store, so the
+	 * store calculates the CRCs in place.
+	 */
+	emds_reset();
+	zassert_ok(emds_prepare(), "Prepare failed");
+	entries_fill();
+	key = irq_lock();
+	entries_report();
+	direct_cycles = store_timed();
+	irq_unlock(key);
+
+	snapshot_check();
+	load_check();
+
+	zassert_true(cached_cycles < direct_cycles, "Store not shortened by the cached CRCs");
+
+	TC_PRINT("%u bytes full snapshot: stored in %u us, with cached CRCs in %u us\n",
+		 CRC_ENTRY_CNT * CRC_ENTRY_SIZE, k_cyc_to_us_floor32(direct_cycles),
+		 k_cyc_to_us_floor32(cached_cycles));
+
+	zassert_ok(emds_clear(), "Clear failed");
+}
+
+ZTEST_SUITE(emds_crc, NULL, NULL, NULL, NULL, NULL);
@@ -44,9 +44,12 @@
 #endif
 
 #define EMDS_SNAPSHOT_METADATA_MARKER 0x4D444553
+#define EMDS_SNAPSHOT_DELTA_MARKER 0x4D444544
 #define PARTITIONS_NUM_MAX 2
 
 static struct emds_partition partition[PARTITIONS_NUM_MAX];
+/* Marker of the snapshots made by snapshot_make() */
+static uint32_t snapshot_marker = EMDS_SNAPSHOT_METADATA_MARKER;
 
 /* Configure for 1MHz (1μs precision) */
 #if defined(CONFIG_SOC_NRF54L15)
@@ -102,6 +105,8 @@ static void emds_flash_partitions_erase(void *fixture)
 {
 	(void)fixture;
 
+	snapshot_marker = EMDS_SNAPSHOT_METADATA_MARKER;
+
 	for (int i = 0; i < PARTITIONS_NUM_MAX; i++) {
 		zassert_ok(emds_flash_erase_partition(&partition[i]),
 			   "Failed to erase partition %d", i);
@@ -127,8 +132,8 @@ snapshot_make(const struct emds_partition *partition,
 						      partition->fp->write_block_size);
 	} else {
 		memset(&metadata, 0, sizeof(metadata));
-		metadata.marker = EMDS_SNAPSHOT_METADATA_MARKER;
 	}
+	metadata.marker = snapshot_marker;
 	metadata.data_instance_len = data_len;
 	metadata.fresh_cnt = fresh_cnt;
 
@@ -569,6 +574,113 @@ ZTEST(emds_flash, test_allocation_if_data_garbaged)
 		      "Metadata CRC is not equal to calculated one");
 }
 
+#if defined(CONFIG_EMDS_INCREMENTAL)
+/* Test checks that a delta snapshot is found together with the snapshots it is built on. */
+ZTEST(emds_flash, test_scanning_delta_chain)
+{
+	struct emds_snapshot_candidate candidate;
+	int partition_index = sys_rand32_get() % PARTITIONS_NUM_MAX;
+	struct emds_snapshot_metadata *metadata = NULL;
+	off_t metadata_off = partition[partition_index].fa->fa_size;
+	uint32_t fresh_cnt = 0;
+
+	candidate.metadata.fresh_cnt = 0;
+	for (int i = 0; i < 3; i++) {
+		snapshot_marker = i ? EMDS_SNAPSHOT_DELTA_MARKER : EMDS_SNAPSHOT_METADATA_MARKER;
+		metadata_off -= sizeof(struct emds_snapshot_metadata);
+		fresh_cnt++;
+		metadata = snapshot_make(&partition[partition_index], metadata, metadata_off, true,
+					 true, fresh_cnt);
+		zassert_not_null(metadata, "Failed to create snapshot on partition %d",
+				 partition_index);
+	}
+
+	zassert_ok(emds_flash_scan_partition(&partition[partition_index], &candidate),
+		   "Failed to scan partition %d", partition_index);
+	zassert_equal(candidate.metadata.fresh_cnt, 3, "Fresh count mismatch");
+	zassert_equal(candidate.metadata_off, metadata_off, "Metadata offset mismatch");
+	zassert_equal(candidate.chain_len, 2, "Chain length mismatch");
+	zassert_true(emds_flash_snapshot_is_delta(&candidate.metadata), "Snapshot is not delta");
+}
+
+/* Test checks that delta snapshots built on a broken snapshot are ignored. */
+ZTEST(emds_flash, test_scanning_delta_chain_broken)
+{
+	struct emds_snapshot_candidate candidate;
+	int partition_index = sys_rand32_get() % PARTITIONS_NUM_MAX;
+	struct emds_snapshot_metadata *metadata = NULL;
+	off_t metadata_off = partition[partition_index].fa->fa_size;
+
+	candidate.metadata.fresh_cnt = 0;
+	metadata_off -= sizeof(struct emds_snapshot_metadata);
+	metadata = snapshot_make(&partition[partition_index], metadata, metadata_off, true, true,
+				 1);
+	zassert_not_null(metadata, "Failed to create snapshot on partition %d", partition_index);
+
+	snapshot_marker = EMDS_SNAPSHOT_DELTA_MARKER;
+	metadata_off -= sizeof(struct emds_snapshot_metadata);
+	metadata = snapshot_make(&partition[partition_index], metadata, metadata_off, true, false,
+				 2);
+	zassert_not_null(metadata, "Failed to create snapshot on partition %d", partition_index);
+
+	metadata_off -= sizeof(struct emds_snapshot_metadata);
+	metadata = snapshot_make(&partition[partition_index], metadata, metadata_off, true, true,
+				 3);
+	zassert_not_null(metadata, "Failed to create snapshot on partition %d", partition_index);
+
+	zassert_ok(emds_flash_scan_partition(&partition[partition_index], &candidate),
+		   "Failed to scan partition %d", partition_index);
+	zassert_equal(candidate.metadata.fresh_cnt, 1, "Fresh count mismatch");
+	zassert_equal(candidate.chain_len, 0, "Chain length mismatch");
+	zassert_false(emds_flash_snapshot_is_delta(&candidate.metadata), "Snapshot is delta");
+}
+
+/* Test checks that a delta snapshot without a full snapshot is ignored. */
+ZTEST(emds_flash, test_scanning_delta_without_full)
+{
+	struct emds_snapshot_candidate candidate;
+	int partition_index = sys_rand32_get() % PARTITIONS_NUM_MAX;
+	off_t metadata_off = partition[partition_index].fa->fa_size;
+
+	candidate.metadata.fresh_cnt = 0;
+	snapshot_marker = EMDS_SNAPSHOT_DELTA_MARKER;
+	metadata_off -= sizeof(struct emds_snapshot_metadata);
+	zassert_not_null(snapshot_make(&partition[partition_index], NULL, metadata_off, true, true,
+				       1),
+			 "Failed to create snapshot on partition %d", partition_index);
+
+	zassert_ok(emds_flash_scan_partition(&partition[partition_index], &candidate),
+		   "Failed to scan partition %d", partition_index);
+	zassert_equal(candidate.metadata.fresh_cnt, 0, "Fresh count mismatch");
+}
+
+/* Test checks that the allocated snapshot can be turned into a delta snapshot. */
+ZTEST(emds_flash, test_allocation_delta_update)
+{
+	int partition_index = sys_rand32_get() % PARTITIONS_NUM_MAX;
+	struct emds_snapshot_candidate allocated_snapshot = {
+		.partition_index = partition_index,
+		.metadata.fresh_cnt = 1,
+	};
+
+	zassert_ok(emds_flash_allocate_snapshot(&partition[partition_index], NULL,
+						&allocated_snapshot, 100),
+		   "Failed to allocate snapshot on partition %d", partition_index);
+	zassert_false(emds_flash_snapshot_is_delta(&allocated_snapshot.metadata),
+		      "Allocated snapshot is delta");
+
+	emds_flash_snapshot_update(&allocated_snapshot, true, 42);
+	zassert_true(emds_flash_snapshot_is_delta(&allocated_snapshot.metadata),
+		     "Updated snapshot is not delta");
+	zassert_equal(allocated_snapshot.metadata.data_instance_len, 42,
+		      "Data instance length is not equal to the updated one");
+	zassert_equal(allocated_snapshot.metadata.metadata_crc,
+		      crc32_k_4_2_update(0, (const unsigned char *)&allocated_snapshot.metadata,
+					 offsetof(struct emds_snapshot_metadata, metadata_crc)),
+		      "Metadata CRC is not equal to calculated one");
+}
+#endif /* CONFIG_EMDS_INCREMENTAL */
+
 /* Test measures write timings. */
 ZTEST(emds_flash, test_write_speed)
 {
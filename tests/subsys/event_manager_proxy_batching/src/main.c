@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ipc/ipc_service.h>
+#include <zephyr/ipc/ipc_service_backend.h>
+
+#include <app_event_manager.h>
+#include <event_manager_proxy.h>
+
+#define BATCH_SIZE CONFIG_EVENT_MANAGER_PROXY_BATCH_SIZE
+#define FLUSH_INTERVAL_MS CONFIG_EVENT_MANAGER_PROXY_BATCH_FLUSH_INTERVAL_MS
+/* Time given to the system workqueue to process the submitted events */
+#define PROCESS_TIME_MS 10
+#define MSG_MAX 8
+
+/* Event type ID given by the remote when it subscribes */
+#define REMOTE_EVENT_ID ((const struct event_type *)0x12345678)
+
+/* Commands of the proxy protocol, as sent by the remote */
+enum emp_cmd_code {
+	EMP_CMD_SUBSCRIBE,
+	EMP_CMD_START,
+};
+
+struct emp_cmd {
+	enum emp_cmd_code code;
+};
+
+struct emp_cmd_subscribe {
+	enum emp_cmd_code code;
+	const struct event_type *id;
+	char name[];
+};
+
+struct test_batch_event {
+	struct app_event_header header;
+	uint32_t value;
+};
+
+APP_EVENT_TYPE_DECLARE(test_batch_event);
+APP_EVENT_TYPE_DEFINE(test_batch_event, NULL, NULL, APP_EVENT_FLAGS_CREATE());
+
+#define RECORD_SIZE (sizeof(uint32_t) + ROUND_UP(sizeof(struct test_batch_event), sizeof(uint32_t)))
+/* Number of events after which a batch is full */
+#define BATCH_EVENTS (BATCH_SIZE / RECORD_SIZE)
+
+/* Messages sent by the proxy through the fake IPC service backend */
+static uint32_t msg_buf[MSG_MAX][BATCH_SIZE / sizeof(uint32_t)];
+static size_t msg_len[MSG_MAX];
+static atomic_t msg_cnt;
+
+static const struct ipc_ept_cfg *ept_cfg;
+static uint32_t event_value;
+
+static int fake_ipc_send(const struct device *instance, void *token, const void *data,
+			 size_t len)
+{
+	atomic_val_t idx = atomic_get(&msg_cnt);
+
+	zassert_true(idx < MSG_MAX, "Too many messages");
+	zassert_true(len <= sizeof(msg_buf[idx]), "Message too long: %zu", len);
+
+	memcpy(msg_buf[idx], data, len);
+	msg_len[idx] = len;
+	atomic_inc(&msg_cnt);
+
+	return len;
+}
+
+static int fake_ipc_register_endpoint(const struct device *instance,
+				      const struct ipc_ept_cfg *cfg, void **token)
+{
+	ept_cfg = cfg;
+	*token = (void *)cfg;
+
+	cfg->cb.bound(cfg->priv);
+
+	return 0;
+}
+
+static const struct ipc_service_backend fake_ipc_backend = {
+	.send = fake_ipc_send,
+	.register_endpoint = fake_ipc_register_endpoint,
+};
+
+DEVICE_DEFINE(fake_ipc, "fake_ipc", NULL, NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &fake_ipc_backend);
+
+static void remote_cmd_receive(const void *data, size_t len)
+{
+	ept_cfg->cb.received(data, len, ept_cfg->priv);
+}
+
+static void remote_subscribe(const struct event_type *et)
+{
+	size_t size = sizeof(struct emp_cmd_subscribe) + strlen(et->name) + 1;
+	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
+	struct emp_cmd_subscribe *cmd = (struct emp_cmd_subscribe *)buffer;
+
+	cmd->code = EMP_CMD_SUBSCRIBE;
+	cmd->id = REMOTE_EVENT_ID;
+	strcpy(cmd->name, et->name);
+
+	remote_cmd_receive(buffer, sizeof(buffer));
+}
+
+static void events_submit(size_t cnt)
+{
+	for (size_t i = 0; i < cnt; i++) {
+		struct test_batch_event *event = new_test_batch_event();
+
+		event->value = event_value++;
+		APP_EVENT_SUBMIT(event);
+	}
+}
+
+/* Check that a sent message holds the given number of consecutive events */
+static void msg_check(size_t idx, size_t events_cnt, uint32_t first_value)
+{
+	const uint8_t *pos = (const uint8_t *)msg_buf[idx];
+
+	zassert_equal(msg_len[idx], events_cnt * RECORD_SIZE, "Unexpected message length %zu",
+		      msg_len[idx]);
+
+	for (size_t i = 0; i < events_cnt; i++) {
+		uint32_t size;
+		struct test_batch_event event;
+
+		memcpy(&size, pos, sizeof(size));
+		memcpy(&event, pos + sizeof(size), sizeof(event));
+
+		zassert_equal(size, sizeof(struct test_batch_event), "Unexpected event size");
+		zassert_equal_ptr(event.header.type_id, REMOTE_EVENT_ID,
+				  "Event type not mapped to the remote one");
+		zassert_equal(event.value, first_value + i, "Unexpected event order");
+
+		pos += RECORD_SIZE;
+	}
+}
+
+static void *batching_setup(void)
+{
+	const struct device *ipc_instance = DEVICE_GET(fake_ipc);
+	const struct emp_cmd start_cmd = {.code = EMP_CMD_START};
+	int ret;
+
+	BUILD_ASSERT(BATCH_EVENTS >= 2, "Test event does not fit twice in a batch");
+
+	ret = app_event_manager_init();
+	zassert_ok(ret, "Event manager init failed (%d)", ret);
+
+	ret = event_manager_proxy_add_remote(ipc_instance);
+	zassert_ok(ret, "Cannot add remote (%d)", ret);
+
+	remote_subscribe(APP_EVENT_ID(test_batch_event));
+
+	ret = event_manager_proxy_start();
+	zassert_ok(ret, "Cannot start event manager proxy (%d)", ret);
+
+	remote_cmd_receive(&start_cmd, sizeof(start_cmd));
+
+	ret = event_manager_proxy_wait_for_remotes(K_NO_WAIT);
+	zassert_ok(ret, "Remote not started (%d)", ret);
+
+	return NULL;
+}
+
+static void batching_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	atomic_clear(&msg_cnt);
+	event_value = 0;
+}
+
+static void batching_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Let the last batch of the test go out. */
+	k_sleep(K_MSEC(2 * FLUSH_INTERVAL_MS));
+}
+
+ZTEST(suite_event_manager_proxy_batching, test_events_batched)
+{
+	events_submit(2);
+
+	k_sleep(K_MSEC(FLUSH_INTERVAL_MS + PROCESS_TIME_MS));
+
+	zassert_equal(atomic_get(&msg_cnt), 1, "Events not sent in one message");
+	msg_check(0, 2, 0);
+}
+
+ZTEST(suite_event_manager_proxy_batching, test_timeout_flush)
+{
+	events_submit(1);
+
+	k_sleep(K_MSEC(FLUSH_INTERVAL_MS / 2));
+	zassert_equal(atomic_get(&msg_cnt), 0, "Batch sent before the flush interval");
+
+	events_submit(1);
+
+	/* The interval runs from the first event of the batch. */
+	k_sleep(K_MSEC(FLUSH_INTERVAL_MS / 2 + PROCESS_TIME_MS));
+	zassert_equal(atomic_get(&msg_cnt), 1, "Batch not sent after the flush interval");
+	msg_check(0, 2, 0);
+}
+
+ZTEST(suite_event_manager_proxy_batching, test_size_flush)
+{
+	events_submit(1);
+
+	k_sleep(K_MSEC(FLUSH_INTERVAL_MS / 2));
+
+	/* Fill the batch, and start the next one. */
+	events_submit(BATCH_EVENTS);
+
+	k_sleep(K_MSEC(PROCESS_TIME_MS));
+	zassert_equal(atomic_get(&msg_cnt), 1, "Full batch not sent");
+	msg_check(0, BATCH_EVENTS, 0);
+
+	/* The flush scheduled for the full batch must not send the next one. */
+	k_sleep(K_MSEC(FLUSH_INTERVAL_MS / 2 + PROCESS_TIME_MS));
+	zassert_equal(atomic_get(&msg_cnt), 1, "Next batch sent before its flush interval");
+
+	k_sleep(K_MSEC(FLUSH_INTERVAL_MS / 2));
+	zassert_equal(atomic_get(&msg_cnt), 2, "Next batch not sent after the flush interval");
+	msg_check(1, 1, BATCH_EVENTS);
+}
+
+ZTEST_SUITE(suite_event_manager_proxy_batching, NULL, batching_setup, batching_before,
+	    batching_after, NULL);
@@ -106,6 +106,18 @@
 "Vary: Accept-Encoding\r\n" \
 "X-Cache: HIT\r\n\r\n"
 
+#define HTTP_HDR_OK_SPLIT_LINE_1 "HTTP/1.1 200 OK\r\n" \
+"Content-Len"
+
+#define HTTP_HDR_OK_SPLIT_LINE_2 \
+"gth: 128\r\n\r\n"
+
+#define HTTP_HDR_OK_SPLIT_STATUS_1 "HTTP/1.1 20"
+
+#define HTTP_HDR_OK_SPLIT_STATUS_2 \
+"0 OK\r\n" \
+"Content-Length: 128\r\n\r\n"
+
 #define HTTPS_HDR_OK_PARTIAL_CONTENT_1 \
 "HTTP/1.1 206 Partial Content\r\n" \
 "Date: Tue, 21 Jan 2025 12:08:23 GMT\r\n" \
@@ -150,6 +162,24 @@
 "Vary: Accept-Encoding\r\n" \
 "X-Cache: HIT\r\n\r\n"
 
+#define HTTPS_HDR_OK_PIPELINED_1 \
+"HTTP/1.1 206 Partial Content\r\n" \
+"Content-Length: 32\r\n" \
+"Content-Range: bytes 0-31/96\r\n\r\n"
+
+#define HTTPS_HDR_OK_PIPELINED_2 \
+"HTTP/1.1 206 Partial Content\r\n" \
+"Content-Length: 32\r\n" \
+"Content-Range: bytes 32-63/96\r\n\r\n"
+
+#define HTTPS_HDR_OK_PIPELINED_3_1 \
+"HTTP/1.1 206 Partial Content\r\n" \
+"Content-Len"
+
+#define HTTPS_HDR_OK_PIPELINED_3_2 \
+"gth: 32\r\n" \
+"Content-Range: bytes 64-95/96\r\n\r\n"
+
 #define HTTP_HDR_REDIRECT "HTTP/1.1 308 Permanent Redirect\r\n" \
 "Date: Wed, 29 Jan 2025 11:16:09 GMT\r\n" \
 "Content-Type: text/html\r\n" \
@@ -216,6 +246,11 @@ struct downloader_transport_http_cfg dl_http_cfg = {
 	.sock_recv_timeo_ms = 60000,
 };
 
+struct downloader_transport_http_cfg dl_http_cfg_pipelined = {
+	.sock_recv_timeo_ms = 60000,
+	.pipeline_depth = 2,
+};
+
 DEFINE_FFF_GLOBALS;
 
 FAKE_VALUE_FUNC(int, z_impl_zsock_setsockopt, int, int, int, const void *, net_socklen_t);
@@ -796,6 +831,22 @@ ssize_t z_impl_zsock_sendto_ok(int sock, const void *buf, size_t len, int flags,
 	return len;
 }
 
+ssize_t z_impl_zsock_sendto_pipelined_ranges(int sock, const void *buf, size_t len, int flags,
+			   const struct net_sockaddr *dest_addr, net_socklen_t addrlen)
+{
+	static const char * const ranges[] = {
+		"Range: bytes=0-31\r\n",
+		"Range: bytes=32-63\r\n",
+		"Range: bytes=64-95\r\n",
+	};
+
+	TEST_ASSERT_EQUAL(FD, sock);
+	TEST_ASSERT(z_impl_zsock_sendto_fake.call_count <= ARRAY_SIZE(ranges));
+	/* The requests are formatted in place, so they are null-terminated */
+	TEST_ASSERT_NOT_NULL(strstr(buf, ranges[z_impl_zsock_sendto_fake.call_count - 1]));
+	return len;
+}
+
 static ssize_t z_impl_zsock_recvfrom_http_header_then_data(
 	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
 	net_socklen_t *addrlen)
@@ -835,6 +886,48 @@ static ssize_t z_impl_zsock_recvfrom_http_partial_header_then_header_with_data(
 	return 0;
 }
 
+static ssize_t z_impl_zsock_recvfrom_http_split_line_stale_newline(
+	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
+	net_socklen_t *addrlen)
+{
+	TEST_ASSERT_EQUAL(FD, sock);
+	TEST_ASSERT(sizeof(dl_buf) >= max_len);
+
+	switch (z_impl_zsock_recvfrom_fake.call_count) {
+	case 1:
+		memcpy(buf, HTTP_HDR_OK_SPLIT_LINE_1, strlen(HTTP_HDR_OK_SPLIT_LINE_1));
+		/* Stale line ending just past the received data */
+		((char *)buf)[strlen(HTTP_HDR_OK_SPLIT_LINE_1)] = '\n';
+		return strlen(HTTP_HDR_OK_SPLIT_LINE_1);
+	case 2:
+		memcpy(buf, HTTP_HDR_OK_SPLIT_LINE_2, strlen(HTTP_HDR_OK_SPLIT_LINE_2));
+		memset((char *)buf + strlen(HTTP_HDR_OK_SPLIT_LINE_2), 23, 128);
+		return strlen(HTTP_HDR_OK_SPLIT_LINE_2) + 128;
+	}
+
+	return 0;
+}
+
+static ssize_t z_impl_zsock_recvfrom_http_split_status_line(
+	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
+	net_socklen_t *addrlen)
+{
+	TEST_ASSERT_EQUAL(FD, sock);
+	TEST_ASSERT(sizeof(dl_buf) >= max_len);
+
+	switch (z_impl_zsock_recvfrom_fake.call_count) {
+	case 1:
+		memcpy(buf, HTTP_HDR_OK_SPLIT_STATUS_1, strlen(HTTP_HDR_OK_SPLIT_STATUS_1));
+		return strlen(HTTP_HDR_OK_SPLIT_STATUS_1);
+	case 2:
+		memcpy(buf, HTTP_HDR_OK_SPLIT_STATUS_2, strlen(HTTP_HDR_OK_SPLIT_STATUS_2));
+		memset((char *)buf + strlen(HTTP_HDR_OK_SPLIT_STATUS_2), 23, 128);
+		return strlen(HTTP_HDR_OK_SPLIT_STATUS_2) + 128;
+	}
+
+	return 0;
+}
+
 static ssize_t z_impl_zsock_recvfrom_https_partial_content(
 	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
 	net_socklen_t *addrlen)
@@ -890,6 +983,67 @@ static ssize_t z_impl_zsock_recvfrom_https_partial_content_partial_2nd_header(
 	return 0;
 }
 
+static ssize_t z_impl_zsock_recvfrom_https_pipelined(
+	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
+	net_socklen_t *addrlen)
+{
+	size_t len = 0;
+
+	TEST_ASSERT_EQUAL(FD, sock);
+	TEST_ASSERT(sizeof(dl_buf) >= max_len);
+
+	switch (z_impl_zsock_recvfrom_fake.call_count) {
+	case 1:
+		memcpy(buf, HTTPS_HDR_OK_PIPELINED_1, strlen(HTTPS_HDR_OK_PIPELINED_1));
+		memset((char *)buf + strlen(HTTPS_HDR_OK_PIPELINED_1), 23, 32);
+		return strlen(HTTPS_HDR_OK_PIPELINED_1) + 32;
+	case 2:
+		/* Both pipelined responses at once */
+		memcpy(buf, HTTPS_HDR_OK_PIPELINED_2, strlen(HTTPS_HDR_OK_PIPELINED_2));
+		len += strlen(HTTPS_HDR_OK_PIPELINED_2);
+		memset((char *)buf + len, 24, 32);
+		len += 32;
+		memcpy((char *)buf + len, HTTPS_HDR_OK_PIPELINED_3_1,
+		       strlen(HTTPS_HDR_OK_PIPELINED_3_1));
+		len += strlen(HTTPS_HDR_OK_PIPELINED_3_1);
+		memcpy((char *)buf + len, HTTPS_HDR_OK_PIPELINED_3_2,
+		       strlen(HTTPS_HDR_OK_PIPELINED_3_2));
+		len += strlen(HTTPS_HDR_OK_PIPELINED_3_2);
+		memset((char *)buf + len, 25, 32);
+		return len + 32;
+	}
+
+	return 0;
+}
+
+static ssize_t z_impl_zsock_recvfrom_https_pipelined_split_header(
+	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
+	net_socklen_t *addrlen)
+{
+	TEST_ASSERT_EQUAL(FD, sock);
+	TEST_ASSERT(sizeof(dl_buf) >= max_len);
+
+	switch (z_impl_zsock_recvfrom_fake.call_count) {
+	case 1:
+		memcpy(buf, HTTPS_HDR_OK_PIPELINED_1, strlen(HTTPS_HDR_OK_PIPELINED_1));
+		memset((char *)buf + strlen(HTTPS_HDR_OK_PIPELINED_1), 23, 32);
+		return strlen(HTTPS_HDR_OK_PIPELINED_1) + 32;
+	case 2:
+		/* Second response, and the beginning of the header of the third one */
+		memcpy(buf, HTTPS_HDR_OK_PIPELINED_2, strlen(HTTPS_HDR_OK_PIPELINED_2));
+		memset((char *)buf + strlen(HTTPS_HDR_OK_PIPELINED_2), 24, 32);
+		memcpy((char *)buf + strlen(HTTPS_HDR_OK_PIPELINED_2) + 32,
+		       HTTPS_HDR_OK_PIPELINED_3_1, strlen(HTTPS_HDR_OK_PIPELINED_3_1));
+		return strlen(HTTPS_HDR_OK_PIPELINED_2) + 32 + strlen(HTTPS_HDR_OK_PIPELINED_3_1);
+	case 3:
+		memcpy(buf, HTTPS_HDR_OK_PIPELINED_3_2, strlen(HTTPS_HDR_OK_PIPELINED_3_2));
+		memset((char *)buf + strlen(HTTPS_HDR_OK_PIPELINED_3_2), 25, 32);
+		return strlen(HTTPS_HDR_OK_PIPELINED_3_2) + 32;
+	}
+
+	return 0;
+}
+
 static ssize_t z_impl_zsock_recvfrom_http_header_and_payload(
 	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
 	net_socklen_t *addrlen)
@@ -1404,6 +1558,73 @@ void test_downloader_get_http_partial_header(void)
 	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
 }
 
+void test_downloader_get_http_split_line_stale_newline(void)
+{
+	int err;
+	struct downloader_evt evt;
+	size_t len = 0;
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ipv6_fail_ipv4_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv4;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_http_ipv4_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv4_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_http_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_ok;
+	z_impl_zsock_recvfrom_fake.custom_fake =
+		z_impl_zsock_recvfrom_http_split_line_stale_newline;
+
+	err = downloader_get(&dl, &dl_host_cfg, HTTP_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* The Content-Length line is parsed once complete, so the file size is known */
+	do {
+		evt = dl_wait_for_event(DOWNLOADER_EVT_FRAGMENT, K_SECONDS(3));
+		len += evt.fragment.len;
+	} while (len < 128);
+
+	TEST_ASSERT_EQUAL(128, len);
+	evt = dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
+void test_downloader_get_http_split_status_line(void)
+{
+	int err;
+	struct downloader_evt evt;
+	size_t len = 0;
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ipv6_fail_ipv4_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv4;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_http_ipv4_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv4_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_http_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_ok;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_http_split_status_line;
+
+	err = downloader_get(&dl, &dl_host_cfg, HTTP_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* The beginning of the status line is kept until the rest is received */
+	do {
+		evt = dl_wait_for_event(DOWNLOADER_EVT_FRAGMENT, K_SECONDS(3));
+		len += evt.fragment.len;
+	} while (len < 128);
+
+	TEST_ASSERT_EQUAL(128, len);
+	evt = dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
 void test_downloader_get_https(void)
 {
 	int err;
@@ -1483,6 +1704,79 @@ void test_downloader_get_https_partial_content_partial_2nd_header(void)
 	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
 }
 
+void test_downloader_get_https_pipelined_ranges(void)
+{
+	int err;
+	struct downloader_evt evt;
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	err = downloader_transport_http_set_config(&dl, &dl_http_cfg_pipelined);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv6;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_https_ipv6_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv6_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_https_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_pipelined_ranges;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_https_pipelined;
+
+	err = downloader_get(&dl, &dl_host_conf_w_sec_tags_range_override_32, HTTPS_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* Each response is passed on separately */
+	for (int i = 0; i < 3; i++) {
+		evt = dl_wait_for_event(DOWNLOADER_EVT_FRAGMENT, K_SECONDS(3));
+		TEST_ASSERT_EQUAL(32, evt.fragment.len);
+	}
+
+	evt = dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	/* The last two ranges were requested before the first of them was received */
+	TEST_ASSERT_EQUAL(3, z_impl_zsock_sendto_fake.call_count);
+	TEST_ASSERT_EQUAL(2, z_impl_zsock_recvfrom_fake.call_count);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
+void test_downloader_get_https_pipelined_ranges_split_header(void)
+{
+	int err;
+	struct downloader_evt evt;
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	err = downloader_transport_http_set_config(&dl, &dl_http_cfg_pipelined);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv6;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_https_ipv6_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv6_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_https_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_pipelined_ranges;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_https_pipelined_split_header;
+
+	err = downloader_get(&dl, &dl_host_conf_w_sec_tags_range_override_32, HTTPS_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	for (int i = 0; i < 3; i++) {
+		evt = dl_wait_for_event(DOWNLOADER_EVT_FRAGMENT, K_SECONDS(3));
+		TEST_ASSERT_EQUAL(32, evt.fragment.len);
+	}
+
+	evt = dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	TEST_ASSERT_EQUAL(3, z_impl_zsock_sendto_fake.call_count);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
 void test_downloader_https_unlimited_redirect(void)
 {
 	int err;
@@ -2174,6 +2468,44 @@ void test_downloader_get_two_files_same_host(void)
 	TEST_ASSERT_EQUAL(1, z_impl_zsock_connect_fake.call_count);
 }
 
+void test_downloader_get_same_host_after_stopped_download(void)
+{
+	int err;
+	struct downloader_evt evt;
+
+	err = downloader_init(&dl, &dl_cfg_cb_abort);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv6;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_http_ipv6_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv6_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_http_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_ok;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_http_header_then_data;
+
+	/* The application stops the download at the first fragment */
+	err = downloader_get(&dl, &dl_host_cfg, HTTP_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	evt = dl_wait_for_event(DOWNLOADER_EVT_FRAGMENT, K_SECONDS(3));
+	evt = dl_wait_for_event(DOWNLOADER_EVT_STOPPED, K_SECONDS(3));
+
+	z_impl_zsock_recvfrom_fake.call_count = 0;
+
+	err = downloader_get(&dl, &dl_host_cfg, HTTP_URL_FILE2, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	evt = dl_wait_for_event(DOWNLOADER_EVT_FRAGMENT, K_SECONDS(3));
+	evt = dl_wait_for_event(DOWNLOADER_EVT_STOPPED, K_SECONDS(3));
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+
+	/* make sure the connection of the stopped download was not reused */
+	TEST_ASSERT_EQUAL(2, z_impl_zsock_connect_fake.call_count);
+}
+
 void test_downloader_get_two_files_different_host(void)
 {
 	int err;
@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/socket.h>
+#include <net/downloader.h>
+#include <net/downloader_transport_http.h>
+
+/* The downloader talks to an HTTP server running in this application over the loopback
+ * interface, which answers range requests for a generated file.
+ */
+#define SERVER_PORT 8080
+#define SERVER_URL "http://127.0.0.1:8080/file.bin"
+#define SERVER_STACK_SIZE 2048
+#define SERVER_PRIO K_PRIO_PREEMPT(5)
+/* Time the server takes to answer a request, the requests pipelined meanwhile pile up */
+#define SERVER_LATENCY_MS 20
+
+#define FILE_SIZE 1000
+#define RANGE_SIZE 128
+#define RANGE_COUNT DIV_ROUND_UP(FILE_SIZE, RANGE_SIZE)
+
+#define DOWNLOAD_TIMEOUT K_SECONDS(10)
+
+static K_THREAD_STACK_DEFINE(server_stack, SERVER_STACK_SIZE);
+static struct k_thread server_thread;
+static int server_fd;
+static uint8_t file_data[FILE_SIZE];
+
+static struct {
+	/* Responses sent on the first connection before the server closes it, 0 to keep it open */
+	int close_after;
+	/* Number of connections accepted */
+	int connections;
+	/* Number of requests answered */
+	int requests;
+	/* Largest number of requests received, but not answered yet */
+	int in_flight_max;
+	/* Start of the first range requested */
+	int first_start;
+} server;
+
+static struct downloader dl;
+static char dl_buf[2048];
+static uint8_t rx_data[FILE_SIZE];
+static size_t rx_len;
+static bool rx_overflow;
+static int dl_result;
+static K_SEM_DEFINE(dl_done, 0, 1);
+
+static struct downloader_host_cfg host_cfg = {
+	.range_override = RANGE_SIZE,
+};
+
+static int send_all(int fd, const void *buf, size_t len)
+{
+	ssize_t sent;
+
+	while (len) {
+		sent = zsock_send(fd, buf, len, 0);
+		if (sent < 0) {
+			return -errno;
+		}
+
+		buf = (const uint8_t *)buf + sent;
+		len -= sent;
+	}
+
+	return 0;
+}
+
+static int requests_count(const char *buf)
+{
+	int cnt = 0;
+
+	for (const char *p = buf; (p = strstr(p, "\r\n\r\n")); p += 4) {
+		cnt++;
+	}
+
+	return cnt;
+}
+
+/* Sends the range requested by the request at the beginning of the buffer. */
+static int response_send(int fd, const char *req, const char *req_end, bool conn_close)
+{
+	char hdr[192];
+	const char *p = strstr(req, "Range: bytes=");
+	unsigned long start = 0;
+	unsigned long last = FILE_SIZE - 1;
+	char *q;
+	int len;
+	int err;
+
+	if (p && (p < req_end)) {
+		start = strtoul(p + strlen("Range: bytes="), &q, 10);
+		if ((q[0] == '-') && (q[1] >= '0') && (q[1] <= '9')) {
+			last = MIN(strtoul(q + 1, NULL, 10), FILE_SIZE - 1);
+		}
+
+		len = snprintf(hdr, sizeof(hdr),
+			       "HTTP/1.1 206 Partial Content\r\n"
+			       "Content-Length: %lu\r\n"
+			       "Content-Range: bytes %lu-%lu/%u\r\n"
+			       "%s\r\n",
+			       last - start + 1, start, last, FILE_SIZE,
+			       conn_close ? "Connection: close\r\n" : "");
+	} else {
+		len = snprintf(hdr, sizeof(hdr),
+			       "HTTP/1.1 200 OK\r\n"
+			       "Content-Length: %u\r\n"
+			       "%s\r\n",
+			       FILE_SIZE, conn_close ? "Connection: close\r\n" : "");
+	}
+
+	if (server.requests++ == 0) {
+		server.first_start = start;
+	}
+
+	err = send_all(fd, hdr, len);
+	if (err) {
+		return err;
+	}
+
+	return send_all(fd, &file_data[start], last - start + 1);
+}
+
+static void connection_handle(int fd)
+{
+	static char req[1024];
+	size_t len = 0;
+	int responses = 0;
+	char *end;
+	ssize_t ret;
+	bool conn_close;
+
+	req[0] = '\0';
+
+	while (true) {
+		/* Wait for a complete request */
+		while (!(end = strstr(req, "\r\n\r\n"))) {
+			ret = zsock_recv(fd, &req[len], sizeof(req) - 1 - len, 0);
+			if (ret <= 0) {
+				return;
+			}
+
+			len += ret;
+			req[len] = '\0';
+		}
+
+		k_sleep(K_MSEC(SERVER_LATENCY_MS));
+
+		/* Collect the requests pipelined while the response was being prepared */
+		ret = zsock_recv(fd, &req[len], sizeof(req) - 1 - len, ZSOCK_MSG_DONTWAIT);
+		if (ret > 0) {
+			len += ret;
+			req[len] = '\0';
+			end = strstr(req, "\r\n\r\n");
+		}
+
+		server.in_flight_max = MAX(server.in_flight_max, requests_count(req));
+
+		conn_close = (++responses == server.close_after) && (server.connections == 1);
+		if (response_send(fd, req, end, conn_close) || conn_close) {
+			return;
+		}
+
+		end += strlen("\r\n\r\n");
+		len -= end - req;
+		memmove(req, end, len + 1);
+	}
+}
+
+static void server_run(void *p1, void *p2, void *p3)
+{
+	int fd;
+
+	while (true) {
+		fd = zsock_accept(server_fd, NULL, NULL);
+		if (fd < 0) {
+			continue;
+		}
+
+		server.connections++;
+		connection_handle(fd);
+		zsock_close(fd);
+	}
+}
+
+static int dl_callback(const struct downloader_evt *event)
+{
+	switch (event->id) {
+	case DOWNLOADER_EVT_FRAGMENT:
+		if (rx_len + event->fragment.len > sizeof(rx_data)) {
+			rx_overflow = true;
+			return 1;
+		}
+
+		memcpy(&rx_data[rx_len], event->fragment.buf, event->fragment.len);
+		rx_len += event->fragment.len;
+		break;
+	case DOWNLOADER_EVT_ERROR:
+		/* Reconnect when the server closes the connection */
+		if (event->error == -ECONNRESET) {
+			return 0;
+		}
+
+		dl_result = event->error;
+		k_sem_give(&dl_done);
+		return 1;
+	case DOWNLOADER_EVT_DONE:
+		dl_result = 0;
+		k_sem_give(&dl_done);
+		break;
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+static struct downloader_cfg dl_cfg = {
+	.callback = dl_callback,
+	.buf = dl_buf,
+	.buf_size = sizeof(dl_buf),
+};
+
+/* Downloads the file from the given offset and checks the received data. */
+static void download(uint8_t pipeline_depth, size_t from)
+{
+	struct downloader_transport_http_cfg http_cfg = {
+		.sock_recv_timeo_ms = 5000,
+		.pipeline_depth = pipeline_depth,
+	};
+
+	zassert_ok(downloader_transport_http_set_config(&dl, &http_cfg));
+
+	rx_len = from;
+	zassert_ok(downloader_get(&dl, &host_cfg, SERVER_URL, from));
+	zassert_ok(k_sem_take(&dl_done, DOWNLOAD_TIMEOUT), "Download timed out");
+
+	zassert_ok(dl_result, "Download failed: %d", dl_result);
+	zassert_false(rx_overflow, "Received more than the file");
+	zassert_equal(rx_len, FILE_SIZE, "Received %zu bytes", rx_len);
+	zassert_mem_equal(&rx_data[from], &file_data[from], FILE_SIZE - from);
+}
+
+static void *setup(void)
+{
+	struct net_sockaddr_in addr = {
+		.sin_family = NET_AF_INET,
+		.sin_port = net_htons(SERVER_PORT),
+		.sin_addr.s_addr = net_htonl(NET_INADDR_ANY),
+	};
+
+	for (size_t i = 0; i < sizeof(file_data); i++) {
+		file_data[i] = (i * 31 + 7) & 0xff;
+	}
+
+	server_fd = zsock_socket(NET_AF_INET, NET_SOCK_STREAM, NET_IPPROTO_TCP);
+	zassert_true(server_fd >= 0, "socket() failed: %d", errno);
+	zassert_ok(zsock_bind(server_fd, (struct net_sockaddr *)&addr, sizeof(addr)));
+	zassert_ok(zsock_listen(server_fd, 1));
+
+	k_thread_create(&server_thread, server_stack, K_THREAD_STACK_SIZEOF(server_stack),
+			server_run, NULL, NULL, NULL, SERVER_PRIO, 0, K_NO_WAIT);
+
+	zassert_ok(downloader_init(&dl, &dl_cfg));
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(&server, 0, sizeof(server));
+	memset(rx_data, 0, sizeof(rx_data));
+	rx_overflow = false;
+	k_sem_reset(&dl_done);
+}
+
+ZTEST(downloader_http, test_range_requests)
+{
+	download(0, 0);
+
+	/* Each request is sent once the previous response is received */
+	zassert_equal(server.requests, RANGE_COUNT);
+	zassert_equal(server.in_flight_max, 1);
+	zassert_equal(server.connections, 1);
+}
+
+ZTEST(downloader_http, test_pipelined_range_requests)
+{
+	download(4, 0);
+
+	/* The ranges after the first one are requested before the previous responses */
+	zassert_equal(server.requests, RANGE_COUNT);
+	zassert_true(server.in_flight_max > 1, "Requests were not pipelined");
+	zassert_true(server.in_flight_max <= 4, "Too many requests in flight: %d",
+		     server.in_flight_max);
+	zassert_equal(server.connections, 1);
+}
+
+ZTEST(downloader_http, test_pipelined_connection_close)
+{
+	/* The requests pipelined after the third response are never answered */
+	server.close_after = 3;
+
+	download(4, 0);
+
+	/* The download continues from the last byte received on a new connection */
+	zassert_equal(server.connections, 2);
+	zassert_true(server.requests >= RANGE_COUNT);
+}
+
+ZTEST(downloader_http, test_pipelined_resume)
+{
+	download(4, 500);
+
+	zassert_equal(server.first_start, 500);
+	zassert_equal(server.requests, DIV_ROUND_UP(FILE_SIZE - 500, RANGE_SIZE));
+	zassert_equal(server.connections, 1);
+}
+
+ZTEST_SUITE(downloader_http, NULL, setup, before, NULL, NULL);
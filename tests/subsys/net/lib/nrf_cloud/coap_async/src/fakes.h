@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_coap.h>
+#include <nrf_cloud_codec_internal.h>
+#include <nrf_cloud_credentials.h>
+#include <nrf_cloud_dns.h>
+#include <nrf_cloud_mem.h>
+#include <nrfc_dtls.h>
+#include <zephyr/fff.h>
+
+DEFINE_FFF_GLOBALS;
+
+/* Fake functions declaration, none of them is used on the request path */
+FAKE_VALUE_FUNC(void *, nrf_cloud_malloc, size_t);
+FAKE_VOID_FUNC(nrf_cloud_free, void *);
+FAKE_VALUE_FUNC(int, nrf_cloud_obj_init, struct nrf_cloud_obj *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_obj_free, struct nrf_cloud_obj *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_obj_cloud_encode, struct nrf_cloud_obj *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_obj_cloud_encoded_free, struct nrf_cloud_obj *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_codec_init, struct nrf_cloud_os_mem_hooks *);
+FAKE_VALUE_FUNC(int, nrf_cloud_print_details);
+FAKE_VALUE_FUNC(int, nrf_cloud_credentials_provision);
+FAKE_VALUE_FUNC(int, nrf_cloud_jwt_generate, uint32_t, char *const, size_t);
+FAKE_VALUE_FUNC(int, nrf_cloud_connect_host, const char *, uint16_t, struct zsock_addrinfo *,
+		nrf_cloud_connect_host_cb);
+FAKE_VALUE_FUNC(int, nrf_cloud_coap_shadow_state_update, const char *const);
+FAKE_VOID_FUNC(nrf_cloud_device_control_get, struct nrf_cloud_ctrl_data *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_shadow_control_response_encode,
+		struct nrf_cloud_ctrl_data const *const, bool, struct nrf_cloud_data *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_enabled_info_sections_json_encode, cJSON *const,
+		const char *const);
+FAKE_VALUE_FUNC(int, nrfc_dtls_setup, int);
+FAKE_VALUE_FUNC(bool, nrfc_dtls_cid_is_active, int);
+FAKE_VALUE_FUNC(int, nrfc_dtls_session_save, int);
+FAKE_VALUE_FUNC(int, nrfc_dtls_session_load, int);
+FAKE_VALUE_FUNC(bool, nrfc_keepopen_is_supported);
@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <limits.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/coap.h>
+#include "fakes.h"
+
+#include "nrf_cloud_coap_transport.c"
+
+#define SERVER_PORT		CONFIG_NRF_CLOUD_COAP_SERVER_PORT
+#define RESPONSE_DELAY_MS	200
+#define REQUESTS_NUM		CONFIG_NRF_CLOUD_COAP_ASYNC_REQUESTS_MAX
+#define DONE_TIMEOUT		K_SECONDS(10)
+#define PACKET_SIZE		128
+
+/* How the stand-in server handles the requests */
+enum server_mode {
+	SERVER_RESPOND,
+	SERVER_NOT_FOUND,
+	SERVER_SILENT,
+};
+
+/* Response of the stand-in server, sent once the delay has passed */
+struct pending_response {
+	struct k_work_delayable work;
+	struct sockaddr addr;
+	socklen_t addr_len;
+	uint8_t buf[PACKET_SIZE];
+	size_t len;
+};
+
+static struct pending_response responses[CONFIG_COAP_CLIENT_MAX_REQUESTS];
+static atomic_t requests_received;
+static atomic_t server_mode;
+static int server_sock = -1;
+
+static K_THREAD_STACK_DEFINE(server_stack, 2048);
+static struct k_thread server_thread;
+
+static K_SEM_DEFINE(done_sem, 0, K_SEM_MAX_LIMIT);
+static atomic_t done_errors;
+static atomic_t done_result;
+static int reissue_err;
+
+static const uint8_t payload[] = "{\"sensor\":\"TEMP\",\"data\":21.5}";
+
+static void response_send(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct pending_response *rsp = CONTAINER_OF(dwork, struct pending_response, work);
+
+	(void)zsock_sendto(server_sock, rsp->buf, rsp->len, 0, &rsp->addr, rsp->addr_len);
+}
+
+/* Answers each request with a piggybacked response after RESPONSE_DELAY_MS, without waiting
+ * for the previous responses, like a server at the other end of a slow link.
+ */
+static void server_run(void *p1, void *p2, void *p3)
+{
+	uint8_t buf[PACKET_SIZE];
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	struct coap_packet request;
+	struct coap_packet response;
+	struct pending_response *rsp;
+	struct sockaddr addr;
+	socklen_t addr_len;
+	uint8_t token_len;
+	uint8_t code;
+	int len;
+
+	while (true) {
+		addr_len = sizeof(addr);
+		len = zsock_recvfrom(server_sock, buf, sizeof(buf), 0, &addr, &addr_len);
+		if ((len <= 0) || coap_packet_parse(&request, buf, len, NULL, 0)) {
+			continue;
+		}
+
+		rsp = &responses[atomic_inc(&requests_received) % ARRAY_SIZE(responses)];
+		if (atomic_get(&server_mode) == SERVER_SILENT) {
+			continue;
+		}
+
+		token_len = coap_header_get_token(&request, token);
+		if (atomic_get(&server_mode) == SERVER_NOT_FOUND) {
+			code = COAP_RESPONSE_CODE_NOT_FOUND;
+		} else if (coap_header_get_code(&request) == COAP_METHOD_GET) {
+			code = COAP_RESPONSE_CODE_CONTENT;
+		} else {
+			code = COAP_RESPONSE_CODE_CHANGED;
+		}
+
+		if (coap_packet_init(&response, rsp->buf, sizeof(rsp->buf), COAP_VERSION_1,
+				     COAP_TYPE_ACK, token_len, token, code,
+				     coap_header_get_id(&request))) {
+			continue;
+		}
+
+		rsp->len = response.offset;
+		rsp->addr = addr;
+		rsp->addr_len = addr_len;
+		k_work_reschedule(&rsp->work, K_MSEC(RESPONSE_DELAY_MS));
+	}
+}
+
+static void done_cb(int result, void *user)
+{
+	ARG_UNUSED(user);
+
+	if (result) {
+		atomic_inc(&done_errors);
+	}
+	atomic_set(&done_result, result);
+	k_sem_give(&done_sem);
+}
+
+static const struct nrf_cloud_coap_async_req async_req = {
+	.method = COAP_METHOD_POST,
+	.resource = "msg/d2c",
+	.buf = payload,
+	.len = sizeof(payload) - 1,
+	.fmt_out = COAP_CONTENT_FORMAT_APP_JSON,
+	.done_cb = done_cb,
+};
+
+/* Starts the next request from the completion callback, until the count runs out */
+static void reissue_cb(int result, void *user)
+{
+	atomic_t *remaining = user;
+	struct nrf_cloud_coap_async_req req = async_req;
+
+	if (atomic_dec(remaining) > 1) {
+		req.done_cb = reissue_cb;
+		req.user = user;
+		reissue_err = nrf_cloud_coap_async_request(&req);
+	}
+	done_cb(result, NULL);
+}
+
+static uint32_t sync_run(void)
+{
+	uint32_t start = k_uptime_get_32();
+
+	for (int i = 0; i < REQUESTS_NUM; i++) {
+		zassert_ok(nrf_cloud_coap_post(async_req.resource, NULL, payload,
+					       sizeof(payload) - 1, COAP_CONTENT_FORMAT_APP_JSON,
+					       true, NULL, NULL));
+	}
+
+	return k_uptime_get_32() - start;
+}
+
+static uint32_t async_run(void)
+{
+	uint32_t start = k_uptime_get_32();
+
+	atomic_clear(&done_errors);
+	k_sem_reset(&done_sem);
+
+	for (int i = 0; i < REQUESTS_NUM; i++) {
+		zassert_ok(nrf_cloud_coap_async_request(&async_req));
+	}
+
+	/* The maximum number of requests wait for their responses */
+	zassert_equal(nrf_cloud_coap_async_request(&async_req), -EBUSY);
+
+	for (int i = 0; i < REQUESTS_NUM; i++) {
+		zassert_ok(k_sem_take(&done_sem, DONE_TIMEOUT), "Completed %d of %d requests",
+			   i, REQUESTS_NUM);
+	}
+	zassert_equal(atomic_get(&done_errors), 0, "Requests completed with an error");
+
+	return k_uptime_get_32() - start;
+}
+
+static struct sockaddr_in server_addr = {
+	.sin_family = AF_INET,
+	.sin_port = htons(SERVER_PORT),
+};
+
+/* Connects the internal client to the stand-in server, without DTLS and authorization */
+static void client_connect(void)
+{
+	int sock;
+
+	sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	zassert_true(sock >= 0);
+	zassert_ok(zsock_connect(sock, (struct sockaddr *)&server_addr, sizeof(server_addr)));
+
+	internal_cc.sock = sock;
+	internal_cc.authenticated = true;
+}
+
+static void *setup(void)
+{
+	zassert_equal(zsock_inet_pton(AF_INET, "127.0.0.1", &server_addr.sin_addr), 1);
+
+	for (int i = 0; i < ARRAY_SIZE(responses); i++) {
+		k_work_init_delayable(&responses[i].work, response_send);
+	}
+
+	server_sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	zassert_true(server_sock >= 0);
+	zassert_ok(zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			      sizeof(server_addr)));
+
+	k_thread_create(&server_thread, server_stack, K_THREAD_STACK_SIZEOF(server_stack),
+			server_run, NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+
+	zassert_ok(nrf_cloud_coap_transport_init(&internal_cc));
+	client_connect();
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	atomic_set(&server_mode, SERVER_RESPOND);
+	atomic_clear(&done_errors);
+	atomic_set(&done_result, INT_MIN);
+	k_sem_reset(&done_sem);
+
+	/* Reconnect after the tests closing the connection */
+	if (internal_cc.sock < 0) {
+		client_connect();
+	}
+}
+
+static void after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* All the asynchronous requests have ended */
+	zassert_equal(k_sem_count_get(&async_sem), REQUESTS_NUM);
+}
+
+ZTEST(nrf_cloud_coap_async, test_invalid_request)
+{
+	struct nrf_cloud_coap_async_req req = async_req;
+
+	zassert_equal(nrf_cloud_coap_async_request(NULL), -EINVAL);
+
+	req.done_cb = NULL;
+	zassert_equal(nrf_cloud_coap_async_request(&req), -EINVAL);
+
+	internal_cc.authenticated = false;
+	zassert_equal(nrf_cloud_coap_async_request(&async_req), -EACCES);
+	internal_cc.authenticated = true;
+}
+
+ZTEST(nrf_cloud_coap_async, test_sync_request)
+{
+	uint32_t time_ms = sync_run() / REQUESTS_NUM;
+
+	zassert_true(time_ms >= RESPONSE_DELAY_MS, "Request took %u ms", time_ms);
+}
+
+ZTEST(nrf_cloud_coap_async, test_async_requests_overlap)
+{
+	uint32_t sync_ms;
+	uint32_t async_ms;
+
+	/* Needs more than one request slot for the asynchronous requests */
+	if (REQUESTS_NUM < 2) {
+		ztest_test_skip();
+	}
+
+	sync_ms = sync_run();
+	async_ms = async_run();
+
+	/* The round trips overlap, so all the requests take about one of them */
+	zassert_true(async_ms < 2 * RESPONSE_DELAY_MS, "%d requests took %u ms", REQUESTS_NUM,
+		     async_ms);
+
+	TC_PRINT("%d requests with %d ms round trip: sync %u ms, async %u ms\n", REQUESTS_NUM,
+		 RESPONSE_DELAY_MS, sync_ms, async_ms);
+}
+
+ZTEST(nrf_cloud_coap_async, test_async_slots_reused)
+{
+	/* Completed requests give their slots back */
+	for (int i = 0; i < 3; i++) {
+		(void)async_run();
+	}
+}
+
+ZTEST(nrf_cloud_coap_async, test_async_error_response)
+{
+	atomic_set(&server_mode, SERVER_NOT_FOUND);
+
+	zassert_ok(nrf_cloud_coap_async_request(&async_req));
+	zassert_ok(k_sem_take(&done_sem, DONE_TIMEOUT));
+
+	/* The CoAP result code of a 4.xx response is reported as is */
+	zassert_equal(atomic_get(&done_result), COAP_RESPONSE_CODE_NOT_FOUND,
+		      "Completed with %d", (int)atomic_get(&done_result));
+}
+
+ZTEST(nrf_cloud_coap_async, test_async_timeout)
+{
+	atomic_set(&server_mode, SERVER_SILENT);
+
+	zassert_ok(nrf_cloud_coap_async_request(&async_req));
+	zassert_ok(k_sem_take(&done_sem, DONE_TIMEOUT));
+
+	zassert_equal(atomic_get(&done_result), -ETIMEDOUT, "Completed with %d",
+		      (int)atomic_get(&done_result));
+}
+
+ZTEST(nrf_cloud_coap_async, test_async_disconnect)
+{
+	atomic_set(&server_mode, SERVER_SILENT);
+
+	for (int i = 0; i < REQUESTS_NUM; i++) {
+		zassert_ok(nrf_cloud_coap_async_request(&async_req));
+	}
+
+	/* Closing the connection completes the requests waiting for a response */
+	zassert_ok(nrf_cloud_coap_transport_disconnect(&internal_cc));
+
+	for (int i = 0; i < REQUESTS_NUM; i++) {
+		zassert_ok(k_sem_take(&done_sem, DONE_TIMEOUT), "Completed %d of %d requests",
+			   i, REQUESTS_NUM);
+	}
+	zassert_equal(atomic_get(&done_errors), REQUESTS_NUM);
+	zassert_equal(atomic_get(&done_result), -ECANCELED, "Completed with %d",
+		      (int)atomic_get(&done_result));
+
+	zassert_equal(nrf_cloud_coap_async_request(&async_req), -EACCES);
+}
+
+ZTEST(nrf_cloud_coap_async, test_async_reissue_from_callback)
+{
+	struct nrf_cloud_coap_async_req req = async_req;
+	static atomic_t remaining;
+
+	/* The other asynchronous requests are pending when the callback starts a request */
+	atomic_set(&remaining, 3);
+	for (int i = 1; i < REQUESTS_NUM; i++) {
+		zassert_ok(nrf_cloud_coap_async_request(&async_req));
+	}
+
+	reissue_err = 0;
+	req.done_cb = reissue_cb;
+	req.user = &remaining;
+	zassert_ok(nrf_cloud_coap_async_request(&req));
+
+	/* The first request and the two started from its callbacks */
+	for (int i = 0; i < REQUESTS_NUM + 2; i++) {
+		zassert_ok(k_sem_take(&done_sem, DONE_TIMEOUT), "Completed %d requests", i);
+		zassert_ok(reissue_err, "Request from the callback failed: %d", reissue_err);
+	}
+	zassert_equal(atomic_get(&remaining), 0);
+	zassert_equal(atomic_get(&done_errors), 0, "Requests completed with an error");
+}
+
+ZTEST_SUITE(nrf_cloud_coap_async, NULL, setup, before, after, NULL);
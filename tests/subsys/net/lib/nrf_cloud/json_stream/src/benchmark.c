@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <cJSON.h>
+#include "msg_encode.h"
+#include "messages.h"
+
+/* Number of times each message is encoded */
+#define ITERATIONS 50
+
+static char buf[MSG_BUF_SIZE];
+
+static void *setup(void)
+{
+	heap_track_init();
+	return NULL;
+}
+
+static uint32_t tree_cycles(const struct test_msg *msg, size_t *peak)
+{
+	uint32_t start;
+	uint32_t cycles;
+	char *out;
+
+	heap_track_reset();
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		out = msg->tree_print();
+		zassert_not_null(out);
+		cJSON_free(out);
+	}
+
+	cycles = k_cycle_get_32() - start;
+	*peak = heap_track_peak();
+
+	return cycles / ITERATIONS;
+}
+
+static uint32_t stream_cycles(const struct test_msg *msg, size_t *len)
+{
+	struct nrf_cloud_json_stream stream;
+	uint32_t start;
+	uint32_t cycles;
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		nrf_cloud_json_stream_init(&stream, buf, sizeof(buf));
+		msg->stream_write(&stream);
+		zassert_ok(nrf_cloud_json_stream_finish(&stream, len));
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	return cycles / ITERATIONS;
+}
+
+ZTEST(nrf_cloud_json_stream_benchmark, test_json_encode)
+{
+	uint32_t tree;
+	uint32_t stream;
+	size_t peak;
+	size_t len;
+
+	for (size_t i = 0; i < test_msgs_cnt; i++) {
+		tree = tree_cycles(&test_msgs[i], &peak);
+		heap_track_reset();
+		stream = stream_cycles(&test_msgs[i], &len);
+
+		/* The stream does not allocate at all */
+		zassert_equal(heap_track_peak(), 0);
+
+		TC_PRINT("%s (%zu bytes): cJSON %u cycles, %zu bytes peak heap; "
+			 "stream %u cycles, no heap\n",
+			 test_msgs[i].name, len, tree, peak, stream);
+	}
+}
+
+ZTEST(nrf_cloud_json_stream_benchmark, test_cbor_encode)
+{
+	const char app_id[] = "TEMP";
+	struct message_out input = {
+		.message_out_appId.value = (const uint8_t *)app_id,
+		.message_out_appId.len = sizeof(app_id) - 1,
+		.message_out_data_choice = message_out_data_float_c,
+		.message_out_data_float = 21.5,
+		.message_out_ts.message_out_ts = 1700000000123ULL,
+		.message_out_ts_present = true,
+	};
+	uint32_t start;
+	uint32_t cycles;
+	size_t len;
+
+	start = k_cycle_get_32();
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		zassert_ok(cbor_encode_message_out((uint8_t *)buf, sizeof(buf), &input, &len));
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	TC_PRINT("sensor, CBOR (%zu bytes): %u cycles, no heap\n", len, cycles / ITERATIONS);
+}
+
+ZTEST_SUITE(nrf_cloud_json_stream_benchmark, NULL, setup, NULL, NULL, NULL);
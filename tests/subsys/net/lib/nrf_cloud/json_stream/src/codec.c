@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/coap.h>
+#include <cJSON.h>
+#include "coap_codec.h"
+#include "messages.h"
+
+#include "nrf_cloud_codec_internal.c"
+
+static char buf[MSG_BUF_SIZE];
+
+/* Names and types of the modem info items, as in the modem_info library */
+static const struct {
+	const char *name;
+	enum modem_info_data_type type;
+} info_names[MODEM_INFO_COUNT] = {
+	[MODEM_INFO_CUR_BAND] = {"currentBand", MODEM_INFO_DATA_TYPE_NUM_INT},
+	[MODEM_INFO_SUP_BAND] = {"supportedBands", MODEM_INFO_DATA_TYPE_STRING},
+	[MODEM_INFO_AREA_CODE] = {"areaCode", MODEM_INFO_DATA_TYPE_STRING},
+	[MODEM_INFO_UE_MODE] = {"ueMode", MODEM_INFO_DATA_TYPE_NUM_INT},
+	[MODEM_INFO_OPERATOR] = {"mccmnc", MODEM_INFO_DATA_TYPE_STRING},
+	[MODEM_INFO_CELLID] = {"cellID", MODEM_INFO_DATA_TYPE_STRING},
+	[MODEM_INFO_IP_ADDRESS] = {"ipAddress", MODEM_INFO_DATA_TYPE_STRING},
+	[MODEM_INFO_UICC] = {"uiccMode", MODEM_INFO_DATA_TYPE_NUM_INT},
+	[MODEM_INFO_BATTERY] = {"batteryVoltage", MODEM_INFO_DATA_TYPE_NUM_INT},
+	[MODEM_INFO_FW_VERSION] = {"modemFirmware", MODEM_INFO_DATA_TYPE_STRING},
+	[MODEM_INFO_ICCID] = {"iccid", MODEM_INFO_DATA_TYPE_STRING},
+	[MODEM_INFO_LTE_MODE] = {"lteMode", MODEM_INFO_DATA_TYPE_NUM_INT},
+	[MODEM_INFO_NBIOT_MODE] = {"nbiotMode", MODEM_INFO_DATA_TYPE_NUM_INT},
+	[MODEM_INFO_GPS_MODE] = {"gpsMode", MODEM_INFO_DATA_TYPE_NUM_INT},
+	[MODEM_INFO_IMSI] = {"imsi", MODEM_INFO_DATA_TYPE_STRING},
+	[MODEM_INFO_IMEI] = {"imei", MODEM_INFO_DATA_TYPE_STRING},
+};
+
+/* Modem info of an nRF9151 DK connected to an LTE-M network */
+#define PARAM(_type, _value, _str) {.value = _value, .value_string = _str, .type = _type}
+
+static struct modem_param_info test_mpi = {
+	.network = {
+		.current_band = PARAM(MODEM_INFO_CUR_BAND, 20, "20"),
+		.sup_band = PARAM(MODEM_INFO_SUP_BAND, 0, "(1,2,3,4,5,8,12,13,18,19,20,25,26)"),
+		.area_code = PARAM(MODEM_INFO_AREA_CODE, 3402, "0D4A"),
+		.current_operator = PARAM(MODEM_INFO_OPERATOR, 0, "24201"),
+		.cellid_hex = PARAM(MODEM_INFO_CELLID, 0, "014A0305"),
+		.ip_address = PARAM(MODEM_INFO_IP_ADDRESS, 0, "10.160.33.14 2001:db8::1"),
+		.ue_mode = PARAM(MODEM_INFO_UE_MODE, 2, "2"),
+		.lte_mode = PARAM(MODEM_INFO_LTE_MODE, 1, "1"),
+		.nbiot_mode = PARAM(MODEM_INFO_NBIOT_MODE, 0, "0"),
+		.gps_mode = PARAM(MODEM_INFO_GPS_MODE, 1, "1"),
+		.cellid_dec = 21627653,
+	},
+	.sim = {
+		.uicc = PARAM(MODEM_INFO_UICC, 1, "1"),
+		.iccid = PARAM(MODEM_INFO_ICCID, 0, "89450421180216254864"),
+		.imsi = PARAM(MODEM_INFO_IMSI, 0, "242016000059874"),
+	},
+	.device = {
+		.modem_fw = PARAM(MODEM_INFO_FW_VERSION, 0, "mfw_nrf91x1_2.0.2"),
+		.battery = PARAM(MODEM_INFO_BATTERY, 3864, "3864"),
+		.imei = PARAM(MODEM_INFO_IMEI, 0, "351358815340515"),
+		.board = "nrf9151dk/nrf9151/ns",
+		.app_name = "asset_tracker",
+	},
+};
+
+int modem_info_init(void)
+{
+	return 0;
+}
+
+int modem_info_params_init(struct modem_param_info *modem_param)
+{
+	return 0;
+}
+
+int modem_info_params_get(struct modem_param_info *modem_param)
+{
+	*modem_param = test_mpi;
+	return 0;
+}
+
+int modem_info_name_get(enum modem_info info, char *name)
+{
+	if ((info < 0) || (info >= MODEM_INFO_COUNT) || !info_names[info].name) {
+		return -EINVAL;
+	}
+
+	strcpy(name, info_names[info].name);
+	return strlen(name);
+}
+
+enum modem_info_data_type modem_info_data_type_get(enum modem_info info)
+{
+	if ((info < 0) || (info >= MODEM_INFO_COUNT)) {
+		return MODEM_INFO_DATA_TYPE_INVALID;
+	}
+
+	return info_names[info].type;
+}
+
+int modem_info_get_hw_version(char *hw_ver, uint8_t buf_size)
+{
+	strncpy(hw_ver, "nRF9151 LACA A0A", buf_size);
+	return 0;
+}
+
+/* The log backend is not part of the test */
+int nrf_cloud_log_control_get(void)
+{
+	return 0;
+}
+
+void nrf_cloud_log_control_set(int level)
+{
+	ARG_UNUSED(level);
+}
+
+/* Checks that the stream wrote the same JSON text as cJSON printed */
+static void assert_same_json(char *expected, const char *name)
+{
+	zassert_not_null(expected, "%s", name);
+	zassert_str_equal(buf, expected, "%s", name);
+	cJSON_free(expected);
+}
+
+static char *modem_info_print(const struct nrf_cloud_modem_info *mod_inf)
+{
+	cJSON *obj = cJSON_CreateObject();
+	char *out = NULL;
+
+	if (!nrf_cloud_modem_info_json_encode(mod_inf, obj)) {
+		out = cJSON_PrintUnformatted(obj);
+	}
+	cJSON_Delete(obj);
+
+	return out;
+}
+
+static int modem_info_stream_write(const struct nrf_cloud_modem_info *mod_inf)
+{
+	struct nrf_cloud_json_stream stream;
+	int err;
+
+	nrf_cloud_json_stream_init(&stream, buf, sizeof(buf));
+	nrf_cloud_json_stream_obj_start(&stream, NULL);
+	err = modem_info_json_stream_encode(mod_inf, &stream);
+	nrf_cloud_json_stream_obj_end(&stream);
+
+	return err ? err : nrf_cloud_json_stream_finish(&stream, NULL);
+}
+
+static void *setup(void)
+{
+	heap_track_init();
+	return NULL;
+}
+
+ZTEST(nrf_cloud_json_stream_codec, test_encode_message)
+{
+	static const struct {
+		const char *app_id;
+		double value;
+		const char *str_val;
+		const char *topic;
+		int64_t ts;
+	} msgs[] = {
+		{"RSRP", -105, NULL, NULL, 0},
+		{"BUTTON", 0, "", NULL, -1},
+		{"GNSS", 0, "{\"lat\":63.42}", "", 9007199254740991LL},
+	};
+	struct nrf_cloud_json_stream stream;
+	struct nrf_cloud_data out;
+
+	for (size_t i = 0; i < ARRAY_SIZE(msgs); i++) {
+		zassert_ok(nrf_cloud_encode_message(msgs[i].app_id, msgs[i].value, msgs[i].str_val,
+						    msgs[i].topic, msgs[i].ts, &out));
+
+		nrf_cloud_json_stream_init(&stream, buf, sizeof(buf));
+		zassert_ok(nrf_cloud_encode_message_stream(msgs[i].app_id, msgs[i].value,
+							   msgs[i].str_val, msgs[i].topic,
+							   msgs[i].ts, &stream));
+
+		zassert_equal(stream.len, out.len, "%s", msgs[i].app_id);
+		assert_same_json((char *)out.ptr, msgs[i].app_id);
+	}
+}
+
+ZTEST(nrf_cloud_json_stream_codec, test_coap_message_encode)
+{
+	struct nrf_cloud_obj_coap_cbor msgs[] = {
+		{.app_id = "TEMP", .type = NRF_CLOUD_DATA_TYPE_DOUBLE, .double_val = 21.5,
+		 .ts = TS},
+		{.app_id = "LOG", .type = NRF_CLOUD_DATA_TYPE_STR, .str_val = "\"quoted\"\n",
+		 .ts = TS},
+	};
+	struct nrf_cloud_data out;
+	size_t len;
+
+	for (size_t i = 0; i < ARRAY_SIZE(msgs); i++) {
+		bool is_str = (msgs[i].type == NRF_CLOUD_DATA_TYPE_STR);
+
+		zassert_ok(nrf_cloud_encode_message(msgs[i].app_id,
+						    is_str ? 0 : msgs[i].double_val,
+						    is_str ? msgs[i].str_val : NULL, NULL,
+						    msgs[i].ts, &out));
+
+		len = sizeof(buf);
+		zassert_ok(coap_codec_message_encode(&msgs[i], (uint8_t *)buf, &len,
+						     COAP_CONTENT_FORMAT_APP_JSON));
+
+		/* The payload is the JSON text, without the null terminator */
+		zassert_equal(len, out.len, "%s", msgs[i].app_id);
+		assert_same_json((char *)out.ptr, msgs[i].app_id);
+
+		/* A buffer that only lacks room for the null terminator is too small */
+		len = out.len;
+		zassert_equal(coap_codec_message_encode(&msgs[i], (uint8_t *)buf, &len,
+							COAP_CONTENT_FORMAT_APP_JSON), -E2BIG);
+		zassert_equal(len, 0);
+	}
+}
+
+ZTEST(nrf_cloud_json_stream_codec, test_modem_info_sections)
+{
+	static const enum nrf_cloud_shadow_info states[] = {
+		NRF_CLOUD_INFO_NO_CHANGE, NRF_CLOUD_INFO_SET, NRF_CLOUD_INFO_CLEAR,
+	};
+	struct nrf_cloud_modem_info mod_inf = {.application_version = APP_VER};
+
+	/* Every combination of the sections, with given and with local modem info */
+	for (int mpi = 0; mpi < 2; mpi++) {
+		mod_inf.mpi = mpi ? &test_mpi : NULL;
+
+		for (size_t i = 0; i < ARRAY_SIZE(states) * ARRAY_SIZE(states) *
+					ARRAY_SIZE(states); i++) {
+			mod_inf.device = states[i % 3];
+			mod_inf.network = states[(i / 3) % 3];
+			mod_inf.sim = states[i / 9];
+
+			zassert_ok(modem_info_stream_write(&mod_inf));
+			assert_same_json(modem_info_print(&mod_inf), "modem info");
+		}
+	}
+}
+
+ZTEST(nrf_cloud_json_stream_codec, test_info_sections_size)
+{
+	struct nrf_cloud_json_stream stream;
+	size_t expected_len;
+	size_t len;
+
+	nrf_cloud_json_stream_init(&stream, buf, sizeof(buf));
+	zassert_ok(nrf_cloud_enabled_info_sections_json_stream_encode(&stream, APP_VER));
+	zassert_ok(nrf_cloud_json_stream_finish(&stream, &expected_len));
+
+	/* All the info sections fit in the size suggested for
+	 * CONFIG_NRF_CLOUD_SEND_SHADOW_INFO_BUF_SIZE
+	 */
+	TC_PRINT("Info sections: %zu bytes\n", expected_len);
+	zassert_true(expected_len < 1024);
+
+	/* Smaller buffers are reported, so that the transport falls back to cJSON */
+	for (size_t size = 1; size <= expected_len; size++) {
+		nrf_cloud_json_stream_init(&stream, buf, size);
+		zassert_equal(nrf_cloud_enabled_info_sections_json_stream_encode(&stream, APP_VER),
+			      -E2BIG, "size %zu", size);
+	}
+
+	nrf_cloud_json_stream_init(&stream, buf, expected_len + 1);
+	zassert_ok(nrf_cloud_enabled_info_sections_json_stream_encode(&stream, APP_VER));
+	zassert_ok(nrf_cloud_json_stream_finish(&stream, &len));
+	zassert_equal(len, expected_len);
+}
+
+ZTEST_SUITE(nrf_cloud_json_stream_codec, NULL, setup, NULL, NULL, NULL);
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <cJSON.h>
+#include "messages.h"
+
+static char buf[MSG_BUF_SIZE];
+
+static const double numbers[] = {
+	0, -1, 21.5, 0.1, 1e-7, -3.14159265358979, 2147483647, -2147483648.0, 2147483648.0,
+	1700000000123.0, 1e300, NAN, INFINITY,
+};
+
+static void *setup(void)
+{
+	heap_track_init();
+	return NULL;
+}
+
+ZTEST(nrf_cloud_json_stream, test_messages_match_cjson)
+{
+	struct nrf_cloud_json_stream stream;
+	size_t len;
+	char *expected;
+
+	for (size_t i = 0; i < test_msgs_cnt; i++) {
+		expected = test_msgs[i].tree_print();
+		zassert_not_null(expected);
+
+		nrf_cloud_json_stream_init(&stream, buf, sizeof(buf));
+		test_msgs[i].stream_write(&stream);
+		zassert_ok(nrf_cloud_json_stream_finish(&stream, &len));
+
+		zassert_equal(len, strlen(expected), "%s", test_msgs[i].name);
+		zassert_str_equal(buf, expected, "%s", test_msgs[i].name);
+		cJSON_free(expected);
+	}
+}
+
+ZTEST(nrf_cloud_json_stream, test_numbers_match_cjson)
+{
+	struct nrf_cloud_json_stream stream;
+	cJSON *array = cJSON_CreateArray();
+	char *expected;
+
+	nrf_cloud_json_stream_init(&stream, buf, sizeof(buf));
+	nrf_cloud_json_stream_array_start(&stream, NULL);
+	for (size_t i = 0; i < ARRAY_SIZE(numbers); i++) {
+		cJSON_AddItemToArray(array, cJSON_CreateNumber(numbers[i]));
+		nrf_cloud_json_stream_num_add(&stream, NULL, numbers[i]);
+	}
+	nrf_cloud_json_stream_array_end(&stream);
+
+	expected = cJSON_PrintUnformatted(array);
+	cJSON_Delete(array);
+	zassert_not_null(expected);
+
+	zassert_ok(nrf_cloud_json_stream_finish(&stream, NULL));
+	zassert_str_equal(buf, expected);
+	cJSON_free(expected);
+}
+
+ZTEST(nrf_cloud_json_stream, test_other_items)
+{
+	struct nrf_cloud_json_stream stream;
+
+	nrf_cloud_json_stream_init(&stream, buf, sizeof(buf));
+	nrf_cloud_json_stream_obj_start(&stream, NULL);
+	nrf_cloud_json_stream_int_add(&stream, "ts", 9007199254740993LL);
+	nrf_cloud_json_stream_bool_add(&stream, "on", true);
+	nrf_cloud_json_stream_bool_add(&stream, "off", false);
+	nrf_cloud_json_stream_array_start(&stream, "empty");
+	nrf_cloud_json_stream_array_end(&stream);
+	nrf_cloud_json_stream_obj_start(&stream, "obj");
+	nrf_cloud_json_stream_obj_end(&stream);
+	nrf_cloud_json_stream_str_add(&stream, "str", NULL);
+	nrf_cloud_json_stream_obj_end(&stream);
+
+	zassert_ok(nrf_cloud_json_stream_finish(&stream, NULL));
+	zassert_str_equal(buf, "{\"ts\":9007199254740993,\"on\":true,\"off\":false,"
+			       "\"empty\":[],\"obj\":{},\"str\":\"\"}");
+}
+
+ZTEST(nrf_cloud_json_stream, test_buffer_too_small)
+{
+	struct nrf_cloud_json_stream stream;
+	size_t expected_len;
+	size_t len;
+
+	/* Find the length of the message, then try every smaller buffer size */
+	nrf_cloud_json_stream_init(&stream, buf, sizeof(buf));
+	test_msgs[0].stream_write(&stream);
+	zassert_ok(nrf_cloud_json_stream_finish(&stream, &expected_len));
+
+	for (size_t size = 1; size <= expected_len; size++) {
+		memset(buf, 'x', sizeof(buf));
+		nrf_cloud_json_stream_init(&stream, buf, size);
+		test_msgs[0].stream_write(&stream);
+		zassert_equal(nrf_cloud_json_stream_finish(&stream, &len), -E2BIG);
+		zassert_equal(len, 0);
+		/* Nothing is written past the end of the buffer */
+		zassert_equal(buf[size], 'x', "size %zu", size);
+	}
+
+	nrf_cloud_json_stream_init(&stream, buf, expected_len + 1);
+	test_msgs[0].stream_write(&stream);
+	zassert_ok(nrf_cloud_json_stream_finish(&stream, &len));
+	zassert_equal(len, expected_len);
+	zassert_equal(buf[len], '\0');
+}
+
+ZTEST(nrf_cloud_json_stream, test_no_buffer)
+{
+	struct nrf_cloud_json_stream stream;
+
+	nrf_cloud_json_stream_init(&stream, NULL, sizeof(buf));
+	test_msgs[0].stream_write(&stream);
+	zassert_equal(nrf_cloud_json_stream_finish(&stream, NULL), -EINVAL);
+}
+
+ZTEST_SUITE(nrf_cloud_json_stream, NULL, setup, NULL, NULL, NULL);
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <cJSON.h>
+#include <net/nrf_cloud_codec.h>
+#include "nrf_cloud_codec_internal.h"
+#include "messages.h"
+
+/* Size header in front of each tracked allocation */
+#define HDR_SIZE sizeof(max_align_t)
+
+static size_t heap_cur;
+static size_t heap_peak;
+
+static void *track_malloc(size_t size)
+{
+	uint8_t *ptr = malloc(HDR_SIZE + size);
+
+	if (!ptr) {
+		return NULL;
+	}
+
+	*(size_t *)ptr = size;
+	heap_cur += size;
+	heap_peak = MAX(heap_peak, heap_cur);
+
+	return ptr + HDR_SIZE;
+}
+
+static void track_free(void *ptr)
+{
+	uint8_t *hdr;
+
+	if (!ptr) {
+		return;
+	}
+
+	hdr = (uint8_t *)ptr - HDR_SIZE;
+	heap_cur -= *(size_t *)hdr;
+	free(hdr);
+}
+
+void heap_track_init(void)
+{
+	cJSON_Hooks hooks = {
+		.malloc_fn = track_malloc,
+		.free_fn = track_free,
+	};
+
+	cJSON_InitHooks(&hooks);
+}
+
+void heap_track_reset(void)
+{
+	heap_peak = heap_cur;
+}
+
+size_t heap_track_peak(void)
+{
+	return heap_peak;
+}
+
+/* Sensor data message, as sent with nrf_cloud_sensor_data_send() */
+static char *sensor_tree_print(void)
+{
+	struct nrf_cloud_data out;
+
+	if (nrf_cloud_encode_message("TEMP", 21.5, NULL, NULL, TS, &out)) {
+		return NULL;
+	}
+
+	return (char *)out.ptr;
+}
+
+static void sensor_stream_write(struct nrf_cloud_json_stream *stream)
+{
+	(void)nrf_cloud_encode_message_stream("TEMP", 21.5, NULL, NULL, TS, stream);
+}
+
+/* Text log message with a topic, with characters that need escaping */
+static const char log_text[] = "fault\t\"bus\" at 0x2000\\0\r\n\x01";
+static const char log_topic[] = "prod/1234/m/d/nrf-1234/d2c";
+
+static char *log_tree_print(void)
+{
+	struct nrf_cloud_data out;
+
+	if (nrf_cloud_encode_message("LOG", 0, log_text, log_topic, TS, &out)) {
+		return NULL;
+	}
+
+	return (char *)out.ptr;
+}
+
+static void log_stream_write(struct nrf_cloud_json_stream *stream)
+{
+	(void)nrf_cloud_encode_message_stream("LOG", 0, log_text, log_topic, TS, stream);
+}
+
+/* Info sections sent once connected, as the CoAP transport encodes them with cJSON */
+static char *device_status_tree_print(void)
+{
+	NRF_CLOUD_OBJ_JSON_DEFINE(info_obj);
+	int err;
+
+	if (nrf_cloud_obj_init(&info_obj)) {
+		return NULL;
+	}
+
+	err = nrf_cloud_enabled_info_sections_json_encode(info_obj.json, APP_VER);
+	if (!err) {
+		err = nrf_cloud_obj_cloud_encode(&info_obj);
+	}
+	(void)nrf_cloud_obj_free(&info_obj);
+
+	return err ? NULL : (char *)info_obj.encoded_data.ptr;
+}
+
+static void device_status_stream_write(struct nrf_cloud_json_stream *stream)
+{
+	(void)nrf_cloud_enabled_info_sections_json_stream_encode(stream, APP_VER);
+}
+
+const struct test_msg test_msgs[] = {
+	{"sensor", sensor_tree_print, sensor_stream_write},
+	{"log", log_tree_print, log_stream_write},
+	{"device status", device_status_tree_print, device_status_stream_write},
+};
+
+const size_t test_msgs_cnt = ARRAY_SIZE(test_msgs);
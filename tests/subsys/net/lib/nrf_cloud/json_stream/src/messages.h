@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef MESSAGES_H_
+#define MESSAGES_H_
+
+#include <stddef.h>
+#include "nrf_cloud_json_stream.h"
+
+/* Size of the buffer the messages are streamed into */
+#define MSG_BUF_SIZE 1024
+
+/* Timestamp and application version of the messages */
+#define TS 1700000000123LL
+#define APP_VER "1.2.3+build42"
+
+/* A device message that the library encodes both with cJSON and with the JSON stream */
+struct test_msg {
+	const char *name;
+	/* Encodes the message with cJSON, the result is freed with cJSON_free() */
+	char *(*tree_print)(void);
+	/* Writes the same message into the stream */
+	void (*stream_write)(struct nrf_cloud_json_stream *stream);
+};
+
+extern const struct test_msg test_msgs[];
+extern const size_t test_msgs_cnt;
+
+/* Route the cJSON allocations through the heap usage tracker */
+void heap_track_init(void);
+
+/* Reset the peak heap usage */
+void heap_track_reset(void);
+
+/* Peak heap usage, in bytes, since the last reset */
+size_t heap_track_peak(void);
+
+#endif /* MESSAGES_H_ */
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/random/random.h>
+#include "fakes.h"
+#include "batches.h"
+
+#include "nrf_cloud_log_backend.c"
+
+#define TS 1700000000000LL
+#define SEQUENCE 42
+#define BATCHES_NUM 20
+
+/* A batch of dictionary logs, as logged and as sent by the CoAP transport */
+struct batch {
+	uint8_t data[RING_BUF_SIZE];
+	size_t len;
+	int msg_cnt;
+};
+
+static struct batch logged[BATCHES_NUM + 1];
+static struct batch sent[BATCHES_NUM + 1];
+static int sent_cnt;
+
+static int bin_log_send_custom_fake(const uint8_t *const buf, size_t buf_len, bool confirmable)
+{
+	ARG_UNUSED(confirmable);
+
+	if ((sent_cnt >= ARRAY_SIZE(sent)) || (buf_len > sizeof(sent[0].data))) {
+		return -ENOMEM;
+	}
+
+	memcpy(sent[sent_cnt].data, buf, buf_len);
+	sent[sent_cnt].len = buf_len;
+	sent_cnt++;
+
+	return 0;
+}
+
+/* Passes a rendered log message to the backend, which sends the batch first when the
+ * message does not fit in the ring buffer.
+ */
+static void msg_log(const uint8_t *msg, size_t len)
+{
+	struct batch *batch;
+
+	zassert_equal(logger_out((uint8_t *)msg, len, NULL), len);
+
+	batch = &logged[sent_cnt];
+	zassert_true(batch->len + len <= sizeof(batch->data));
+	memcpy(&batch->data[batch->len], msg, len);
+	batch->len += len;
+	batch->msg_cnt++;
+}
+
+static void msgs_log(int cnt)
+{
+	uint8_t msg[MSG_SIZE_MAX];
+
+	for (int i = 0; i < cnt; i++) {
+		msg_log(msg, msg_fill(msg));
+	}
+}
+
+/* Sends what is in the ring buffer, as when the logging thread is done processing */
+static void logs_flush(void)
+{
+	logger_notify(&log_nrf_cloud_backend, LOG_BACKEND_EVT_PROCESS_THREAD_DONE, NULL);
+}
+
+static void bin_hdr_check(const struct batch *batch, uint16_t format)
+{
+	struct nrf_cloud_bin_hdr hdr;
+
+	zassert_true(batch->len > sizeof(hdr));
+	memcpy(&hdr, batch->data, sizeof(hdr));
+	zassert_equal(hdr.magic, NRF_CLOUD_BINARY_MAGIC);
+	zassert_equal(hdr.format, format);
+	zassert_equal(hdr.ts, TS);
+	zassert_equal(hdr.sequence, SEQUENCE);
+}
+
+/* Decompresses a sent batch like the receiver would, and compares it with the logs */
+static void batch_check(int idx, uint32_t batch_seq)
+{
+	static uint8_t raw[RING_BUF_SIZE];
+	struct nrf_cloud_log_lz_hdr lz_hdr;
+	const size_t hdr_len = sizeof(struct nrf_cloud_bin_hdr);
+
+	bin_hdr_check(&sent[idx], NRF_CLOUD_DICT_LOG_LZ_FMT);
+	zassert_ok(nrf_cloud_log_lz_unframe(&sent[idx].data[hdr_len], sent[idx].len - hdr_len,
+					    &lz_hdr, raw, sizeof(raw)));
+
+	zassert_equal(lz_hdr.batch_seq, batch_seq);
+	zassert_equal(lz_hdr.msg_cnt, logged[idx].msg_cnt);
+	zassert_equal(lz_hdr.raw_len, logged[idx].len);
+	zassert_mem_equal(raw, logged[idx].data, logged[idx].len);
+}
+
+static void *setup(void)
+{
+	zassert_ok(logger_format_set(&log_nrf_cloud_backend, LOG_OUTPUT_DICT));
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	RESET_FAKE(nrf_cloud_coap_is_connected);
+	RESET_FAKE(nrf_cloud_coap_bin_log_send);
+	FFF_RESET_HISTORY();
+
+	nrf_cloud_coap_is_connected_fake.return_val = true;
+	nrf_cloud_coap_bin_log_send_fake.custom_fake = bin_log_send_custom_fake;
+
+	memset(logged, 0, sizeof(logged));
+	memset(sent, 0, sizeof(sent));
+	sent_cnt = 0;
+
+	/* Backend state */
+	ring_buf_reset(&log_nrf_cloud_rb);
+	num_msgs = 0;
+	batch_seq = 0;
+	memset(&stats, 0, sizeof(stats));
+	log_context.ts = TS;
+	log_context.sequence = SEQUENCE;
+}
+
+ZTEST(nrf_cloud_log_lz_backend, test_batch_compressed)
+{
+	msgs_log(10);
+	zassert_equal(sent_cnt, 0);
+
+	logs_flush();
+
+	zassert_equal(sent_cnt, 1);
+	batch_check(0, 0);
+
+	zassert_equal(stats.batches_compressed, 1);
+	zassert_equal(stats.lines_sent, 10);
+	zassert_equal(stats.bytes_sent, sent[0].len);
+	zassert_equal(stats.bytes_saved,
+		      sizeof(struct nrf_cloud_bin_hdr) + logged[0].len - sent[0].len);
+
+	/* Nothing is left to send */
+	logs_flush();
+	zassert_equal(sent_cnt, 1);
+}
+
+ZTEST(nrf_cloud_log_lz_backend, test_incompressible_batch_sent_raw)
+{
+	const size_t hdr_len = sizeof(struct nrf_cloud_bin_hdr);
+	uint8_t msg[MSG_SIZE_MAX];
+
+	for (int i = 0; i < 16; i++) {
+		sys_rand_get(msg, sizeof(msg));
+		msg_log(msg, sizeof(msg));
+	}
+	logs_flush();
+
+	/* The batch is sent as logged, in the uncompressed format */
+	zassert_equal(sent_cnt, 1);
+	bin_hdr_check(&sent[0], NRF_CLOUD_DICT_LOG_FMT);
+	zassert_equal(sent[0].len, hdr_len + logged[0].len);
+	zassert_mem_equal(&sent[0].data[hdr_len], logged[0].data, logged[0].len);
+	zassert_equal(stats.batches_compressed, 0);
+
+	/* The uncompressed batch still counts in the batch sequence numbers */
+	msgs_log(10);
+	logs_flush();
+
+	zassert_equal(sent_cnt, 2);
+	batch_check(1, 1);
+	zassert_equal(stats.batches_compressed, 1);
+}
+
+ZTEST(nrf_cloud_log_lz_backend, test_full_batches)
+{
+	uint8_t msg[MSG_SIZE_MAX];
+	size_t raw_bytes = 0;
+	size_t b64_bytes = 0;
+	size_t sent_bytes = 0;
+	uint32_t cycles = 0;
+	uint32_t start;
+	size_t b64_len;
+	size_t len;
+	int cnt;
+
+	/* Each batch is sent when the ring buffer is full. The time spent in the calls that
+	 * send a batch is mostly spent compressing it.
+	 */
+	while (sent_cnt < BATCHES_NUM) {
+		len = msg_fill(msg);
+		cnt = sent_cnt;
+		start = k_cycle_get_32();
+		msg_log(msg, len);
+		if (sent_cnt != cnt) {
+			cycles += k_cycle_get_32() - start;
+		}
+	}
+
+	for (int i = 0; i < BATCHES_NUM; i++) {
+		batch_check(i, i);
+
+		/* Sizes with the binary header. Over REST, the batch is sent as quoted base64. */
+		len = sizeof(struct nrf_cloud_bin_hdr) + logged[i].len;
+		(void)base64_encode(NULL, 0, &b64_len, logged[i].data, len);
+		raw_bytes += len;
+		b64_bytes += b64_len + 1;
+		sent_bytes += sent[i].len;
+	}
+
+	zassert_equal(stats.batches_compressed, BATCHES_NUM);
+	zassert_equal(stats.bytes_sent, sent_bytes);
+	zassert_true(sent_bytes < raw_bytes);
+
+	TC_PRINT("%d batches: raw %zu bytes, base64 %zu bytes, compressed %zu bytes (%zu%%), "
+		 "%u cycles per batch\n",
+		 BATCHES_NUM, raw_bytes, b64_bytes, sent_bytes, 100 * sent_bytes / raw_bytes,
+		 cycles / BATCHES_NUM);
+}
+
+ZTEST_SUITE(nrf_cloud_log_lz_backend, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include "batches.h"
+
+/* Dictionary log message: the log message header followed by the cbprintf package, where
+ * the format string is only referenced by its address in the image.
+ */
+struct dict_msg {
+	uint8_t type;
+	uint8_t domain_level;
+	uint16_t package_len;
+	uint16_t data_len;
+	uint16_t source;
+	uint32_t timestamp;
+	uint32_t fmt;
+	uint32_t args[3];
+} __packed;
+
+BUILD_ASSERT(sizeof(struct dict_msg) <= MSG_SIZE_MAX);
+
+/* Format strings and sources of an application that logs periodically */
+static const uint32_t fmts[] = {0x0003a1c4, 0x0003a1f0, 0x0003a230, 0x0003b004, 0x0003b038};
+static const uint16_t sources[] = {12, 12, 31, 7, 44};
+static const uint8_t nargs[] = {1, 2, 3, 0, 2};
+
+static uint32_t lcg_state = 12345;
+static uint32_t timestamp = 100000;
+static uint32_t msg_cnt;
+
+static uint32_t lcg_next(void)
+{
+	lcg_state = lcg_state * 1103515245U + 12345U;
+	return lcg_state >> 8;
+}
+
+size_t msg_fill(uint8_t *buf)
+{
+	size_t i = lcg_next() % ARRAY_SIZE(fmts);
+	struct dict_msg msg = {
+		.type = 1,
+		.domain_level = 3 - (i % 3),
+		.package_len = 4 + 4 * nargs[i],
+		.source = sources[i],
+		.fmt = fmts[i],
+	};
+	size_t msg_len = offsetof(struct dict_msg, args) + 4 * nargs[i];
+
+	timestamp += 50 + (lcg_next() % 2000);
+	msg.timestamp = timestamp;
+	/* Arguments are sensor readings, counters and error codes */
+	msg.args[0] = 2000 + (lcg_next() % 64);
+	msg.args[1] = msg_cnt++;
+	msg.args[2] = (lcg_next() % 4) ? 0 : (uint32_t)-116;
+
+	memcpy(buf, &msg, msg_len);
+	return msg_len;
+}
+
+int batch_fill(uint8_t *buf, size_t size, size_t *len)
+{
+	uint8_t msg[MSG_SIZE_MAX];
+	size_t msg_len;
+	int cnt = 0;
+
+	*len = 0;
+
+	while (true) {
+		msg_len = msg_fill(msg);
+		if (*len + msg_len > size) {
+			break;
+		}
+
+		memcpy(&buf[*len], msg, msg_len);
+		*len += msg_len;
+		cnt++;
+	}
+
+	return cnt;
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BATCHES_H_
+#define BATCHES_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Default size of the log backend's ring buffer with MQTT and REST */
+#define BATCH_SIZE_MAX 2048
+
+/* Largest dictionary log message written by msg_fill() */
+#define MSG_SIZE_MAX 24
+
+/* Write the next dictionary log message of the application, as rendered by the logging
+ * subsystem.
+ *
+ * @return Length of the message.
+ */
+size_t msg_fill(uint8_t *buf);
+
+/* Fill a batch with dictionary log messages, the way the log backend does in its ring
+ * buffer. The batch does not include the binary header.
+ *
+ * @return Number of log messages in the batch.
+ */
+int batch_fill(uint8_t *buf, size_t size, size_t *len);
+
+#endif /* BATCHES_H_ */
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_coap.h>
+#include <net/nrf_cloud_log.h>
+#include <net/nrf_cloud_rest.h>
+#include <nrf_cloud_codec_internal.h>
+#include <nrf_cloud_coap_transport.h>
+#include <nrf_cloud_client_id.h>
+#include <nrf_cloud_fsm.h>
+#include <nrf_cloud_log_internal.h>
+#include <nrf_cloud_mem.h>
+#include <zephyr/fff.h>
+
+DEFINE_FFF_GLOBALS;
+
+/* Fake functions declaration, only the CoAP ones are used on the dictionary log path */
+FAKE_VOID_FUNC(nrf_cloud_log_init);
+FAKE_VALUE_FUNC(int, nrf_cloud_log_control_get);
+FAKE_VALUE_FUNC(bool, nrf_cloud_log_is_enabled);
+FAKE_VOID_FUNC(nrf_cloud_log_init_context_internal, void *, const char *, int, uint32_t,
+	       const char *, uint8_t, int64_t, struct nrf_cloud_log_context *);
+FAKE_VALUE_FUNC(int, nrf_cloud_log_json_encode, struct nrf_cloud_log_context *, uint8_t *,
+		size_t, struct nrf_cloud_data *);
+FAKE_VALUE_FUNC(enum nfsm_state, nfsm_get_current_state);
+FAKE_VALUE_FUNC(int, nrf_cloud_send, const struct nrf_cloud_tx_data *);
+FAKE_VALUE_FUNC(int, nrf_cloud_rest_send_device_message, struct nrf_cloud_rest_context *const,
+		const char *const, const char *const, const bool, const char *const);
+FAKE_VALUE_FUNC(int, nrf_cloud_client_id_ptr_get, const char **);
+FAKE_VALUE_FUNC(void *, nrf_cloud_malloc, size_t);
+FAKE_VOID_FUNC(nrf_cloud_free, void *);
+FAKE_VOID_FUNC(cJSON_free, void *);
+FAKE_VALUE_FUNC(bool, nrf_cloud_coap_is_connected);
+FAKE_VALUE_FUNC(int, nrf_cloud_coap_json_message_send, const char *, bool, bool);
+FAKE_VALUE_FUNC(int, nrf_cloud_coap_bin_log_send, const uint8_t *const, size_t, bool);
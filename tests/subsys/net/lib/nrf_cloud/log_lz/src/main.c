@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/random/random.h>
+#include "nrf_cloud_log_lz.h"
+#include "batches.h"
+
+static struct nrf_cloud_log_lz_ctx ctx;
+static uint8_t batch[BATCH_SIZE_MAX];
+static uint8_t frame[BATCH_SIZE_MAX * 2];
+static uint8_t out[BATCH_SIZE_MAX];
+
+static void roundtrip(size_t len, uint16_t msg_cnt, uint32_t seq)
+{
+	struct nrf_cloud_log_lz_hdr hdr;
+	size_t frame_len;
+
+	zassert_ok(nrf_cloud_log_lz_frame(&ctx, batch, len, msg_cnt, seq, frame, sizeof(frame),
+					  &frame_len));
+	zassert_ok(nrf_cloud_log_lz_unframe(frame, frame_len, &hdr, out, sizeof(out)));
+
+	zassert_equal(hdr.raw_len, len);
+	zassert_equal(hdr.msg_cnt, msg_cnt);
+	zassert_equal(hdr.batch_seq, seq);
+	zassert_mem_equal(out, batch, len);
+}
+
+ZTEST(nrf_cloud_log_lz, test_roundtrip_random)
+{
+	for (size_t len = 1; len <= sizeof(batch); len = len * 3 + 1) {
+		sys_rand_get(batch, len);
+		roundtrip(len, 0, len);
+	}
+}
+
+ZTEST(nrf_cloud_log_lz, test_roundtrip_runs)
+{
+	/* Long literals and long overlapping matches need extension bytes */
+	sys_rand_get(batch, 300);
+	memset(&batch[300], 0xAA, 1000);
+	for (size_t i = 1300; i < sizeof(batch); i++) {
+		batch[i] = i % 3;
+	}
+
+	roundtrip(sizeof(batch), 1, 0);
+	/* Too short for a match */
+	roundtrip(4, 1, 1);
+}
+
+ZTEST(nrf_cloud_log_lz, test_roundtrip_dict_logs)
+{
+	size_t len;
+	int cnt;
+
+	for (uint32_t seq = 0; seq < 10; seq++) {
+		cnt = batch_fill(batch, sizeof(batch), &len);
+		roundtrip(len, cnt, seq);
+	}
+}
+
+ZTEST(nrf_cloud_log_lz, test_frame_too_small)
+{
+	size_t frame_len;
+	size_t len;
+
+	(void)batch_fill(batch, sizeof(batch), &len);
+	zassert_ok(nrf_cloud_log_lz_frame(&ctx, batch, len, 0, 0, frame, sizeof(frame),
+					  &frame_len));
+
+	zassert_equal(nrf_cloud_log_lz_frame(&ctx, batch, len, 0, 0, frame, frame_len - 1,
+					     &frame_len), -E2BIG);
+	zassert_equal(frame_len, 0);
+	zassert_equal(nrf_cloud_log_lz_frame(&ctx, batch, len, 0, 0, frame,
+					     sizeof(struct nrf_cloud_log_lz_hdr) - 1,
+					     &frame_len), -E2BIG);
+}
+
+ZTEST(nrf_cloud_log_lz, test_frame_invalid)
+{
+	size_t frame_len;
+
+	zassert_equal(nrf_cloud_log_lz_frame(&ctx, batch, 0, 0, 0, frame, sizeof(frame),
+					     &frame_len), -EINVAL);
+	zassert_equal(nrf_cloud_log_lz_frame(&ctx, batch, NRF_CLOUD_LOG_LZ_BATCH_MAX + 1, 0, 0,
+					     frame, sizeof(frame), &frame_len), -EINVAL);
+	zassert_equal(nrf_cloud_log_lz_frame(NULL, batch, 1, 0, 0, frame, sizeof(frame),
+					     &frame_len), -EINVAL);
+}
+
+ZTEST(nrf_cloud_log_lz, test_unframe_malformed)
+{
+	struct nrf_cloud_log_lz_hdr hdr = {.raw_len = 8};
+	size_t frame_len;
+	size_t len;
+
+	/* Truncated frames are rejected. The last byte may be an empty final sequence. */
+	(void)batch_fill(batch, sizeof(batch), &len);
+	zassert_ok(nrf_cloud_log_lz_frame(&ctx, batch, len, 0, 0, frame, sizeof(frame),
+					  &frame_len));
+	for (size_t cut = 0; cut < frame_len - 1; cut++) {
+		zassert_not_equal(nrf_cloud_log_lz_unframe(frame, cut, &hdr, out, sizeof(out)), 0,
+				  "cut at %zu", cut);
+	}
+
+	/* The batch does not fit */
+	zassert_equal(nrf_cloud_log_lz_unframe(frame, frame_len, &hdr, out, len - 1), -E2BIG);
+
+	/* A match that refers to data before the start of the batch */
+	hdr.raw_len = 8;
+	memcpy(frame, &hdr, sizeof(hdr));
+	frame_len = sizeof(hdr);
+	frame[frame_len++] = 0x10;
+	frame[frame_len++] = 'a';
+	frame[frame_len++] = 2;
+	frame[frame_len++] = 0;
+	zassert_equal(nrf_cloud_log_lz_unframe(frame, frame_len, &hdr, out, sizeof(out)),
+		      -EBADMSG);
+}
+
+ZTEST_SUITE(nrf_cloud_log_lz, NULL, NULL, NULL, NULL, NULL);
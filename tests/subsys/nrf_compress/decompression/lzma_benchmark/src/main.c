@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <nrf_compress/implementation.h>
+#include <mbedtls/sha256.h>
+
+#define SHA256_SIZE 32
+#define INSTANCES_NUM 2
+#define RUNS_NUM 10
+
+/* Input valid lzma2 compressed data */
+static const uint8_t dummy_data_input[] = {
+#include "dummy_data_input.inc"
+};
+
+/* File size and sha256 hash of decompressed data */
+static const uint32_t dummy_data_output_size = 66477;
+static const uint8_t dummy_data_output_sha256[] = {
+	0x87, 0xee, 0x2e, 0x17, 0xa5, 0xdb, 0x98, 0xbe,
+	0x8c, 0xcb, 0xfe, 0xc9, 0x70, 0x8c, 0x7a, 0x43,
+	0x66, 0xda, 0x63, 0xff, 0x48, 0x15, 0x48, 0x88,
+	0xd7, 0xed, 0x64, 0x87, 0xba, 0xb9, 0xef, 0xc5
+};
+
+/* Input valid lzma2 compressed data whereby the output is larger than the dictionary size */
+static const uint8_t dummy_data_large_input[] = {
+#include "dummy_data_input_large.inc"
+};
+
+/* File size and sha256 hash of decompressed data for an output larger than dictionary size */
+static const uint32_t dummy_data_large_output_size = 134061;
+static const uint8_t dummy_data_large_output_sha256[] = {
+	0xc0, 0xc4, 0xac, 0xc7, 0xac, 0x69, 0x37, 0x4b,
+	0x60, 0xb4, 0x87, 0xe9, 0x3d, 0x65, 0xcf, 0xa2,
+	0x4b, 0x2b, 0xef, 0xd0, 0xb9, 0xbf, 0xf9, 0xc9,
+	0x2f, 0x61, 0x52, 0x17, 0xca, 0x55, 0x03, 0x77
+};
+
+struct stream {
+	lzma_codec codec;
+	const uint8_t *input;
+	size_t input_size;
+	size_t pos;
+	size_t output_size;
+	mbedtls_sha256_context sha;
+	bool done;
+};
+
+static uint8_t __aligned(4) probs[INSTANCES_NUM][NRF_COMPRESS_LZMA_PROBS_SIZE];
+static uint8_t dicts[INSTANCES_NUM][NRF_COMPRESS_LZMA_DICT_SIZE];
+static struct stream streams[INSTANCES_NUM];
+static struct nrf_compress_implementation *implementation;
+
+#if defined(CONFIG_NATIVE_LIBRARY)
+uint64_t lzma_benchmark_host_time_us(void);
+#endif
+
+static uint64_t time_us_get(void)
+{
+#if defined(CONFIG_NATIVE_LIBRARY)
+	return lzma_benchmark_host_time_us();
+#else
+	return k_ticks_to_us_floor64(k_uptime_ticks());
+#endif
+}
+
+static void stream_start(struct stream *stream, size_t idx, const uint8_t *input,
+			 size_t input_size, size_t output_size)
+{
+	int rc;
+
+	memset(stream, 0, sizeof(*stream));
+	stream->codec.probs = probs[idx];
+	stream->codec.dict = dicts[idx];
+	stream->input = input;
+	stream->input_size = input_size;
+
+	mbedtls_sha256_init(&stream->sha);
+	rc = mbedtls_sha256_starts(&stream->sha, false);
+	zassert_ok(rc, "Expected mbedtls sha256 start to be successful");
+
+	rc = implementation->init(&stream->codec, output_size);
+	zassert_ok(rc, "Expected init to be successful");
+}
+
+static void stream_step(struct stream *stream)
+{
+	int rc;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	size_t len = implementation->decompress_bytes_needed(&stream->codec);
+	bool last_part = stream->pos + len >= stream->input_size;
+
+	if (last_part) {
+		len = stream->input_size - stream->pos;
+	}
+
+	rc = implementation->decompress(&stream->codec, &stream->input[stream->pos], len,
+					last_part, &offset, &output, &output_size);
+	zassert_ok(rc, "Expected decompress to be successful");
+
+	if (output_size > 0) {
+		rc = mbedtls_sha256_update(&stream->sha, output, output_size);
+		zassert_ok(rc, "Expected hash update to be successful");
+	}
+
+	stream->output_size += output_size;
+	stream->pos += offset;
+	stream->done = stream->pos >= stream->input_size;
+}
+
+static void stream_finish(struct stream *stream, size_t output_size, const uint8_t *sha256)
+{
+	int rc;
+	uint8_t output_sha[SHA256_SIZE];
+
+	rc = implementation->deinit(&stream->codec);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	rc = mbedtls_sha256_finish(&stream->sha, output_sha);
+	mbedtls_sha256_free(&stream->sha);
+	zassert_ok(rc, "Expected mbedtls sha256 finish to be successful");
+
+	zassert_equal(stream->output_size, output_size, "Expected decompressed data size to match");
+	zassert_mem_equal(output_sha, sha256, SHA256_SIZE, "Expected hash to match");
+}
+
+/* Decompresses the large input on the given number of instances, one chunk of each in turn */
+static uint64_t interleaved_run(size_t instances)
+{
+	uint64_t start = time_us_get();
+	bool done;
+
+	for (size_t i = 0; i < instances; i++) {
+		stream_start(&streams[i], i, dummy_data_large_input,
+			     sizeof(dummy_data_large_input), dummy_data_large_output_size);
+	}
+
+	do {
+		done = true;
+
+		for (size_t i = 0; i < instances; i++) {
+			if (!streams[i].done) {
+				stream_step(&streams[i]);
+				done = false;
+			}
+		}
+	} while (!done);
+
+	for (size_t i = 0; i < instances; i++) {
+		stream_finish(&streams[i], dummy_data_large_output_size,
+			      dummy_data_large_output_sha256);
+	}
+
+	return time_us_get() - start;
+}
+
+static void throughput_print(size_t instances)
+{
+	uint64_t time_us = 0;
+	uint64_t bytes = (uint64_t)RUNS_NUM * instances * dummy_data_large_output_size;
+
+	for (int i = 0; i < RUNS_NUM; i++) {
+		time_us += interleaved_run(instances);
+	}
+
+	time_us = MAX(time_us, 1);
+
+	TC_PRINT("%zu instance(s), %llu bytes in %llu us: %llu B/s\n", instances,
+		 (unsigned long long)bytes, (unsigned long long)time_us,
+		 (unsigned long long)(bytes * USEC_PER_SEC / time_us));
+}
+
+ZTEST(nrf_compress_lzma_benchmark, test_two_instances)
+{
+	bool done;
+
+	stream_start(&streams[0], 0, dummy_data_input, sizeof(dummy_data_input),
+		     dummy_data_output_size);
+	stream_start(&streams[1], 1, dummy_data_large_input, sizeof(dummy_data_large_input),
+		     dummy_data_large_output_size);
+
+	do {
+		done = true;
+
+		for (size_t i = 0; i < INSTANCES_NUM; i++) {
+			if (!streams[i].done) {
+				stream_step(&streams[i]);
+				done = false;
+			}
+		}
+	} while (!done);
+
+	stream_finish(&streams[0], dummy_data_output_size, dummy_data_output_sha256);
+	stream_finish(&streams[1], dummy_data_large_output_size, dummy_data_large_output_sha256);
+}
+
+ZTEST(nrf_compress_lzma_benchmark, test_static_buffers_single_user)
+{
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
+	int rc;
+	lzma_codec first = { 0 };
+	lzma_codec second = { 0 };
+
+	rc = implementation->init(&first, 0);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = implementation->init(&second, 0);
+	zassert_equal(rc, -EBUSY, "Expected static buffers to be in use");
+
+	rc = implementation->init(NULL, 0);
+	zassert_equal(rc, -EBUSY, "Expected static buffers to be in use");
+
+	rc = implementation->deinit(&first);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	rc = implementation->init(&second, 0);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = implementation->deinit(&second);
+	zassert_ok(rc, "Expected deinit to be successful");
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST(nrf_compress_lzma_benchmark, test_throughput)
+{
+	for (size_t instances = 1; instances <= INSTANCES_NUM; instances++) {
+		throughput_print(instances);
+	}
+}
+
+static void *setup(void)
+{
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+	zassert_not_null(implementation, "Expected implementation to not be NULL");
+
+	return NULL;
+}
+
+ZTEST_SUITE(nrf_compress_lzma_benchmark, NULL, setup, NULL, NULL, NULL);
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <nrf_rpc/nrf_rpc_uart.h>
+
+#define PACKET_SIZE	 200
+#define PACKETS_NUM	 500
+#define RX_TIMEOUT	 K_SECONDS(30)
+
+static const struct nrf_rpc_tr *rpc_tr = &NRF_RPC_UART_TRANSPORT(DT_CHOSEN(nordic_rpc_uart));
+
+static K_SEM_DEFINE(rx_done_sem, 0, 1);
+static uint32_t rx_count;
+static uint32_t rx_expected;
+static bool rx_invalid;
+
+/* Packets cover all the byte values, so that the special HDLC octets are escaped */
+static uint8_t packet_byte(uint32_t packet, size_t i)
+{
+	return (uint8_t)(packet * 7 + i);
+}
+
+static void receive_cb(const struct nrf_rpc_tr *transport, const uint8_t *packet, size_t len,
+		       void *context)
+{
+	ARG_UNUSED(transport);
+	ARG_UNUSED(context);
+
+	if (len != PACKET_SIZE) {
+		rx_invalid = true;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		if (packet[i] != packet_byte(rx_count, i)) {
+			rx_invalid = true;
+			break;
+		}
+	}
+
+	if (++rx_count == rx_expected) {
+		k_sem_give(&rx_done_sem);
+	}
+}
+
+static uint32_t loopback_run(uint32_t packets)
+{
+	uint32_t start;
+	uint8_t *data;
+	size_t size;
+	int ret;
+
+	rx_count = 0;
+	rx_expected = packets;
+	rx_invalid = false;
+	k_sem_reset(&rx_done_sem);
+
+	start = k_uptime_get_32();
+
+	for (uint32_t packet = 0; packet < packets; packet++) {
+		size = PACKET_SIZE;
+		data = rpc_tr->api->tx_buf_alloc(rpc_tr, &size);
+		zassert_not_null(data);
+
+		for (size_t i = 0; i < size; i++) {
+			data[i] = packet_byte(packet, i);
+		}
+
+		ret = rpc_tr->api->send(rpc_tr, data, size);
+		zassert_ok(ret, "Failed to send packet %u: %d", packet, ret);
+	}
+
+	zassert_ok(k_sem_take(&rx_done_sem, RX_TIMEOUT), "Received %u of %u packets", rx_count,
+		   packets);
+	zassert_false(rx_invalid, "Received packets differ from the sent ones");
+
+	return k_uptime_get_32() - start;
+}
+
+static void *setup(void)
+{
+	zassert_ok(rpc_tr->api->init(rpc_tr, receive_cb, NULL));
+
+	return NULL;
+}
+
+ZTEST(nrf_rpc_uart, test_loopback)
+{
+	(void)loopback_run(1);
+}
+
+ZTEST(nrf_rpc_uart, test_loopback_throughput)
+{
+	uint32_t time_ms = MAX(loopback_run(PACKETS_NUM), 1);
+
+	TC_PRINT("%d packets of %d bytes in %u ms: %u B/s\n", PACKETS_NUM, PACKET_SIZE, time_ms,
+		 (uint32_t)((uint64_t)PACKETS_NUM * PACKET_SIZE * MSEC_PER_SEC / time_ms));
+}
+
+ZTEST_SUITE(nrf_rpc_uart, NULL, setup, NULL, NULL, NULL);
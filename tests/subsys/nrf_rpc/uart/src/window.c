@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/serial/uart_emul.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <nrf_rpc/nrf_rpc_uart.h>
+
+#define HDLC_ESCAPE	0x7d
+#define HDLC_DELIMITER	0x7e
+#define SEQ_SYNC	0x80
+#define SEQ_MASK	0x7f
+#define ACK_SIZE	sizeof(uint16_t)
+#define TAIL_SIZE	(sizeof(uint8_t) + sizeof(uint16_t))
+
+#define PACKET_SIZE	8
+#define FRAME_MAX	32
+/* Packet sent from the system workqueue */
+#define SYSWORKQ_ID	0xa0
+/* Enough for a retransmission to start, with a margin for the scheduling */
+#define RETX_TIME	K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME * 3 / 2)
+
+/* The test is the peer of the transport on the other end of the emulated UART */
+static const struct device *const peer_uart = DEVICE_DT_GET(DT_NODELABEL(euart1));
+static const struct nrf_rpc_tr *rpc_tr = &NRF_RPC_UART_TRANSPORT(DT_NODELABEL(euart1));
+
+struct peer_frame {
+	uint8_t data[FRAME_MAX];
+	size_t len;
+};
+
+/* Packet sent by the transport */
+struct peer_packet {
+	uint8_t id;
+	uint8_t seq;
+	uint16_t crc;
+};
+
+static struct {
+	struct peer_frame frame;
+	bool escape;
+} peer_rx;
+
+static uint32_t rx_count;
+static uint8_t rx_last_id;
+
+static K_SEM_DEFINE(sysworkq_send_sem, 0, 1);
+static int sysworkq_send_ret;
+
+static void receive_cb(const struct nrf_rpc_tr *transport, const uint8_t *packet, size_t len,
+		       void *context)
+{
+	ARG_UNUSED(transport);
+	ARG_UNUSED(context);
+
+	zassert_equal(len, PACKET_SIZE);
+
+	rx_count++;
+	rx_last_id = packet[0];
+}
+
+/* Packets contain the special HDLC octets, so that they are escaped */
+static void packet_fill(uint8_t *data, uint8_t id)
+{
+	data[0] = id;
+	data[1] = HDLC_DELIMITER;
+	data[2] = HDLC_ESCAPE;
+
+	for (size_t i = 3; i < PACKET_SIZE; i++) {
+		data[i] = id + i;
+	}
+}
+
+static int packet_send(uint8_t id)
+{
+	size_t size = PACKET_SIZE;
+	uint8_t *data = rpc_tr->api->tx_buf_alloc(rpc_tr, &size);
+
+	zassert_not_null(data);
+	packet_fill(data, id);
+
+	return rpc_tr->api->send(rpc_tr, data, size);
+}
+
+/* Decode the next frame sent by the transport, if any is sent before the timeout */
+static bool peer_frame_get(struct peer_frame *frame, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	uint8_t byte;
+
+	do {
+		while (uart_emul_get_tx_data(peer_uart, &byte, 1) == 1) {
+			if (byte == HDLC_DELIMITER) {
+				if (peer_rx.frame.len > 0) {
+					*frame = peer_rx.frame;
+					peer_rx.frame.len = 0;
+					return true;
+				}
+				continue;
+			}
+
+			if (byte == HDLC_ESCAPE) {
+				peer_rx.escape = true;
+				continue;
+			}
+
+			if (peer_rx.escape) {
+				byte ^= 0x20;
+				peer_rx.escape = false;
+			}
+
+			zassert_true(peer_rx.frame.len < FRAME_MAX, "Frame too long");
+			peer_rx.frame.data[peer_rx.frame.len++] = byte;
+		}
+
+		k_sleep(K_MSEC(1));
+	} while (!sys_timepoint_expired(end));
+
+	return false;
+}
+
+static void peer_packet_get(struct peer_packet *packet)
+{
+	struct peer_frame frame;
+	uint8_t expected[PACKET_SIZE];
+	uint16_t crc;
+
+	zassert_true(peer_frame_get(&frame, RETX_TIME), "No packet sent");
+	zassert_equal(frame.len, PACKET_SIZE + TAIL_SIZE, "Unexpected frame of %zu bytes",
+		      frame.len);
+
+	packet->id = frame.data[0];
+	packet->seq = frame.data[PACKET_SIZE];
+	packet->crc = sys_get_le16(&frame.data[PACKET_SIZE + 1]);
+
+	packet_fill(expected, packet->id);
+	zassert_mem_equal(frame.data, expected, PACKET_SIZE);
+
+	crc = crc16_ccitt(0xffff, frame.data, PACKET_SIZE + 1);
+	zassert_equal(packet->crc, crc, "Invalid CRC %04x, expected %04x", packet->crc, crc);
+}
+
+static void peer_packet_expect(const struct peer_packet *expected)
+{
+	struct peer_packet packet;
+
+	peer_packet_get(&packet);
+
+	zassert_equal(packet.id, expected->id, "Got packet %u, expected %u", packet.id,
+		      expected->id);
+	zassert_equal(packet.seq, expected->seq);
+	zassert_equal(packet.crc, expected->crc);
+}
+
+static uint16_t peer_ack_get(void)
+{
+	struct peer_frame frame;
+
+	zassert_true(peer_frame_get(&frame, RETX_TIME), "No ack sent");
+	zassert_equal(frame.len, ACK_SIZE, "Unexpected frame of %zu bytes", frame.len);
+
+	return sys_get_le16(frame.data);
+}
+
+static void peer_nothing_expect(void)
+{
+	struct peer_frame frame;
+
+	zassert_false(peer_frame_get(&frame, RETX_TIME), "Unexpected frame of %zu bytes",
+		      frame.len);
+}
+
+static void peer_escaped_put(uint8_t *buf, size_t *len, uint8_t byte)
+{
+	if (byte == HDLC_DELIMITER || byte == HDLC_ESCAPE) {
+		buf[(*len)++] = HDLC_ESCAPE;
+		byte ^= 0x20;
+	}
+
+	buf[(*len)++] = byte;
+}
+
+static void peer_ack_send(uint16_t crc)
+{
+	uint8_t buf[2 * ACK_SIZE + 2];
+	uint8_t ack[ACK_SIZE];
+	size_t len = 0;
+
+	sys_put_le16(crc, ack);
+
+	buf[len++] = HDLC_DELIMITER;
+	for (size_t i = 0; i < ACK_SIZE; i++) {
+		peer_escaped_put(buf, &len, ack[i]);
+	}
+	buf[len++] = HDLC_DELIMITER;
+
+	uart_emul_put_rx_data(peer_uart, buf, len);
+}
+
+/* Send a packet to the transport, returns the CRC the transport is expected to ack */
+static uint16_t peer_packet_send(uint8_t id, uint8_t seq)
+{
+	uint8_t buf[2 * (PACKET_SIZE + TAIL_SIZE) + 2];
+	uint8_t frame[PACKET_SIZE + TAIL_SIZE];
+	size_t len = 0;
+	uint16_t crc;
+
+	packet_fill(frame, id);
+	frame[PACKET_SIZE] = seq;
+	crc = crc16_ccitt(0xffff, frame, PACKET_SIZE + 1);
+	sys_put_le16(crc, &frame[PACKET_SIZE + 1]);
+
+	buf[len++] = HDLC_DELIMITER;
+	for (size_t i = 0; i < sizeof(frame); i++) {
+		peer_escaped_put(buf, &len, frame[i]);
+	}
+	buf[len++] = HDLC_DELIMITER;
+
+	uart_emul_put_rx_data(peer_uart, buf, len);
+
+	return crc;
+}
+
+static void sysworkq_send_handler(struct k_work *work)
+{
+	sysworkq_send_ret = packet_send(SYSWORKQ_ID);
+	k_sem_give(&sysworkq_send_sem);
+}
+
+static K_WORK_DEFINE(sysworkq_send_work, sysworkq_send_handler);
+
+/* The packet is passed to nRF RPC after its ack is sent */
+static void rx_count_expect(uint32_t count)
+{
+	k_sleep(K_MSEC(10));
+	zassert_equal(rx_count, count, "Received %u packets, expected %u", rx_count, count);
+}
+
+static void *setup(void)
+{
+	zassert_ok(rpc_tr->api->init(rpc_tr, receive_cb, NULL));
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	uart_emul_flush_tx_data(peer_uart);
+	memset(&peer_rx, 0, sizeof(peer_rx));
+	rx_count = 0;
+}
+
+ZTEST(nrf_rpc_uart_window, test_cumulative_ack)
+{
+	struct peer_packet packets[3];
+
+	for (uint8_t i = 0; i < ARRAY_SIZE(packets); i++) {
+		zassert_ok(packet_send(i));
+		peer_packet_get(&packets[i]);
+		zassert_equal(packets[i].id, i);
+	}
+
+	for (uint8_t i = 1; i < ARRAY_SIZE(packets); i++) {
+		zassert_equal(packets[i].seq, (packets[i - 1].seq + 1) & SEQ_MASK);
+	}
+
+	/* The ack of the last frame acks all the frames sent before it */
+	peer_ack_send(packets[2].crc);
+
+	peer_nothing_expect();
+}
+
+ZTEST(nrf_rpc_uart_window, test_out_of_order_acks)
+{
+	struct peer_packet packets[3];
+
+	for (uint8_t i = 0; i < ARRAY_SIZE(packets); i++) {
+		zassert_ok(packet_send(i));
+		peer_packet_get(&packets[i]);
+	}
+
+	/* The ack of the second frame releases the first one, whose ack comes later */
+	peer_ack_send(packets[1].crc);
+	peer_ack_send(packets[0].crc);
+
+	/* Only the frame still waiting for ack is sent again */
+	peer_packet_expect(&packets[2]);
+	peer_nothing_expect();
+
+	peer_ack_send(packets[2].crc);
+	peer_ack_send(packets[2].crc);
+
+	peer_nothing_expect();
+}
+
+ZTEST(nrf_rpc_uart_window, test_frame_loss)
+{
+	struct peer_packet packets[2];
+
+	for (uint8_t i = 0; i < ARRAY_SIZE(packets); i++) {
+		zassert_ok(packet_send(i));
+		peer_packet_get(&packets[i]);
+	}
+
+	/* Both frames are lost, so they are sent again unchanged, oldest first */
+	peer_packet_expect(&packets[0]);
+	peer_packet_expect(&packets[1]);
+
+	peer_ack_send(packets[1].crc);
+
+	peer_nothing_expect();
+}
+
+ZTEST(nrf_rpc_uart_window, test_give_up)
+{
+	struct peer_packet lost;
+	struct peer_packet next;
+
+	zassert_ok(packet_send(0));
+	peer_packet_get(&lost);
+
+	for (int i = 1; i < CONFIG_NRF_RPC_UART_TX_ATTEMPTS; i++) {
+		peer_packet_expect(&lost);
+	}
+
+	/* The frame is dropped after the last attempt */
+	peer_nothing_expect();
+
+	/* The failure is reported by the next call, whose frame resynchronizes the receiver */
+	zassert_equal(packet_send(1), -EPROTO);
+	peer_packet_get(&next);
+	zassert_equal(next.id, 1);
+	zassert_true(next.seq & SEQ_SYNC);
+
+	peer_ack_send(next.crc);
+
+	zassert_ok(packet_send(2));
+	peer_packet_get(&next);
+	zassert_false(next.seq & SEQ_SYNC);
+
+	peer_ack_send(next.crc);
+
+	peer_nothing_expect();
+}
+
+ZTEST(nrf_rpc_uart_window, test_full_window_send_from_sysworkq)
+{
+	struct peer_frame frame;
+	struct peer_packet packet;
+	k_timeout_t give_up_time =
+		K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME * (CONFIG_NRF_RPC_UART_TX_ATTEMPTS + 2));
+
+	for (uint8_t i = 0; i < CONFIG_NRF_RPC_UART_WINDOW_SIZE; i++) {
+		zassert_ok(packet_send(i));
+		peer_packet_get(&packet);
+	}
+
+	/* The sender waits for the window, which is released when the oldest frame is dropped */
+	k_work_submit(&sysworkq_send_work);
+
+	zassert_ok(k_sem_take(&sysworkq_send_sem, give_up_time), "Send blocked");
+	zassert_equal(sysworkq_send_ret, -EPROTO);
+
+	/* Ack the new frame, which acks the frames sent before it too */
+	do {
+		peer_packet_get(&packet);
+	} while (packet.id != SYSWORKQ_ID);
+
+	peer_ack_send(packet.crc);
+
+	while (peer_frame_get(&frame, RETX_TIME)) {
+		/* Drop the retransmissions that were in progress */
+	}
+}
+
+ZTEST(nrf_rpc_uart_window, test_receive)
+{
+	uint8_t seq = 10;
+	uint16_t crc;
+
+	/* The first frame resynchronizes the transport after the previous tests */
+	crc = peer_packet_send(0, seq | SEQ_SYNC);
+	zassert_equal(peer_ack_get(), crc);
+	rx_count_expect(1);
+
+	/* A frame after a lost one is dropped without ack */
+	(void)peer_packet_send(2, seq + 2);
+	peer_nothing_expect();
+	rx_count_expect(1);
+
+	crc = peer_packet_send(1, seq + 1);
+	zassert_equal(peer_ack_get(), crc);
+	crc = peer_packet_send(2, seq + 2);
+	zassert_equal(peer_ack_get(), crc);
+	rx_count_expect(3);
+	zassert_equal(rx_last_id, 2);
+
+	/* A retransmitted frame is acked again, but not received twice */
+	crc = peer_packet_send(1, seq + 1);
+	zassert_equal(peer_ack_get(), crc);
+	rx_count_expect(3);
+}
+
+ZTEST_SUITE(nrf_rpc_uart_window, NULL, setup, before, NULL, NULL);